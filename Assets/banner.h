@@ -1,616 +0,0 @@
-unsigned char banner[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
-  0x00, 0x00, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x98, 0x08, 0x06, 0x00, 0x00, 0x00, 0xea, 0x6d, 0x5f,
-  0x5c, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00, 0x2e,
-  0x23, 0x01, 0x78, 0xa5, 0x3f, 0x76, 0x00, 0x00, 0x25, 0xfd, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c,
-  0xed, 0xdd, 0x7b, 0x74, 0x14, 0xd7, 0x9d, 0x27, 0xf0, 0x6f, 0x75, 0xeb, 0x05, 0x0d, 0x08, 0x61,
-  0xdc, 0xbc, 0x44, 0x64, 0x8b, 0x20, 0x4c, 0x72, 0x90, 0x02, 0x36, 0x2c, 0x16, 0x99, 0xe3, 0xd0,
-  0xd2, 0x06, 0xec, 0x18, 0x27, 0xf1, 0x89, 0x64, 0x99, 0x30, 0x9b, 0x70, 0xd4, 0x84, 0x6c, 0xc4,
-  0x84, 0xb1, 0xb4, 0xb1, 0xe2, 0x75, 0xa4, 0xec, 0xa0, 0xb0, 0x0e, 0xec, 0x48, 0x8e, 0x1d, 0xb4,
-  0x63, 0x86, 0xd6, 0xc1, 0xd9, 0xb1, 0x51, 0x03, 0xb3, 0x9e, 0x19, 0x1c, 0xf3, 0x98, 0x40, 0x63,
-  0x8e, 0x41, 0x71, 0x4c, 0x00, 0x4b, 0x99, 0x84, 0xa5, 0x09, 0x4a, 0x30, 0x18, 0x90, 0xe2, 0x00,
-  0x42, 0xb4, 0xd0, 0xab, 0xbb, 0xf7, 0x8f, 0xa6, 0xa3, 0x07, 0xdd, 0xea, 0x47, 0xdd, 0x7a, 0x74,
-  0xd7, 0xf7, 0x73, 0x4e, 0x1f, 0x10, 0x2a, 0xdd, 0xba, 0x2a, 0xa4, 0xbe, 0xbf, 0xba, 0xf5, 0xbb,
-  0xbf, 0x2b, 0x01, 0xf0, 0x83, 0x88, 0x88, 0x88, 0x88, 0xc8, 0x20, 0x4c, 0x5a, 0x77, 0x80, 0x88,
-  0x88, 0x88, 0x88, 0x48, 0x4d, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13,
-  0x11, 0x11, 0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00, 0x4c,
-  0x44, 0x44, 0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01, 0x30,
-  0x11, 0x11, 0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06, 0xc0,
-  0x44, 0x44, 0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00,
-  0x13, 0x11, 0x11, 0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00,
-  0x4c, 0x44, 0x44, 0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01,
-  0x30, 0x11, 0x11, 0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06,
-  0xc0, 0x44, 0x44, 0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18,
-  0x00, 0x13, 0x11, 0x11, 0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61,
-  0x00, 0x4c, 0x44, 0x44, 0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85,
-  0x01, 0x30, 0x11, 0x11, 0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14,
-  0x06, 0xc0, 0x44, 0x44, 0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50,
-  0x18, 0x00, 0x13, 0x11, 0x11, 0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43,
-  0x61, 0x00, 0x4c, 0x44, 0x44, 0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c,
-  0x85, 0x01, 0x30, 0x11, 0x11, 0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32,
-  0x14, 0x06, 0xc0, 0x44, 0x44, 0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8,
-  0x50, 0x18, 0x00, 0x13, 0x11, 0x11, 0x11, 0x91, 0xa1, 0xa4, 0x68, 0xdd, 0x01, 0x22, 0x22, 0x22,
-  0x22, 0x1a, 0x9b, 0x24, 0x49, 0x58, 0xb2, 0x28, 0x17, 0xc5, 0x8f, 0x7d, 0x16, 0x4b, 0x16, 0xe5,
-  0x62, 0xee, 0x9c, 0xe9, 0xc8, 0xca, 0x1c, 0x8f, 0xf1, 0xe3, 0xd3, 0xb5, 0xee, 0x9a, 0x10, 0x3d,
-  0x3d, 0x7d, 0xb8, 0xd1, 0xd5, 0x83, 0xf3, 0x17, 0xae, 0xe1, 0xe4, 0x99, 0x3f, 0xe0, 0x17, 0xef,
-  0xfe, 0x07, 0x3e, 0x38, 0xdd, 0x0e, 0xbf, 0xdf, 0xaf, 0xc8, 0xf9, 0x24, 0x00, 0xca, 0xb4, 0x4c,
-  0x44, 0x44, 0x44, 0x44, 0xb2, 0xa4, 0xa5, 0xa6, 0xe0, 0xaf, 0x9f, 0x59, 0x86, 0x0d, 0xf6, 0x62,
-  0xe4, 0x3e, 0x60, 0x85, 0xdf, 0xef, 0x85, 0xdf, 0xd7, 0x0b, 0xbf, 0xb7, 0x17, 0xf0, 0x0f, 0x22,
-  0x79, 0xc2, 0x38, 0x09, 0x90, 0xcc, 0x90, 0xcc, 0xe3, 0x20, 0x99, 0x32, 0x20, 0x49, 0x66, 0xb4,
-  0xff, 0xb1, 0x13, 0xdb, 0x1c, 0x87, 0xf1, 0x4f, 0xbb, 0x4f, 0xa0, 0x7f, 0x60, 0x50, 0xf4, 0xd9,
-  0x92, 0xe6, 0xca, 0x11, 0x11, 0x11, 0x11, 0x25, 0x8d, 0x47, 0x17, 0x7f, 0x1a, 0xaf, 0xfe, 0xf8,
-  0xaf, 0x31, 0x37, 0xf7, 0x7e, 0xf8, 0xbd, 0x3d, 0xf0, 0xfb, 0xfa, 0xe0, 0xf7, 0xf5, 0xc2, 0x37,
-  0x70, 0x13, 0xde, 0xfe, 0xeb, 0xe8, 0xf6, 0xf4, 0xc3, 0xe7, 0xbb, 0x1b, 0xc6, 0x25, 0x6a, 0x34,
-  0x27, 0x05, 0xfe, 0x30, 0x99, 0x24, 0x4c, 0xb4, 0xa4, 0xc1, 0x9c, 0x36, 0x05, 0xa6, 0x94, 0xcc,
-  0xbb, 0x81, 0x70, 0x3a, 0x24, 0xf3, 0x78, 0x9c, 0x6f, 0xff, 0x13, 0xbe, 0xfb, 0xfd, 0x7f, 0xc2,
-  0x2f, 0x4f, 0xfe, 0x5e, 0xe8, 0x69, 0x13, 0xf5, 0x92, 0x11, 0x11, 0x11, 0x11, 0x25, 0xa5, 0x8d,
-  0xeb, 0xbf, 0x88, 0x9a, 0xef, 0x3d, 0x05, 0x33, 0x7a, 0xe1, 0x1b, 0xbc, 0x05, 0x6f, 0xff, 0x27,
-  0x18, 0xe8, 0xbb, 0x81, 0x9b, 0x5d, 0xfd, 0xb8, 0x79, 0xab, 0x1f, 0xd7, 0x6f, 0xf6, 0xa1, 0xb7,
-  0x6f, 0x10, 0x0a, 0x65, 0x08, 0xa8, 0x4e, 0x92, 0x80, 0x8c, 0xf4, 0x14, 0x64, 0x65, 0xa6, 0x21,
-  0x2b, 0x33, 0x1d, 0x93, 0x33, 0xd3, 0x90, 0x9a, 0x9e, 0x05, 0x73, 0xda, 0x54, 0x98, 0x52, 0x26,
-  0xc1, 0x8b, 0x0c, 0xfc, 0xa8, 0xfe, 0x6d, 0xfc, 0xe4, 0x1f, 0x0e, 0x89, 0x39, 0x1f, 0x18, 0x00,
-  0x13, 0x11, 0x11, 0x11, 0xe9, 0xc6, 0xe6, 0x17, 0x9f, 0x46, 0x85, 0xbd, 0x18, 0xbe, 0x81, 0x1b,
-  0x18, 0xec, 0xbd, 0x02, 0x4f, 0xf7, 0x9f, 0x70, 0xe9, 0x8a, 0x07, 0x37, 0xba, 0xfa, 0xd0, 0x3f,
-  0xe0, 0xc3, 0xf5, 0x9b, 0xfd, 0xf8, 0xfd, 0xc5, 0x5b, 0xf8, 0xe4, 0x7a, 0x2f, 0xfa, 0xfb, 0xbd,
-  0x5a, 0x77, 0x57, 0x88, 0xb4, 0x34, 0x33, 0xa6, 0x66, 0xa5, 0xe3, 0xd3, 0x0f, 0x64, 0x62, 0xca,
-  0xe4, 0x34, 0xa4, 0xa5, 0x9a, 0x90, 0x95, 0x99, 0x8e, 0xd9, 0x33, 0x2d, 0xb0, 0x4c, 0xbc, 0x1f,
-  0x29, 0x19, 0x33, 0x61, 0x4a, 0xcd, 0x42, 0xa3, 0xe3, 0x30, 0x5e, 0xdc, 0xfc, 0x96, 0xec, 0xf3,
-  0x71, 0x11, 0x1c, 0x11, 0x11, 0x11, 0x91, 0x4e, 0x7c, 0xb7, 0xfc, 0x51, 0x7c, 0x67, 0x6d, 0x61,
-  0x20, 0xf8, 0xbd, 0x73, 0x09, 0x97, 0x2e, 0x5f, 0xc5, 0xe5, 0xab, 0x1e, 0xf4, 0xf6, 0xf9, 0xd0,
-  0x72, 0xaa, 0x03, 0x07, 0xde, 0xbd, 0x0c, 0x77, 0x7b, 0x97, 0xd6, 0xdd, 0x54, 0x54, 0x5e, 0x6e,
-  0x26, 0x1e, 0xff, 0x42, 0x36, 0x0a, 0x1f, 0xb6, 0xe2, 0x46, 0x57, 0x1f, 0xb2, 0x67, 0xf4, 0x61,
-  0x76, 0xb6, 0x17, 0x29, 0x00, 0xbe, 0xb3, 0xb6, 0x10, 0x1d, 0xd7, 0xae, 0xe2, 0xd5, 0xa6, 0x5f,
-  0xca, 0x3a, 0x47, 0xf2, 0xce, 0x00, 0x7f, 0x66, 0x29, 0x60, 0xdf, 0x0c, 0x59, 0xcf, 0x06, 0x4c,
-  0x66, 0xe0, 0xc3, 0x77, 0x81, 0x9f, 0xfd, 0x9d, 0xb0, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x85, 0xf2,
-  0xe8, 0xc3, 0xb3, 0xf0, 0x6f, 0xff, 0x67, 0x2d, 0xcc, 0x66, 0x33, 0xbc, 0x7d, 0x57, 0xf1, 0xc7,
-  0x8b, 0xd7, 0x70, 0xb5, 0xb3, 0x07, 0x97, 0xae, 0x7a, 0xf0, 0xd3, 0x9d, 0xbf, 0xc3, 0xb9, 0x24,
-  0x0f, 0x7c, 0x47, 0x9b, 0x97, 0x9b, 0x89, 0xbf, 0x59, 0xfb, 0x19, 0xcc, 0x9e, 0x61, 0xc1, 0x0c,
-  0xeb, 0x78, 0x3c, 0x90, 0x33, 0x1d, 0xe6, 0xf4, 0x19, 0xf0, 0x7a, 0xbd, 0xf8, 0xf2, 0x7f, 0xd9,
-  0x89, 0x5f, 0x9e, 0xfa, 0x38, 0xee, 0xb6, 0x93, 0x77, 0x06, 0x78, 0x5a, 0x0e, 0xb0, 0xd0, 0x26,
-  0xbf, 0x9d, 0x3b, 0xb7, 0xe5, 0xb7, 0x21, 0x43, 0x47, 0x47, 0x07, 0xac, 0x56, 0xab, 0xd0, 0x36,
-  0x25, 0x49, 0x12, 0xda, 0x9e, 0xd1, 0xe4, 0xe5, 0xe5, 0xe1, 0xd5, 0x57, 0x5f, 0xc5, 0xd6, 0xad,
-  0x5b, 0xe1, 0x72, 0xb9, 0xb4, 0xee, 0x0e, 0x91, 0x2a, 0x6a, 0x6a, 0x6a, 0xb0, 0x69, 0xd3, 0xa6,
-  0x31, 0x8f, 0xf1, 0x78, 0x3c, 0x58, 0xb4, 0x68, 0x11, 0xdc, 0x6e, 0xb7, 0x4a, 0xbd, 0x22, 0x4a,
-  0x1e, 0xa9, 0xa9, 0x26, 0xfc, 0x7d, 0xcd, 0x32, 0x48, 0x7e, 0x0f, 0xbc, 0xbd, 0xb7, 0xf1, 0xc7,
-  0x8f, 0x3a, 0x70, 0xa5, 0xa3, 0x07, 0x67, 0x7f, 0xdf, 0x85, 0xff, 0xb9, 0xed, 0x43, 0x74, 0x7b,
-  0x06, 0xb4, 0xee, 0xa2, 0xea, 0xce, 0xb5, 0x77, 0xe1, 0x85, 0x1f, 0xff, 0x1a, 0xff, 0x7d, 0xc3,
-  0xe7, 0xee, 0xce, 0x67, 0x5e, 0xc3, 0x03, 0x9f, 0xf2, 0x43, 0x4a, 0x99, 0x80, 0xbf, 0xaf, 0x59,
-  0x86, 0x2f, 0x94, 0xfc, 0x33, 0x06, 0x06, 0x7c, 0x71, 0xb5, 0x9d, 0xbc, 0x1b, 0x61, 0x78, 0x05,
-  0x95, 0xcb, 0xf0, 0x25, 0x47, 0x6e, 0x0d, 0x89, 0x51, 0x5f, 0x5f, 0x8f, 0xd3, 0xa7, 0x4f, 0x63,
-  0xc5, 0x8a, 0x15, 0x5a, 0x77, 0x85, 0x48, 0x55, 0x2b, 0x57, 0xae, 0x8c, 0x78, 0xcc, 0xf1, 0xe3,
-  0xc7, 0x19, 0xfc, 0x12, 0xc5, 0xe9, 0x6b, 0x4f, 0x3c, 0x88, 0x07, 0x66, 0x99, 0x31, 0x70, 0xe7,
-  0x1a, 0x3e, 0xba, 0xdc, 0x89, 0xab, 0x7f, 0xba, 0x83, 0xcb, 0xd7, 0x3c, 0x78, 0xa9, 0xd1, 0x98,
-  0xc1, 0x6f, 0x50, 0xb7, 0x67, 0x00, 0x2f, 0x35, 0x7e, 0x88, 0xcb, 0xd7, 0x3c, 0xb8, 0xfa, 0xa7,
-  0x3b, 0xf8, 0xe8, 0x72, 0x27, 0x06, 0xee, 0x5c, 0xc3, 0x83, 0xb3, 0xcc, 0x28, 0x79, 0xe2, 0xc1,
-  0xb8, 0xdb, 0x4d, 0xde, 0x19, 0xe0, 0x68, 0x0c, 0xf4, 0x01, 0xd7, 0xaf, 0x85, 0xff, 0xbc, 0x64,
-  0x02, 0x3a, 0x2f, 0xa9, 0xd7, 0x1f, 0xd2, 0xad, 0xb2, 0xb2, 0x32, 0x6c, 0xde, 0xbc, 0x19, 0xb9,
-  0xb9, 0xb9, 0x5a, 0x77, 0x85, 0x48, 0x75, 0x79, 0x79, 0x79, 0x28, 0x28, 0x28, 0x88, 0x78, 0xdc,
-  0x89, 0x13, 0x27, 0x54, 0xe8, 0x0d, 0x51, 0xf2, 0x91, 0x24, 0xa0, 0x6c, 0x55, 0x2e, 0x6e, 0x75,
-  0xf7, 0xc3, 0xd3, 0x33, 0x88, 0xce, 0x3f, 0xf7, 0xa2, 0xbf, 0xdf, 0x87, 0x9f, 0xee, 0xfc, 0x1d,
-  0x6e, 0xdd, 0x36, 0x6e, 0xf0, 0x1b, 0x74, 0xeb, 0xf6, 0x00, 0x7e, 0xba, 0xf3, 0x77, 0xf8, 0xd1,
-  0xf7, 0x1e, 0x41, 0xe7, 0x9f, 0x7b, 0x01, 0x00, 0x96, 0xf1, 0x29, 0x78, 0x66, 0x55, 0x2e, 0x9a,
-  0xf7, 0x5d, 0x88, 0x2b, 0xdb, 0xd5, 0xd8, 0x01, 0x70, 0xdb, 0x7b, 0xc0, 0x0b, 0x4f, 0x86, 0xff,
-  0xbc, 0x24, 0x89, 0x9b, 0x49, 0xa6, 0x84, 0x14, 0x4c, 0x77, 0xe0, 0x8c, 0x2f, 0x19, 0xd9, 0xfa,
-  0xf5, 0xeb, 0x61, 0xb1, 0x58, 0xc6, 0x3c, 0xc6, 0xe3, 0xf1, 0xa0, 0xae, 0xae, 0x4e, 0xa5, 0x1e,
-  0x11, 0x25, 0x97, 0x05, 0x0f, 0x4d, 0xc1, 0xb4, 0xfb, 0xc7, 0xa1, 0xfb, 0xf6, 0x00, 0x3c, 0x77,
-  0x06, 0xd1, 0xdf, 0xef, 0xc5, 0xf1, 0x93, 0xd7, 0x0c, 0x97, 0xf3, 0x3b, 0x96, 0x73, 0xed, 0x5d,
-  0x38, 0x7e, 0xf2, 0x1a, 0x96, 0x3f, 0x3a, 0x03, 0xdd, 0x9e, 0x01, 0xf8, 0xfd, 0xc0, 0xb4, 0xfb,
-  0xc7, 0x21, 0xff, 0xa1, 0x29, 0x68, 0x3d, 0x7b, 0x3d, 0xe6, 0xf6, 0x92, 0x37, 0x05, 0x22, 0x1a,
-  0x83, 0x03, 0x81, 0x59, 0xe0, 0x70, 0xaf, 0xfe, 0x5e, 0x06, 0xc0, 0x06, 0xc6, 0x74, 0x07, 0xa2,
-  0x80, 0xa5, 0x4b, 0x97, 0x46, 0x3c, 0xe6, 0xf8, 0xf1, 0xe3, 0x2a, 0xf4, 0x84, 0x28, 0x39, 0x2d,
-  0x7b, 0x64, 0x1a, 0xd2, 0x52, 0x4d, 0xf0, 0x03, 0x18, 0x18, 0xf0, 0xc1, 0xe7, 0xf7, 0xe3, 0xc0,
-  0xbb, 0x97, 0xb5, 0xee, 0x96, 0xee, 0x1c, 0x38, 0x7a, 0x19, 0x3e, 0xbf, 0x1f, 0xfd, 0xfd, 0x81,
-  0x6b, 0x94, 0x96, 0x6a, 0xc2, 0xb2, 0x47, 0xa6, 0xc5, 0xd5, 0x96, 0xb1, 0x03, 0x60, 0x2e, 0x06,
-  0xa3, 0x10, 0xca, 0xca, 0xca, 0x70, 0xe1, 0xc2, 0x05, 0x54, 0x56, 0x56, 0x46, 0x9c, 0xf5, 0x22,
-  0x4a, 0x76, 0x79, 0x79, 0x79, 0x28, 0x2c, 0x2c, 0x8c, 0x78, 0x1c, 0xd3, 0x1f, 0x88, 0xe2, 0x37,
-  0x2f, 0x37, 0x13, 0x26, 0x93, 0x84, 0x14, 0x73, 0x20, 0x2e, 0xb9, 0xd9, 0xd5, 0x9f, 0xf4, 0xa5,
-  0xce, 0xe2, 0xe1, 0xfe, 0x43, 0x17, 0x6e, 0xdc, 0xec, 0x07, 0x00, 0x98, 0x24, 0x09, 0x12, 0x02,
-  0x25, 0xd3, 0xe2, 0x91, 0xbc, 0x29, 0x10, 0xc9, 0xb2, 0x35, 0x0a, 0xa9, 0x86, 0xe9, 0x0e, 0x44,
-  0xf7, 0x5a, 0xbf, 0x7e, 0x7d, 0xc4, 0x63, 0x98, 0xfe, 0x40, 0x24, 0xcf, 0xd4, 0xac, 0x0c, 0xdc,
-  0xbe, 0xfb, 0x58, 0x7f, 0x60, 0xd0, 0x87, 0xf6, 0x8f, 0xba, 0xb5, 0xee, 0x92, 0x6e, 0x9d, 0xff,
-  0xe3, 0x2d, 0x4c, 0xbb, 0x7f, 0x1c, 0x3c, 0x77, 0x06, 0x60, 0x36, 0x99, 0x70, 0xff, 0x94, 0x8c,
-  0xb8, 0xda, 0x49, 0xde, 0x00, 0x38, 0x1a, 0xac, 0xf0, 0x40, 0x77, 0xd5, 0xd7, 0xd7, 0x47, 0x95,
-  0xe7, 0x48, 0x64, 0x34, 0x4c, 0x7f, 0x20, 0x52, 0x5e, 0x46, 0x86, 0x19, 0x9e, 0x9e, 0x41, 0xf8,
-  0xfc, 0x7e, 0x0c, 0x0e, 0xfa, 0x70, 0xbd, 0xab, 0x4f, 0xeb, 0x2e, 0xe9, 0xd6, 0x27, 0xd7, 0x7b,
-  0xe1, 0xf5, 0xfa, 0x70, 0xa7, 0xd7, 0x0b, 0x93, 0xe4, 0x43, 0x7a, 0xba, 0x39, 0xae, 0x76, 0xf4,
-  0x17, 0x00, 0x97, 0x3d, 0x0f, 0x2c, 0x5c, 0x2e, 0x7f, 0x06, 0x77, 0x7a, 0x4e, 0xe4, 0x63, 0x1e,
-  0x5a, 0x02, 0xfc, 0x78, 0x7f, 0xf8, 0xcf, 0x4b, 0x12, 0x70, 0xe6, 0x28, 0xe0, 0xdc, 0x2a, 0xaf,
-  0x2f, 0xa4, 0x5b, 0xac, 0xee, 0x40, 0x14, 0x5e, 0xb4, 0xe9, 0x0f, 0x6f, 0xbf, 0xfd, 0xb6, 0x0a,
-  0xbd, 0x21, 0x4a, 0x5e, 0x69, 0x69, 0x26, 0x78, 0x7d, 0x77, 0xe3, 0x1e, 0x49, 0x42, 0x37, 0x2b,
-  0x3f, 0x84, 0xd5, 0x3f, 0xe0, 0x85, 0x64, 0x0a, 0xa4, 0x8a, 0xf8, 0xfc, 0x7e, 0xa4, 0xa5, 0xc5,
-  0x97, 0xcd, 0xab, 0xbf, 0x00, 0x78, 0xc9, 0x0a, 0x31, 0x1b, 0x58, 0x44, 0x63, 0xf2, 0xfd, 0xc0,
-  0x7f, 0x7a, 0x7c, 0xec, 0x63, 0xbc, 0x83, 0x0c, 0x80, 0x93, 0x10, 0xd3, 0x1d, 0x88, 0x22, 0x8b,
-  0x36, 0xfd, 0xa1, 0xb1, 0xb1, 0x51, 0x85, 0xde, 0x10, 0x25, 0x37, 0x49, 0x0a, 0x6c, 0xcf, 0x6b,
-  0x92, 0x24, 0x2e, 0x51, 0x1a, 0x93, 0x04, 0x93, 0x14, 0x78, 0xf9, 0x64, 0x4c, 0x96, 0xea, 0x2f,
-  0x00, 0xd6, 0x78, 0xe7, 0xb5, 0x7b, 0xf8, 0xe3, 0xdb, 0x61, 0x84, 0xf4, 0x8b, 0xe9, 0x0e, 0x44,
-  0xd1, 0x89, 0x26, 0xfd, 0x61, 0xff, 0xfe, 0x31, 0x9e, 0xa2, 0x11, 0x51, 0xd4, 0x24, 0x04, 0x76,
-  0x6a, 0x95, 0x24, 0xff, 0xdd, 0x8f, 0x28, 0x12, 0x39, 0x57, 0x49, 0xbd, 0x00, 0x58, 0x32, 0x01,
-  0xd3, 0x1f, 0x00, 0x52, 0x52, 0xc7, 0x4e, 0x6f, 0x98, 0x90, 0xa5, 0x5a, 0x97, 0xe0, 0x1d, 0x04,
-  0x2e, 0xbb, 0x03, 0xe5, 0xd0, 0x42, 0x91, 0x24, 0xe0, 0xf2, 0x79, 0xf5, 0xfa, 0x43, 0x8a, 0x62,
-  0xba, 0x03, 0x51, 0xf4, 0xa2, 0x4d, 0x7f, 0x38, 0x76, 0xec, 0x98, 0x0a, 0xbd, 0x21, 0x22, 0x12,
-  0x4b, 0xbd, 0x00, 0x38, 0x73, 0x2a, 0xf0, 0xda, 0x07, 0xc0, 0xc4, 0xac, 0xb1, 0x03, 0x60, 0x53,
-  0x7c, 0xc9, 0xcc, 0x71, 0x69, 0x7b, 0x0f, 0xa8, 0x2a, 0xe6, 0x2c, 0x6f, 0x92, 0x63, 0xba, 0x03,
-  0x51, 0xec, 0x98, 0xfe, 0x40, 0x44, 0xc9, 0x4c, 0xbd, 0x00, 0xd8, 0x6c, 0x06, 0xd2, 0xc7, 0x05,
-  0x66, 0x82, 0xf5, 0x32, 0xb3, 0xdf, 0x7f, 0x87, 0xc1, 0x6f, 0x92, 0x63, 0xba, 0x03, 0xe9, 0x85,
-  0xcd, 0x66, 0xc3, 0xea, 0xd5, 0xab, 0x65, 0xb7, 0xd3, 0xd5, 0xd5, 0x85, 0xaa, 0xaa, 0x2a, 0x01,
-  0x3d, 0x1a, 0x5b, 0x71, 0x71, 0x71, 0xc4, 0x63, 0x98, 0xfe, 0x40, 0x44, 0x89, 0x4a, 0xbd, 0x00,
-  0xd8, 0xef, 0x07, 0xbc, 0x3a, 0x2b, 0x3b, 0x26, 0x19, 0x7b, 0x1f, 0x90, 0x58, 0xd5, 0xd4, 0xd4,
-  0x60, 0xc1, 0x82, 0x05, 0x28, 0x29, 0x29, 0x19, 0xf1, 0xef, 0x1e, 0x8f, 0x07, 0x4e, 0xa7, 0x13,
-  0x67, 0xce, 0x9c, 0x51, 0x64, 0x36, 0xe8, 0xe0, 0xc1, 0x83, 0x51, 0xcf, 0xde, 0x4a, 0x77, 0x57,
-  0x0e, 0xb4, 0xb6, 0xb6, 0x22, 0x3f, 0x3f, 0x5f, 0x78, 0x5f, 0x86, 0x3b, 0x72, 0xe4, 0x48, 0x54,
-  0xc7, 0x15, 0x15, 0x15, 0xc1, 0xe5, 0x72, 0x8d, 0x79, 0x4c, 0x30, 0x38, 0x9a, 0x3f, 0x7f, 0x7e,
-  0x54, 0x8f, 0x9d, 0x95, 0xd4, 0xd0, 0xd0, 0x10, 0x36, 0xc0, 0x8a, 0xe5, 0xff, 0x22, 0x1c, 0x29,
-  0xce, 0xd5, 0x1d, 0xc9, 0x70, 0xee, 0xe6, 0xe6, 0x66, 0x58, 0xad, 0x56, 0x59, 0xed, 0x00, 0xc0,
-  0xf6, 0xed, 0xdb, 0xe1, 0x76, 0xbb, 0x65, 0xb7, 0x13, 0x4e, 0x5e, 0x5e, 0x5e, 0x54, 0xbf, 0x3f,
-  0xc7, 0x8e, 0x1d, 0xd3, 0xf4, 0xff, 0x05, 0x08, 0xbc, 0x2f, 0xe5, 0xe4, 0xe4, 0xa0, 0xac, 0xac,
-  0x4c, 0xf5, 0x1b, 0x5d, 0xbd, 0xfe, 0xae, 0x44, 0x2b, 0x78, 0xed, 0x00, 0x8c, 0x79, 0xfd, 0x3a,
-  0x3b, 0x3b, 0xff, 0x52, 0xe9, 0xe3, 0xf0, 0xe1, 0xc3, 0x70, 0x3a, 0x9d, 0x8a, 0xf6, 0x2b, 0x9c,
-  0x44, 0x1a, 0x83, 0x48, 0xff, 0xf4, 0xb7, 0x08, 0x8e, 0x74, 0xa7, 0xa2, 0xa2, 0x02, 0xb5, 0xb5,
-  0xb5, 0x61, 0x07, 0x6e, 0x8b, 0xc5, 0x82, 0xf2, 0xf2, 0x72, 0x00, 0xc0, 0xb7, 0xbe, 0xf5, 0x2d,
-  0x3c, 0xf7, 0xdc, 0x73, 0x11, 0x03, 0x3e, 0x0a, 0x28, 0x2b, 0x2b, 0xc3, 0x0b, 0x2f, 0xbc, 0xa0,
-  0x78, 0xb0, 0x4e, 0xfa, 0x70, 0xec, 0xd8, 0xb1, 0x7b, 0x06, 0xef, 0x78, 0xac, 0x5f, 0xbf, 0x5e,
-  0xd1, 0x59, 0xe0, 0xe7, 0x9f, 0x7f, 0x3e, 0xe2, 0x31, 0x9d, 0x9d, 0x9d, 0x68, 0x6c, 0x6c, 0xc4,
-  0xaa, 0x55, 0xab, 0x14, 0xeb, 0xc7, 0x58, 0xea, 0xeb, 0xeb, 0xb1, 0x66, 0xcd, 0x1a, 0x21, 0x37,
-  0x14, 0x46, 0x52, 0x5f, 0x5f, 0x8f, 0xa5, 0x4b, 0x97, 0xc6, 0x74, 0xa3, 0x6d, 0xb5, 0x5a, 0xff,
-  0xf2, 0x1e, 0x5f, 0x5e, 0x5e, 0x8e, 0xe6, 0xe6, 0x66, 0x1c, 0x3a, 0x74, 0x08, 0x27, 0x4e, 0x9c,
-  0x50, 0x65, 0x03, 0x14, 0x8e, 0x41, 0xa4, 0x04, 0x4e, 0x81, 0xd2, 0x98, 0x1c, 0x0e, 0x07, 0xb6,
-  0x6d, 0xdb, 0x16, 0xf5, 0x20, 0x93, 0x9f, 0x9f, 0x8f, 0x7d, 0xfb, 0xf6, 0xa1, 0xac, 0xac, 0x4c,
-  0xe1, 0x9e, 0x25, 0xbe, 0x3d, 0x7b, 0xf6, 0xa0, 0xb9, 0xb9, 0x99, 0xc1, 0xaf, 0x81, 0xbc, 0xf5,
-  0xd6, 0x5b, 0x42, 0xda, 0x89, 0x26, 0x3d, 0x41, 0x8e, 0xc5, 0x8b, 0x17, 0x47, 0x3c, 0x46, 0xcb,
-  0xc5, 0x6f, 0x27, 0x4e, 0x9c, 0x40, 0x65, 0x65, 0x25, 0x83, 0xdf, 0x18, 0x38, 0x1c, 0x0e, 0xf8,
-  0xfd, 0x7e, 0x54, 0x56, 0x56, 0x0a, 0x79, 0xca, 0xb4, 0x62, 0xc5, 0x0a, 0x6c, 0xda, 0xb4, 0x09,
-  0x1d, 0x1d, 0x1d, 0x70, 0x38, 0x1c, 0x02, 0x7a, 0x18, 0x1a, 0xc7, 0x20, 0x52, 0x8a, 0xfe, 0x66,
-  0x80, 0xcf, 0xfe, 0x0a, 0xb8, 0xd2, 0x3e, 0xf6, 0x31, 0x8b, 0xbf, 0x08, 0x4c, 0xba, 0x4f, 0x9d,
-  0xfe, 0x18, 0x98, 0xc3, 0xe1, 0xf8, 0xcb, 0x5d, 0x75, 0x2c, 0x2c, 0x16, 0x0b, 0x5e, 0x79, 0xe5,
-  0x15, 0x9c, 0x3e, 0x7d, 0x5a, 0xd1, 0xc7, 0xb4, 0x89, 0x6c, 0xcf, 0x9e, 0x3d, 0x42, 0x66, 0x02,
-  0x29, 0xb1, 0x38, 0x9d, 0x4e, 0x21, 0x95, 0x48, 0xf2, 0xf3, 0xf3, 0x91, 0x97, 0x97, 0xa7, 0xc8,
-  0xef, 0x57, 0xb4, 0xe9, 0x0f, 0xa2, 0x82, 0xf9, 0x58, 0xe4, 0xe5, 0xe5, 0xe1, 0xc0, 0x81, 0x03,
-  0xac, 0xe4, 0x12, 0x03, 0xa5, 0xd7, 0x41, 0x04, 0x67, 0x87, 0x57, 0xad, 0x5a, 0x85, 0x6d, 0xdb,
-  0xb6, 0x09, 0x9d, 0x11, 0xe6, 0x18, 0x74, 0x57, 0x95, 0x03, 0x78, 0x32, 0x86, 0xeb, 0x70, 0xa1,
-  0x0d, 0xb0, 0x17, 0x28, 0xd7, 0x9f, 0x24, 0xa1, 0xbf, 0x00, 0xf8, 0xff, 0xbe, 0x0a, 0x1c, 0xd9,
-  0x35, 0xf6, 0x31, 0xf5, 0x87, 0x81, 0x45, 0x45, 0xea, 0xf4, 0xc7, 0xa0, 0x6a, 0x6a, 0x6a, 0xe2,
-  0x7a, 0xe3, 0x09, 0xb2, 0x5a, 0xad, 0xd8, 0xbb, 0x77, 0x2f, 0x0a, 0x0a, 0xf8, 0x4b, 0x38, 0x5a,
-  0x45, 0x45, 0x05, 0x83, 0x5f, 0x03, 0x3b, 0x7a, 0xf4, 0xa8, 0x90, 0x00, 0xee, 0xf9, 0xe7, 0x9f,
-  0x87, 0xdd, 0x6e, 0x17, 0xd0, 0xa3, 0x7b, 0xdb, 0x8d, 0xa4, 0xb3, 0xb3, 0x53, 0x93, 0x3c, 0x50,
-  0x06, 0xbf, 0xd1, 0xb3, 0xd9, 0x6c, 0xd8, 0xb1, 0x63, 0x87, 0x6a, 0xd7, 0xcb, 0x6a, 0xb5, 0x62,
-  0xd3, 0xa6, 0x4d, 0x58, 0xb9, 0x72, 0x25, 0xd6, 0xae, 0x5d, 0x2b, 0x3b, 0xf0, 0xe4, 0x18, 0x44,
-  0x4a, 0xd3, 0x5f, 0x0a, 0x44, 0x5a, 0x7a, 0xe4, 0x63, 0x44, 0x95, 0x4a, 0x93, 0xbb, 0xdd, 0x72,
-  0x12, 0xdb, 0xb0, 0x61, 0x83, 0xec, 0x36, 0xf2, 0xf3, 0xf3, 0xb1, 0x67, 0xcf, 0x1e, 0x01, 0xbd,
-  0x49, 0x2e, 0x8f, 0x3d, 0xf6, 0x98, 0xd6, 0x5d, 0x20, 0x0d, 0xed, 0xda, 0x15, 0xe1, 0x06, 0x3f,
-  0x4a, 0xcb, 0x97, 0x2f, 0x17, 0xd2, 0xce, 0x68, 0x7a, 0x4d, 0x7f, 0xd8, 0xb3, 0x67, 0x0f, 0x83,
-  0xdf, 0x28, 0xd5, 0xd4, 0xd4, 0xe0, 0xc8, 0x91, 0x23, 0x9a, 0x5c, 0xaf, 0xc2, 0xc2, 0x42, 0xbc,
-  0xf7, 0xde, 0x7b, 0xa8, 0xa8, 0xa8, 0x90, 0xd5, 0x0e, 0xc7, 0xa0, 0x61, 0xea, 0xed, 0xc0, 0x72,
-  0x69, 0xe8, 0xf5, 0xc1, 0xa1, 0x91, 0x9f, 0xbf, 0xd1, 0x39, 0xf2, 0xf3, 0x9c, 0xfd, 0x8d, 0x8a,
-  0xfe, 0x02, 0x60, 0x35, 0x99, 0x4c, 0x77, 0xf7, 0x1e, 0x94, 0xf9, 0x4a, 0x32, 0x35, 0x35, 0x35,
-  0xc2, 0x72, 0xeb, 0x4a, 0x4a, 0x4a, 0x50, 0x53, 0x53, 0x23, 0xa4, 0xad, 0x64, 0x31, 0x69, 0xd2,
-  0x24, 0xad, 0xbb, 0x40, 0x1a, 0x72, 0xb9, 0x5c, 0x68, 0x6f, 0x8f, 0x90, 0xe6, 0x15, 0x85, 0xdc,
-  0xdc, 0x5c, 0xd8, 0x6c, 0x62, 0xb7, 0x8d, 0xd7, 0x6b, 0xfa, 0x43, 0x59, 0x59, 0x19, 0x9f, 0x9a,
-  0x44, 0xc9, 0xe1, 0x70, 0x60, 0xd3, 0xa6, 0x4d, 0x9a, 0xf6, 0xc1, 0x6a, 0xb5, 0x62, 0xdb, 0xb6,
-  0x6d, 0x71, 0xbf, 0xf7, 0x73, 0x0c, 0x12, 0xac, 0xca, 0x01, 0x1c, 0xb8, 0x0d, 0x1c, 0xf5, 0x07,
-  0x5e, 0x8e, 0x56, 0x60, 0x4d, 0x98, 0x6b, 0x52, 0x60, 0x03, 0x6a, 0xf7, 0x0c, 0x1d, 0x3b, 0xfc,
-  0xe5, 0x68, 0x8d, 0xae, 0xfd, 0xe1, 0xaf, 0xe1, 0x86, 0xff, 0x7b, 0xd5, 0xb0, 0xbc, 0xf1, 0x2f,
-  0x94, 0x01, 0x6f, 0x5e, 0x08, 0xfd, 0xf5, 0x47, 0xfd, 0xc0, 0x5b, 0x1d, 0x62, 0xae, 0xc3, 0x28,
-  0xfa, 0x4b, 0x81, 0x50, 0xd3, 0x82, 0xcf, 0x03, 0x3b, 0xce, 0xc8, 0x6b, 0x43, 0x92, 0x80, 0xae,
-  0x4f, 0x80, 0x1f, 0x7c, 0x15, 0xe8, 0xb9, 0x25, 0xa6, 0x5f, 0x1a, 0x5b, 0xb0, 0x60, 0x81, 0xd0,
-  0xf6, 0x36, 0x6d, 0xda, 0x84, 0xf3, 0xe7, 0xcf, 0x6b, 0x56, 0x3a, 0x87, 0x48, 0x6f, 0x44, 0xa5,
-  0x41, 0xac, 0x5e, 0xbd, 0x5a, 0xe8, 0x6a, 0x77, 0xbd, 0xa6, 0x3f, 0xbc, 0xf0, 0xc2, 0x0b, 0xaa,
-  0x9e, 0x2f, 0x51, 0x89, 0x28, 0xbd, 0x26, 0xd2, 0xa6, 0x4d, 0x9b, 0x30, 0x79, 0xf2, 0xe4, 0x98,
-  0x2b, 0x96, 0x70, 0x0c, 0x12, 0xa4, 0xc0, 0x06, 0xfc, 0xb0, 0x19, 0xc8, 0x1a, 0x75, 0x33, 0x31,
-  0x27, 0x3f, 0xf0, 0x5a, 0xb0, 0x0c, 0xa8, 0x5e, 0x39, 0xf4, 0xef, 0x4f, 0x55, 0x00, 0xff, 0x75,
-  0x0b, 0x90, 0x11, 0x65, 0xbe, 0x78, 0x81, 0x0d, 0x78, 0x7e, 0x07, 0x30, 0x53, 0xe6, 0x7b, 0xd9,
-  0xc3, 0xc5, 0xf2, 0xdb, 0x88, 0x83, 0xb1, 0x03, 0xe0, 0x0c, 0x0b, 0x30, 0x47, 0xc0, 0xa3, 0x82,
-  0x9e, 0x6e, 0x20, 0x35, 0x4d, 0x7e, 0x3b, 0x3a, 0xa1, 0xc4, 0x0c, 0x65, 0x52, 0x2d, 0x48, 0x20,
-  0x92, 0x69, 0xd7, 0xae, 0x5d, 0xb2, 0xf2, 0x1b, 0x83, 0x44, 0xa7, 0x41, 0x44, 0x93, 0xfe, 0x10,
-  0xac, 0x07, 0xab, 0x96, 0x8a, 0x8a, 0x0a, 0x56, 0x4a, 0x89, 0x82, 0xde, 0x82, 0xdf, 0xa0, 0xca,
-  0xca, 0x4a, 0x00, 0x88, 0x29, 0x08, 0xe6, 0x18, 0x24, 0xc8, 0xf3, 0x3b, 0x86, 0x82, 0xdf, 0x2b,
-  0xed, 0xc0, 0xd7, 0xe7, 0x04, 0x66, 0x5b, 0xab, 0x1d, 0x81, 0xf8, 0x67, 0xc9, 0x8a, 0xc0, 0x6c,
-  0xef, 0xa6, 0xd2, 0x40, 0x30, 0x3b, 0x3c, 0xf8, 0xfd, 0xe0, 0xd0, 0xc8, 0xe0, 0x38, 0x5c, 0xfb,
-  0xc1, 0xc0, 0xf5, 0x4a, 0x3b, 0xf0, 0xbd, 0xc7, 0x81, 0x2b, 0x02, 0xae, 0xef, 0x72, 0x75, 0x9e,
-  0xac, 0x1b, 0x3b, 0x05, 0x42, 0x94, 0xfe, 0xde, 0xa4, 0xca, 0x27, 0x9e, 0x31, 0x63, 0x86, 0xf0,
-  0x36, 0xad, 0x56, 0x2b, 0x76, 0xee, 0xdc, 0x29, 0xbc, 0xdd, 0x70, 0x0a, 0x0a, 0x0a, 0x20, 0x49,
-  0x52, 0xc8, 0x57, 0x6d, 0x6d, 0x2d, 0x3c, 0x1e, 0x8f, 0xec, 0x73, 0xb4, 0xb7, 0xb7, 0xa3, 0xa8,
-  0xa8, 0x28, 0xec, 0x79, 0x82, 0x2f, 0x25, 0xea, 0x51, 0xb6, 0xb4, 0xb4, 0x60, 0xde, 0xbc, 0x79,
-  0x11, 0xcf, 0x1d, 0xcf, 0x4b, 0x8d, 0x5d, 0xc6, 0x8c, 0xce, 0xe5, 0x72, 0xa1, 0xad, 0xad, 0x4d,
-  0x76, 0x3b, 0xb9, 0xb9, 0xb9, 0xc2, 0xca, 0x3d, 0xd9, 0x6c, 0xb6, 0xa8, 0x02, 0xcd, 0xc3, 0x87,
-  0x0f, 0x0b, 0x39, 0x5f, 0xb4, 0x44, 0xd5, 0x19, 0x6e, 0x68, 0x68, 0x48, 0xda, 0xdf, 0x15, 0x87,
-  0xc3, 0x21, 0x3b, 0xf8, 0xed, 0xec, 0xec, 0x44, 0x53, 0x53, 0xd3, 0x88, 0xef, 0xaf, 0xa8, 0xa8,
-  0x08, 0x4d, 0x4d, 0x4d, 0xb2, 0xfb, 0x57, 0x59, 0x59, 0x19, 0x53, 0x1a, 0x42, 0x32, 0x8c, 0x41,
-  0x9a, 0xfb, 0x76, 0xfd, 0xc8, 0x59, 0xd5, 0x03, 0xaf, 0x07, 0xfe, 0x7c, 0xd7, 0x09, 0x9c, 0x1f,
-  0x96, 0xca, 0xb0, 0xbc, 0x04, 0x98, 0x99, 0x07, 0xac, 0x7e, 0x7e, 0xe4, 0xcc, 0x6f, 0xf0, 0xf8,
-  0x68, 0xdb, 0x3f, 0x7d, 0x54, 0x4c, 0xf0, 0xab, 0x22, 0x06, 0xc0, 0xa4, 0x9a, 0xc2, 0xc2, 0x42,
-  0x5d, 0x2c, 0x48, 0xa8, 0xab, 0xab, 0x13, 0xb2, 0x85, 0xeb, 0x8b, 0x2f, 0xbe, 0xa8, 0x59, 0xb1,
-  0x75, 0x11, 0xab, 0xac, 0x49, 0x5b, 0x27, 0x4f, 0x9e, 0x14, 0xd2, 0xce, 0xd3, 0x4f, 0x3f, 0x2d,
-  0xa4, 0x9d, 0x68, 0xb6, 0x69, 0x6e, 0x6f, 0x6f, 0x57, 0xfd, 0x31, 0xf2, 0xe7, 0x3f, 0xff, 0x79,
-  0xd9, 0x6d, 0x1c, 0x3a, 0x74, 0x48, 0x37, 0xc1, 0xaa, 0x68, 0x72, 0xab, 0x25, 0x00, 0x81, 0x1b,
-  0xea, 0x69, 0xd3, 0xa6, 0xdd, 0x53, 0x55, 0xc4, 0xe5, 0x72, 0xc1, 0x6e, 0xb7, 0xa3, 0xa8, 0xa8,
-  0x48, 0x76, 0xde, 0x7a, 0x75, 0x75, 0xb5, 0xe6, 0xb5, 0x79, 0xf5, 0x32, 0x06, 0xa9, 0xe2, 0x33,
-  0x4b, 0x47, 0x7e, 0x7c, 0xeb, 0xfa, 0xd0, 0xdf, 0x2f, 0x9e, 0x1d, 0xf9, 0xb9, 0xa7, 0xd6, 0x03,
-  0xf9, 0xa3, 0x7e, 0xcf, 0xde, 0x75, 0x06, 0x82, 0xdc, 0xd1, 0xf9, 0xb8, 0x5b, 0x0e, 0x86, 0x6e,
-  0xff, 0xfc, 0x99, 0xc0, 0x2c, 0x72, 0xa8, 0xbc, 0xe1, 0x82, 0x18, 0xd7, 0x2a, 0xa8, 0x94, 0x03,
-  0xac, 0x5e, 0x00, 0x2c, 0x49, 0xc0, 0xf8, 0x89, 0x91, 0x8f, 0x4b, 0x89, 0x22, 0x95, 0x20, 0xda,
-  0xfc, 0x14, 0xb5, 0x58, 0x26, 0x25, 0xe5, 0x62, 0x38, 0x25, 0xe8, 0x65, 0x41, 0xc2, 0xad, 0x5b,
-  0xf2, 0xf3, 0xb5, 0x3b, 0x3b, 0x3b, 0x05, 0xf4, 0x24, 0x3e, 0x0c, 0x7e, 0xd5, 0xb5, 0x72, 0xe5,
-  0x4a, 0xd9, 0xb3, 0x85, 0xa3, 0x6d, 0xdd, 0xba, 0x55, 0x48, 0xdf, 0x44, 0x55, 0x15, 0x89, 0x26,
-  0x9d, 0xe2, 0xe8, 0xd1, 0xa3, 0xf7, 0xfc, 0x9b, 0x12, 0xd7, 0x26, 0x48, 0xd4, 0xf6, 0xc6, 0xbf,
-  0xfd, 0xed, 0x6f, 0x65, 0xb7, 0x11, 0x2b, 0x25, 0xaf, 0x4b, 0x90, 0xcd, 0x66, 0x43, 0x75, 0x75,
-  0xb5, 0xac, 0x7e, 0xb6, 0xb7, 0xb7, 0x63, 0xd9, 0xb2, 0x65, 0x63, 0x1e, 0xe3, 0x72, 0xb9, 0xf0,
-  0xf8, 0xe3, 0x8f, 0xcb, 0x7a, 0xcf, 0x0b, 0xd6, 0xe6, 0xd5, 0x9a, 0x5e, 0xc6, 0x20, 0xc5, 0x8d,
-  0x9f, 0x30, 0xf2, 0xe3, 0xd1, 0x41, 0xef, 0x70, 0x96, 0xcc, 0x91, 0x71, 0xd5, 0x8d, 0x31, 0xfe,
-  0x9f, 0x97, 0xac, 0x08, 0xe4, 0x0a, 0x47, 0xdb, 0xfe, 0x9c, 0x7c, 0xa0, 0x38, 0xf2, 0xcd, 0xb5,
-  0x16, 0xd4, 0xcb, 0x01, 0xee, 0xe9, 0x06, 0x9a, 0xb7, 0x00, 0xe9, 0xe3, 0x01, 0x84, 0x4b, 0x17,
-  0x90, 0x00, 0xf7, 0xa9, 0xc8, 0x6d, 0xed, 0x6f, 0x0a, 0x6c, 0x98, 0xe1, 0xf7, 0x89, 0xec, 0x61,
-  0x9c, 0x24, 0xc0, 0xd3, 0x05, 0xf4, 0xca, 0x7f, 0xa4, 0x6e, 0x14, 0xd5, 0xd5, 0xd5, 0xc6, 0x5c,
-  0x90, 0x40, 0x34, 0x8c, 0xdb, 0xed, 0x46, 0x4b, 0x4b, 0x8b, 0xec, 0x5d, 0xb9, 0xac, 0x56, 0x2b,
-  0x2a, 0x2a, 0x2a, 0xd0, 0xd8, 0xd8, 0x18, 0x77, 0x1b, 0x36, 0x9b, 0x2d, 0xaa, 0x45, 0x79, 0x6a,
-  0xa7, 0x3f, 0x88, 0xda, 0xf1, 0x2e, 0x33, 0x33, 0x53, 0x48, 0x3b, 0x7a, 0xf3, 0xf2, 0xcb, 0x2f,
-  0xcb, 0xbe, 0x41, 0x58, 0xb7, 0x6e, 0x5d, 0x54, 0xc7, 0xb9, 0xdd, 0x6e, 0xbc, 0xf1, 0xc6, 0x1b,
-  0x7f, 0xc9, 0xe9, 0x8d, 0x87, 0xd5, 0x6a, 0xc5, 0x9e, 0x3d, 0x7b, 0x50, 0x5a, 0x5a, 0x1a, 0x77,
-  0x1b, 0x22, 0x18, 0x62, 0x0c, 0xea, 0xb9, 0x3d, 0xf2, 0xe3, 0x9c, 0xf9, 0x40, 0x6b, 0x98, 0x27,
-  0x96, 0xc1, 0x18, 0x26, 0x18, 0x04, 0x07, 0xf3, 0x86, 0x5f, 0xab, 0x0a, 0xbc, 0xd6, 0xd4, 0x00,
-  0xe5, 0xa3, 0x2a, 0x8b, 0x84, 0x6a, 0x7f, 0x5f, 0x63, 0x20, 0x7f, 0x77, 0x66, 0x1e, 0xf0, 0xe6,
-  0xb9, 0xf8, 0xfb, 0xae, 0x52, 0x0e, 0xb0, 0x7a, 0x01, 0xf0, 0x9d, 0xdb, 0xc0, 0x3f, 0x7e, 0x5f,
-  0x4c, 0x5b, 0x6f, 0x6f, 0x17, 0xd3, 0x0e, 0x69, 0x22, 0xe9, 0x76, 0xe9, 0x21, 0x8a, 0xd3, 0xfb,
-  0xef, 0xbf, 0x2f, 0x64, 0x5b, 0xda, 0xc7, 0x1e, 0x7b, 0x4c, 0x56, 0x00, 0xac, 0xd7, 0xf4, 0x07,
-  0x51, 0x8b, 0xa1, 0x94, 0xaa, 0x99, 0xac, 0xa5, 0xfa, 0xfa, 0x7a, 0xd9, 0x8b, 0x03, 0x0f, 0x1d,
-  0x3a, 0x14, 0x53, 0x1a, 0x57, 0x55, 0x55, 0x15, 0xd6, 0xac, 0x59, 0x23, 0xab, 0x44, 0x59, 0x49,
-  0x49, 0x09, 0xca, 0xca, 0xca, 0x34, 0x0d, 0x3e, 0x0d, 0x31, 0x06, 0xfd, 0xee, 0x7d, 0x60, 0xc1,
-  0xb0, 0xf7, 0x96, 0x49, 0x53, 0x86, 0xfe, 0x9e, 0x33, 0x7f, 0xe4, 0xb1, 0xfb, 0xb6, 0x03, 0x0f,
-  0x7e, 0x36, 0x30, 0xbb, 0x1b, 0x34, 0x33, 0x6f, 0x28, 0xa7, 0x77, 0x78, 0xfa, 0x44, 0x34, 0xed,
-  0x27, 0x48, 0x2e, 0x30, 0x73, 0x80, 0x49, 0x13, 0x86, 0x5b, 0x90, 0x40, 0x14, 0xc2, 0xf6, 0xed,
-  0xdb, 0x85, 0x2c, 0xc8, 0x7c, 0xe2, 0x89, 0x27, 0x64, 0x7d, 0x7d, 0xbc, 0xe9, 0x0f, 0x4a, 0x13,
-  0x15, 0x00, 0xe7, 0xe6, 0xe6, 0xe2, 0xc4, 0x89, 0x13, 0x42, 0xda, 0xd2, 0x8b, 0x35, 0x6b, 0xd6,
-  0xc8, 0x6e, 0x23, 0x9e, 0x8a, 0x1e, 0x22, 0xaa, 0x80, 0xe8, 0xa1, 0xac, 0x5d, 0xd2, 0x8f, 0x41,
-  0xaf, 0x55, 0x05, 0x2a, 0x33, 0x04, 0x3d, 0xfe, 0xcd, 0xc0, 0x9f, 0x5f, 0x28, 0x03, 0xe6, 0x0e,
-  0xab, 0x7e, 0x75, 0x74, 0x6f, 0x20, 0x60, 0xdd, 0xb5, 0x75, 0xe4, 0x93, 0x6c, 0xfb, 0x8f, 0xe2,
-  0x6b, 0x3f, 0x81, 0x30, 0x00, 0x26, 0xcd, 0x18, 0x6a, 0x41, 0x02, 0x51, 0x08, 0x6e, 0xb7, 0x1b,
-  0xad, 0xad, 0x61, 0x8a, 0xcb, 0xc7, 0xc0, 0x62, 0xb1, 0xc4, 0xbd, 0xf3, 0x56, 0xb4, 0xe9, 0x0f,
-  0xa2, 0x76, 0xb0, 0xd3, 0x4a, 0x61, 0x61, 0x21, 0x2e, 0x5c, 0xb8, 0xa0, 0xf9, 0x42, 0x2c, 0x11,
-  0xea, 0xeb, 0xeb, 0x65, 0x6f, 0x14, 0xe1, 0xf1, 0x78, 0xe2, 0x7a, 0x6a, 0x20, 0x22, 0x0d, 0x26,
-  0x3f, 0x3f, 0x5f, 0xf6, 0x4e, 0x71, 0x22, 0x24, 0xfd, 0x18, 0xb4, 0x75, 0xdd, 0x50, 0x3e, 0xef,
-  0xcc, 0xdc, 0xc0, 0x82, 0xb2, 0x1f, 0x36, 0x0f, 0xa5, 0x3a, 0xfc, 0xa6, 0x25, 0x50, 0x02, 0x0d,
-  0x08, 0xa4, 0x47, 0xfc, 0xc3, 0xb0, 0x7c, 0xf2, 0xe5, 0x25, 0x43, 0x8b, 0xd0, 0x9e, 0xdb, 0x16,
-  0x7d, 0xfb, 0xa1, 0x36, 0xc0, 0x08, 0xe5, 0xc9, 0xf2, 0x7b, 0x37, 0xc4, 0x08, 0xe2, 0x46, 0x18,
-  0x63, 0xf8, 0x9b, 0x57, 0x80, 0xcf, 0x16, 0xca, 0x2b, 0x3d, 0x26, 0x49, 0x40, 0xdb, 0x7b, 0xc0,
-  0xff, 0x8e, 0x3f, 0x9f, 0x89, 0xe4, 0x0b, 0x2e, 0x48, 0xa8, 0xab, 0xab, 0xd3, 0xba, 0x2b, 0x44,
-  0x61, 0xd5, 0xd4, 0xd4, 0x20, 0x27, 0x27, 0x47, 0x56, 0x1b, 0xa3, 0x57, 0xd8, 0x07, 0x1d, 0x3c,
-  0x78, 0x50, 0x48, 0x1a, 0xc4, 0xaa, 0x55, 0xab, 0xe2, 0x0a, 0x68, 0xa2, 0x4d, 0x7f, 0x08, 0xf7,
-  0xa8, 0x5c, 0xc9, 0x6b, 0x23, 0x5a, 0x6e, 0x6e, 0x2e, 0x9a, 0x9b, 0x9b, 0xb1, 0x78, 0xf1, 0x62,
-  0xc5, 0xab, 0x42, 0x28, 0x79, 0x5d, 0x44, 0xcc, 0xfe, 0xc6, 0x7b, 0xe3, 0xe5, 0x74, 0x3a, 0xe1,
-  0x70, 0x38, 0x64, 0xe7, 0x1e, 0xaf, 0x5e, 0xbd, 0x5a, 0x56, 0xda, 0x8e, 0x28, 0x49, 0x3d, 0x06,
-  0xb5, 0xba, 0x80, 0xa7, 0xa7, 0x05, 0x82, 0xcc, 0xe2, 0xb2, 0xa1, 0xc0, 0xf7, 0x4a, 0x3b, 0xf0,
-  0xde, 0xbf, 0x06, 0x66, 0x71, 0x87, 0xdb, 0xd7, 0x18, 0x58, 0xcc, 0xf6, 0xe5, 0x6f, 0x07, 0x02,
-  0xe0, 0x78, 0xdb, 0x0f, 0xe7, 0xe7, 0x4d, 0x81, 0xc0, 0x77, 0xb4, 0x53, 0x87, 0x81, 0x45, 0xcb,
-  0x55, 0xdf, 0x0c, 0x23, 0x31, 0x03, 0xe0, 0x87, 0x96, 0x00, 0xf3, 0x1e, 0x91, 0xdf, 0x4e, 0x4f,
-  0xb7, 0xfc, 0x36, 0x48, 0xb6, 0xea, 0xea, 0x6a, 0x9c, 0x38, 0x71, 0x42, 0xb3, 0x92, 0x62, 0x44,
-  0x91, 0x2c, 0x5b, 0xb6, 0x4c, 0x76, 0x9d, 0xd5, 0x70, 0xc1, 0xcc, 0xee, 0xdd, 0xbb, 0x51, 0x5d,
-  0x5d, 0x2d, 0x3b, 0xa0, 0x88, 0xb7, 0x5c, 0x98, 0xdc, 0xf4, 0x07, 0x25, 0xaf, 0x8d, 0x52, 0x2a,
-  0x2b, 0x2b, 0xb1, 0x74, 0xe9, 0xd2, 0x88, 0xd5, 0x0f, 0xe4, 0x50, 0xea, 0xba, 0x54, 0x54, 0x54,
-  0x08, 0xd9, 0x26, 0xf8, 0xec, 0xd9, 0x31, 0xaa, 0x02, 0x44, 0xd0, 0xda, 0xda, 0x2a, 0xfb, 0xa6,
-  0xad, 0xb0, 0xb0, 0x10, 0x79, 0x79, 0x79, 0xba, 0xc8, 0xc1, 0x4d, 0xb8, 0x31, 0x28, 0xd2, 0x06,
-  0x15, 0xa3, 0xd5, 0xdb, 0x03, 0xaf, 0x68, 0xb4, 0xba, 0x02, 0xaf, 0xe1, 0x6b, 0xde, 0x9e, 0xaa,
-  0x08, 0x3f, 0x0b, 0x1c, 0xae, 0xfd, 0x50, 0xb3, 0xc0, 0x63, 0xf5, 0xe3, 0x5d, 0xf5, 0x73, 0xc2,
-  0x13, 0x33, 0x05, 0xa2, 0xbf, 0x57, 0x4c, 0x3b, 0x03, 0x7d, 0x62, 0xda, 0x21, 0x59, 0x2c, 0x16,
-  0x0b, 0x9a, 0x9b, 0x9b, 0x91, 0x97, 0x97, 0xa7, 0x75, 0x57, 0x88, 0x54, 0xe7, 0x76, 0xbb, 0x71,
-  0xfc, 0xf8, 0x71, 0xd9, 0xed, 0x58, 0x2c, 0x96, 0x98, 0xcb, 0x3b, 0x95, 0x95, 0x95, 0xe9, 0x3a,
-  0xfd, 0xe1, 0xf2, 0xe5, 0xcb, 0x8a, 0xb5, 0x5d, 0x58, 0x58, 0x88, 0x8e, 0x8e, 0x8e, 0x84, 0x4b,
-  0x89, 0x10, 0x55, 0xf6, 0xae, 0xab, 0xab, 0x2b, 0xee, 0xaf, 0xfd, 0xf8, 0xe3, 0x8f, 0x85, 0xf4,
-  0x21, 0x9a, 0xad, 0xb7, 0xd5, 0xc0, 0x31, 0xc8, 0x98, 0x12, 0x33, 0x00, 0xa6, 0xa4, 0x93, 0xf4,
-  0x0b, 0x12, 0x88, 0xc6, 0x20, 0x6a, 0x81, 0xd6, 0xca, 0x95, 0xb1, 0xcd, 0x0c, 0x45, 0x53, 0x66,
-  0x6c, 0xac, 0xf4, 0x07, 0xa5, 0x5d, 0xbc, 0x78, 0x51, 0xd1, 0xf6, 0xad, 0x56, 0x2b, 0x9a, 0x9b,
-  0x9b, 0x51, 0x5f, 0x5f, 0xaf, 0xe8, 0x79, 0x44, 0x7a, 0xf8, 0xe1, 0x87, 0x85, 0xb4, 0x23, 0x67,
-  0x63, 0x8b, 0x4b, 0x97, 0x2e, 0x09, 0xe9, 0xc3, 0xfc, 0xf9, 0xf3, 0x23, 0x1f, 0xa4, 0x12, 0x8e,
-  0x41, 0xc6, 0x93, 0x98, 0x01, 0xb0, 0xcf, 0x2b, 0xa6, 0x1d, 0xef, 0xa0, 0x98, 0x76, 0x48, 0x88,
-  0xc2, 0xc2, 0x42, 0x38, 0x1c, 0x21, 0x12, 0xe2, 0x89, 0x92, 0x5c, 0x5d, 0x5d, 0x9d, 0x90, 0x6a,
-  0x10, 0x05, 0x05, 0x05, 0x31, 0xcd, 0x62, 0xe9, 0xb5, 0xfa, 0x43, 0xd0, 0xee, 0xdd, 0xbb, 0x55,
-  0x39, 0x4f, 0x65, 0x65, 0x65, 0x42, 0x54, 0x89, 0xc8, 0xcb, 0xcb, 0x8b, 0x6a, 0xc6, 0x3e, 0x1a,
-  0x72, 0x52, 0x20, 0x6e, 0xde, 0xbc, 0x29, 0xa4, 0x0f, 0x05, 0x05, 0x05, 0x91, 0x0f, 0x52, 0x11,
-  0xc7, 0xa0, 0x30, 0x82, 0xf5, 0x7d, 0x83, 0xaf, 0x7d, 0x51, 0xe4, 0x6e, 0x0f, 0x3f, 0x3e, 0xda,
-  0xf4, 0x0b, 0x95, 0xe9, 0x2f, 0x07, 0x38, 0xe7, 0x33, 0xc0, 0x94, 0x69, 0xe1, 0x17, 0xb8, 0x49,
-  0x26, 0x60, 0xca, 0x74, 0x31, 0xe7, 0x9a, 0x3a, 0x0b, 0x58, 0xb8, 0x5c, 0xde, 0x62, 0xba, 0x68,
-  0x48, 0x12, 0xf0, 0xc9, 0x15, 0xe0, 0x92, 0x8c, 0xc2, 0xd0, 0x06, 0x51, 0x5e, 0x5e, 0x8e, 0x8b,
-  0x17, 0x2f, 0x26, 0xe7, 0x82, 0x04, 0xa2, 0x31, 0xec, 0xdf, 0xbf, 0x1f, 0x25, 0x25, 0x51, 0x2c,
-  0x3c, 0x19, 0x83, 0xc5, 0x62, 0xc1, 0xfa, 0xf5, 0xeb, 0xa3, 0x5a, 0xe0, 0x15, 0x6d, 0xfa, 0x83,
-  0xa8, 0x1d, 0xeb, 0xe2, 0x21, 0x6a, 0xb3, 0x90, 0x68, 0x04, 0x53, 0x22, 0x36, 0x6e, 0xdc, 0xa8,
-  0xdb, 0x0d, 0x12, 0x9e, 0x79, 0xe6, 0x19, 0x61, 0x6d, 0xc9, 0x49, 0x2f, 0xb9, 0x7e, 0x3d, 0x44,
-  0x5d, 0xd8, 0x38, 0x58, 0x2c, 0x16, 0xcd, 0x6b, 0x02, 0x8f, 0xa6, 0xeb, 0x31, 0x68, 0x4d, 0x0d,
-  0xf0, 0xf5, 0xea, 0xb1, 0x17, 0x9b, 0xed, 0x6e, 0xb8, 0x77, 0x71, 0x1b, 0x85, 0xa4, 0xbf, 0x00,
-  0xf8, 0x3b, 0xf5, 0xc0, 0x92, 0x18, 0x13, 0xbc, 0xe3, 0x35, 0x77, 0x21, 0xd0, 0xa0, 0xd2, 0xa3,
-  0xbd, 0x83, 0xaf, 0x03, 0x5b, 0xd6, 0xaa, 0x73, 0xae, 0x04, 0x97, 0x70, 0x0b, 0x12, 0x34, 0xe0,
-  0x57, 0xf0, 0xa6, 0xad, 0xa1, 0xa1, 0x41, 0xf1, 0x15, 0xf2, 0x74, 0xaf, 0x63, 0xc7, 0x8e, 0xc9,
-  0x0e, 0x80, 0x01, 0x60, 0xe9, 0xd2, 0xa5, 0x51, 0x1d, 0x17, 0x4d, 0xfa, 0x43, 0x5b, 0x5b, 0x9b,
-  0xe6, 0x8b, 0x94, 0x76, 0xed, 0xda, 0xa5, 0x4a, 0x00, 0x0c, 0x0c, 0xa5, 0x44, 0xa8, 0x51, 0x25,
-  0x22, 0x1e, 0x72, 0xab, 0x4a, 0x0c, 0x27, 0xe7, 0xff, 0x55, 0xce, 0xec, 0xf1, 0x68, 0x73, 0xe7,
-  0xce, 0x15, 0xd6, 0x96, 0x28, 0xba, 0x1c, 0x83, 0x42, 0xed, 0xc6, 0x46, 0xb2, 0xe8, 0x2f, 0x05,
-  0x42, 0x17, 0xdb, 0x1b, 0x2b, 0x40, 0x54, 0xda, 0x86, 0x01, 0x70, 0x41, 0x02, 0x19, 0x51, 0x63,
-  0x63, 0x23, 0x3a, 0x3b, 0x3b, 0x65, 0xb7, 0x13, 0x5c, 0x5d, 0x1f, 0x49, 0x34, 0xe9, 0x0f, 0x27,
-  0x4f, 0x9e, 0x94, 0xdd, 0x1f, 0xb9, 0x1a, 0x1b, 0x1b, 0xd1, 0xd6, 0xd6, 0xa6, 0xea, 0x39, 0xf5,
-  0x9a, 0x12, 0x91, 0x9d, 0x9d, 0xad, 0x75, 0x17, 0x84, 0x13, 0x19, 0xd4, 0x8b, 0xa2, 0xcb, 0x31,
-  0x68, 0xf4, 0x46, 0x13, 0xbf, 0x69, 0x19, 0x99, 0x66, 0x10, 0x7c, 0x71, 0xf6, 0x37, 0x6a, 0x3a,
-  0x0c, 0x80, 0x15, 0x4e, 0x47, 0xd0, 0x4a, 0xb2, 0x7e, 0x5f, 0x0a, 0xe1, 0x82, 0x04, 0x32, 0xa2,
-  0x63, 0xc7, 0x8e, 0x09, 0x69, 0x27, 0xd2, 0xea, 0xfa, 0x44, 0x48, 0x7f, 0x18, 0xee, 0xa5, 0x97,
-  0x5e, 0x52, 0xfd, 0x9c, 0xc1, 0x8d, 0x33, 0x6c, 0x36, 0x9b, 0xea, 0xe7, 0x0e, 0x67, 0xe2, 0xc4,
-  0x89, 0x42, 0xda, 0x11, 0x91, 0x6f, 0x9e, 0xec, 0x74, 0x35, 0x06, 0xcd, 0xcc, 0xbb, 0xb7, 0x46,
-  0x6e, 0xf6, 0xa7, 0x81, 0x82, 0x28, 0x7e, 0x36, 0xbf, 0x5d, 0x0f, 0xbc, 0x79, 0xe1, 0xde, 0xcd,
-  0x25, 0x8e, 0xfa, 0x03, 0xe5, 0xcd, 0x0a, 0x6c, 0xa1, 0x3f, 0x17, 0x7c, 0xbd, 0x7a, 0x22, 0xd0,
-  0xc6, 0x70, 0x55, 0x8e, 0xb1, 0xbf, 0xe6, 0xdb, 0xf5, 0x81, 0x3e, 0xbf, 0x7a, 0x62, 0xec, 0xe3,
-  0x82, 0xfd, 0xaf, 0xdd, 0x13, 0xf8, 0xf8, 0xc0, 0xed, 0xc0, 0x4e, 0x75, 0xc3, 0x39, 0x5a, 0xc3,
-  0x6f, 0x98, 0x21, 0x93, 0xfe, 0x52, 0x20, 0xa2, 0x71, 0xf8, 0x4d, 0xc0, 0x7d, 0x5a, 0xeb, 0x5e,
-  0x0c, 0x99, 0x32, 0x0d, 0x78, 0xe6, 0xbf, 0x05, 0xf2, 0x93, 0x49, 0x18, 0x2e, 0x48, 0x20, 0xa3,
-  0x79, 0xeb, 0xad, 0xb7, 0x84, 0xa4, 0x41, 0x2c, 0x5e, 0xbc, 0x78, 0xcc, 0xcf, 0x27, 0x4a, 0xfa,
-  0x43, 0x90, 0xd3, 0xe9, 0x44, 0x71, 0x71, 0x31, 0xca, 0xcb, 0x43, 0x14, 0xd1, 0x57, 0x50, 0x6e,
-  0x6e, 0x2e, 0xf6, 0xed, 0xdb, 0x07, 0xbb, 0xdd, 0xae, 0x8b, 0x3c, 0xd5, 0x09, 0x13, 0x26, 0x08,
-  0x69, 0x47, 0x4f, 0x01, 0xb0, 0x9e, 0x67, 0xb5, 0x75, 0x33, 0x06, 0xdd, 0x1f, 0xe2, 0x1a, 0x65,
-  0x59, 0x81, 0x1f, 0xef, 0x03, 0xde, 0xdc, 0x02, 0xbc, 0x11, 0x26, 0x5f, 0xf9, 0xd5, 0x13, 0xc0,
-  0x02, 0x99, 0xe9, 0x43, 0x0b, 0x0a, 0x03, 0xaf, 0x47, 0x8a, 0x01, 0xfb, 0xdd, 0x45, 0x8b, 0xa1,
-  0x36, 0xb3, 0x18, 0xed, 0x91, 0xff, 0x1c, 0xdd, 0xb9, 0x9f, 0xaa, 0x18, 0xda, 0x74, 0x23, 0xc3,
-  0x02, 0x54, 0x3b, 0x02, 0xbb, 0xcb, 0xb5, 0x2a, 0x9f, 0x7e, 0x92, 0xa0, 0x01, 0xf0, 0x2e, 0xe0,
-  0x57, 0xfb, 0xb5, 0xee, 0xc5, 0x90, 0xc9, 0x56, 0xe0, 0x6b, 0xcf, 0x01, 0x29, 0xc6, 0x0b, 0x80,
-  0xdb, 0xdb, 0xdb, 0x85, 0xad, 0x4a, 0x0e, 0xa5, 0xbc, 0xbc, 0x5c, 0xc8, 0x63, 0x61, 0xa2, 0x44,
-  0xe0, 0x74, 0x3a, 0xf1, 0xca, 0x2b, 0xaf, 0xc8, 0xde, 0xe8, 0x20, 0x3f, 0x3f, 0x1f, 0x36, 0x9b,
-  0x2d, 0x6c, 0x0e, 0x63, 0xa2, 0xa4, 0x3f, 0x0c, 0x67, 0xb7, 0xdb, 0x31, 0x69, 0xd2, 0x24, 0x21,
-  0x37, 0x08, 0xb1, 0x08, 0x3e, 0x0e, 0xbf, 0xef, 0xbe, 0xfb, 0x74, 0xb1, 0x73, 0x19, 0x8d, 0x64,
-  0x88, 0x31, 0xa8, 0xd5, 0x05, 0xf4, 0x7a, 0xee, 0x5d, 0xfc, 0x96, 0x61, 0x09, 0xe4, 0x05, 0xe7,
-  0x2e, 0x18, 0xda, 0xd2, 0x38, 0xa8, 0x76, 0xcf, 0x50, 0x00, 0xda, 0xeb, 0x01, 0xb6, 0xd8, 0x43,
-  0x6f, 0x36, 0x31, 0x7a, 0x16, 0xf9, 0x46, 0x67, 0x60, 0x77, 0xb7, 0x99, 0x79, 0xc0, 0xff, 0x3a,
-  0x30, 0x34, 0xf3, 0x3c, 0x27, 0x3f, 0x90, 0x87, 0x3c, 0x3a, 0xd8, 0xfe, 0x79, 0x53, 0xe8, 0x2a,
-  0x0f, 0x4f, 0x8d, 0xda, 0xea, 0xfa, 0xe5, 0x0d, 0xa1, 0xab, 0x47, 0x3c, 0xfa, 0xa5, 0x7b, 0xbf,
-  0xa7, 0xe7, 0x77, 0x00, 0x5f, 0x9f, 0x73, 0xef, 0xb1, 0x82, 0x25, 0x66, 0xc4, 0x96, 0x31, 0x5e,
-  0xeb, 0x1e, 0x8c, 0x34, 0x5e, 0xcc, 0x63, 0xa9, 0x44, 0xb4, 0x6e, 0xdd, 0x3a, 0xc5, 0xdf, 0x1c,
-  0x44, 0xec, 0x7a, 0x44, 0x94, 0x28, 0xde, 0x7e, 0xfb, 0x6d, 0x21, 0xed, 0x84, 0xdb, 0xe2, 0x38,
-  0xd1, 0xd2, 0x1f, 0x86, 0x2b, 0x2d, 0x2d, 0x45, 0x53, 0x53, 0x93, 0x26, 0xe7, 0xde, 0xb6, 0x6d,
-  0x1b, 0x2a, 0x2a, 0x2a, 0x22, 0x1f, 0x48, 0xaa, 0x32, 0xcc, 0x18, 0xf4, 0xcb, 0x31, 0x26, 0xfd,
-  0x96, 0x97, 0x04, 0x52, 0x05, 0x82, 0x0a, 0x6c, 0x23, 0xb7, 0x32, 0x3e, 0xdf, 0x1a, 0xfb, 0x4e,
-  0x6b, 0x57, 0xdc, 0xc0, 0xe9, 0x51, 0x25, 0x10, 0xa7, 0xa9, 0x94, 0xaf, 0x3d, 0x33, 0x17, 0xd8,
-  0x72, 0x50, 0xf1, 0xd3, 0x24, 0x66, 0x00, 0x4c, 0xba, 0xe1, 0x72, 0xb9, 0xb0, 0x71, 0xe3, 0x46,
-  0xad, 0xbb, 0x41, 0x94, 0x34, 0x0e, 0x1f, 0x3e, 0x2c, 0xa4, 0x9d, 0x70, 0xb3, 0xbc, 0x4f, 0x3f,
-  0xfd, 0x74, 0xc4, 0xaf, 0x6d, 0x69, 0x69, 0xd1, 0x4d, 0xfa, 0xc3, 0x68, 0x76, 0xbb, 0x1d, 0xb5,
-  0xb5, 0xb5, 0x9a, 0x3c, 0xc6, 0xdf, 0xb2, 0x65, 0x8b, 0xa6, 0x3b, 0xc7, 0xdd, 0xbe, 0x7d, 0x5b,
-  0x48, 0x3b, 0x72, 0xb7, 0xdd, 0x16, 0x49, 0xee, 0x6e, 0x7f, 0x86, 0x19, 0x83, 0x36, 0x95, 0x02,
-  0x17, 0xc6, 0x58, 0x0c, 0x3a, 0x27, 0x3f, 0x90, 0xf2, 0x00, 0x00, 0xc5, 0xa3, 0x6e, 0x7e, 0x2f,
-  0xc6, 0x50, 0xb5, 0x63, 0x9c, 0x25, 0x90, 0x6f, 0x5b, 0xe5, 0x00, 0x8a, 0x47, 0xfd, 0xac, 0x1f,
-  0x0e, 0xb1, 0x23, 0xe4, 0x93, 0xe5, 0xa1, 0x73, 0x80, 0x47, 0x7b, 0x6e, 0x5b, 0xf8, 0x1c, 0xe0,
-  0x50, 0x96, 0xac, 0x50, 0x24, 0xef, 0x77, 0x38, 0xfd, 0x05, 0xc0, 0x89, 0xb8, 0x39, 0x45, 0xaf,
-  0x7e, 0xf2, 0xa9, 0xb4, 0xe0, 0x74, 0x3a, 0x35, 0x9b, 0x95, 0x21, 0x4a, 0x36, 0x4e, 0xa7, 0x53,
-  0xd6, 0x2e, 0x5d, 0x41, 0xb9, 0xb9, 0xb9, 0x21, 0x83, 0xb5, 0x68, 0xb6, 0xd2, 0x7d, 0xff, 0xfd,
-  0xf7, 0x65, 0x9f, 0x5f, 0x49, 0x75, 0x75, 0x75, 0x58, 0xb4, 0x68, 0x91, 0xea, 0xd5, 0x21, 0x2c,
-  0x16, 0x0b, 0x5e, 0x79, 0xe5, 0x15, 0x55, 0xcf, 0x39, 0x5c, 0x77, 0x77, 0xb7, 0x90, 0x76, 0xf4,
-  0x14, 0x00, 0x8b, 0x60, 0x98, 0x31, 0xc8, 0x5e, 0x10, 0x48, 0x39, 0x08, 0x67, 0x41, 0xe1, 0xbd,
-  0x8b, 0xc8, 0x62, 0x95, 0x61, 0x09, 0x04, 0xb5, 0x4f, 0x96, 0x0f, 0xa5, 0x5c, 0xdc, 0xe8, 0x0c,
-  0xa4, 0x30, 0x28, 0x9d, 0x97, 0x7b, 0x63, 0xd4, 0x4c, 0xfe, 0x93, 0xe5, 0xe2, 0xf6, 0x7d, 0x08,
-  0x41, 0xbd, 0x1c, 0x60, 0x73, 0x4a, 0x60, 0xd3, 0x89, 0x09, 0x93, 0xc3, 0x57, 0x44, 0xf0, 0xfb,
-  0x43, 0x27, 0x7b, 0x6b, 0x29, 0x6b, 0x1a, 0x90, 0xff, 0x57, 0xe1, 0x3f, 0xef, 0xf7, 0x07, 0x36,
-  0xd4, 0x30, 0xe9, 0xef, 0x5e, 0x42, 0x4d, 0x76, 0xbb, 0x1d, 0xd9, 0xd9, 0xd9, 0x58, 0xb1, 0x62,
-  0x85, 0xd6, 0x5d, 0x21, 0x4a, 0x78, 0x47, 0x8f, 0x1e, 0x15, 0x92, 0xd7, 0x58, 0x5c, 0x5c, 0x3c,
-  0x62, 0xf1, 0x56, 0x59, 0x59, 0x59, 0x54, 0x8f, 0x73, 0xb7, 0x6f, 0xdf, 0x2e, 0xfb, 0xdc, 0x4a,
-  0x73, 0xbb, 0xdd, 0x28, 0x28, 0x28, 0x40, 0x7d, 0x7d, 0x3d, 0x2a, 0x2b, 0x2b, 0x55, 0x3b, 0xaf,
-  0xd5, 0x6a, 0x85, 0xc3, 0xe1, 0x80, 0xdd, 0xae, 0xfe, 0xee, 0x56, 0x72, 0x67, 0x4b, 0xf5, 0x48,
-  0xd4, 0x76, 0xd7, 0x86, 0x19, 0x83, 0xea, 0xed, 0xc0, 0xa9, 0xc3, 0xc0, 0xba, 0xcd, 0xf7, 0x56,
-  0x86, 0x00, 0x80, 0x87, 0xc6, 0x5e, 0x00, 0x1b, 0xb3, 0x0f, 0x0e, 0x01, 0xd5, 0x63, 0xec, 0xcd,
-  0x20, 0x32, 0x07, 0xf8, 0xd5, 0x8d, 0xc0, 0x0f, 0x9b, 0x47, 0x7e, 0x3e, 0x4b, 0xb9, 0xf4, 0x13,
-  0xf5, 0x02, 0xe0, 0xcc, 0xa9, 0xc0, 0x4b, 0x3f, 0x07, 0x52, 0xd2, 0x54, 0x3b, 0xa5, 0x10, 0x9f,
-  0x7d, 0x14, 0xf8, 0x1f, 0x7b, 0xb5, 0xee, 0x45, 0x42, 0x58, 0xb9, 0x72, 0x25, 0x2e, 0x5c, 0xb8,
-  0xa0, 0xe8, 0x82, 0x04, 0x0a, 0x90, 0x24, 0x49, 0xeb, 0x2e, 0x90, 0x82, 0x76, 0xed, 0xda, 0x25,
-  0xa4, 0xe2, 0xc1, 0xaa, 0x55, 0xab, 0x46, 0x7c, 0x9c, 0xe8, 0xe9, 0x0f, 0xa1, 0x54, 0x55, 0x55,
-  0xe1, 0x9d, 0x77, 0xde, 0xc1, 0x8e, 0x1d, 0x3b, 0x54, 0x7b, 0xef, 0x29, 0x2b, 0x2b, 0xc3, 0xd6,
-  0xad, 0x5b, 0x55, 0xbf, 0x4e, 0xa2, 0x82, 0x45, 0x20, 0xb0, 0xad, 0x72, 0xbc, 0xfd, 0x9f, 0x3f,
-  0x7f, 0xbe, 0xb0, 0x7e, 0x9c, 0x3f, 0x7f, 0x5e, 0x58, 0x5b, 0x86, 0x19, 0x83, 0xde, 0x75, 0x06,
-  0x5e, 0xa1, 0xaa, 0x3c, 0xdc, 0xbe, 0x09, 0xfc, 0xf2, 0x9d, 0x91, 0x95, 0x1a, 0x72, 0x62, 0xf8,
-  0xff, 0xba, 0xd1, 0x09, 0xdc, 0xb9, 0x3d, 0x14, 0x5c, 0x07, 0x53, 0x11, 0xd4, 0xd8, 0xce, 0xf8,
-  0x5d, 0x67, 0x20, 0x80, 0x7f, 0x46, 0x9d, 0x1b, 0x5a, 0x75, 0xa7, 0x2d, 0x07, 0xfa, 0x55, 0x3d,
-  0x9d, 0x10, 0xdc, 0xc0, 0x22, 0x26, 0xeb, 0xd6, 0xad, 0xd3, 0x55, 0x89, 0x1d, 0xa2, 0x44, 0xe4,
-  0x72, 0xb9, 0x84, 0x3c, 0xde, 0xb7, 0x5a, 0xad, 0x23, 0xd2, 0x20, 0x92, 0x21, 0xfd, 0x21, 0x14,
-  0x97, 0xcb, 0x85, 0x39, 0x73, 0xe6, 0xa8, 0xf6, 0x18, 0xdc, 0x62, 0xb1, 0x44, 0xac, 0xb5, 0xac,
-  0x84, 0xdd, 0xbb, 0x77, 0x0b, 0x6b, 0x4b, 0x4e, 0xf9, 0xb1, 0x29, 0x53, 0xa6, 0x08, 0xe9, 0x83,
-  0xc7, 0xe3, 0x11, 0x5e, 0x5e, 0xce, 0x50, 0x63, 0x50, 0xa8, 0xdc, 0x5e, 0xd7, 0xee, 0x40, 0xaa,
-  0xc2, 0xd1, 0x61, 0x13, 0x77, 0x73, 0x0b, 0x62, 0x4b, 0x8d, 0xd8, 0xba, 0x6e, 0x64, 0x3a, 0xc2,
-  0x93, 0xe5, 0x81, 0x0a, 0x10, 0x6a, 0x78, 0xad, 0x6a, 0x64, 0xdf, 0x15, 0xa4, 0x6e, 0x00, 0x2c,
-  0x6a, 0x33, 0x08, 0x73, 0x02, 0x56, 0x6f, 0x4b, 0xcb, 0xd0, 0xba, 0x07, 0xaa, 0x70, 0xb9, 0x5c,
-  0xa8, 0xae, 0xae, 0xd6, 0xba, 0x1b, 0x44, 0x09, 0x4f, 0x54, 0x19, 0xb2, 0xe0, 0xac, 0x6f, 0x32,
-  0xa5, 0x3f, 0x84, 0x63, 0xb7, 0xdb, 0xf1, 0xec, 0xb3, 0xcf, 0x0a, 0xc9, 0xa1, 0x8e, 0x24, 0x52,
-  0xad, 0x65, 0x25, 0xb8, 0xdd, 0x6e, 0x61, 0xdf, 0x9b, 0x9c, 0x59, 0xdc, 0xc9, 0x93, 0x27, 0x0b,
-  0xe9, 0x43, 0x6b, 0x6b, 0x6b, 0xe4, 0x83, 0x62, 0x94, 0x94, 0x63, 0x50, 0xb8, 0xcd, 0x2a, 0x46,
-  0xd7, 0xe3, 0x3d, 0xba, 0x37, 0x50, 0xbd, 0x01, 0x18, 0xb9, 0x68, 0x2e, 0xc3, 0x12, 0x48, 0x2d,
-  0x08, 0xb5, 0x11, 0x46, 0x28, 0xad, 0xae, 0x40, 0x3a, 0xc2, 0x70, 0xe5, 0x9b, 0x42, 0x07, 0xd1,
-  0x4a, 0x2c, 0x82, 0xdb, 0x54, 0x0a, 0x5c, 0x51, 0xfe, 0x77, 0x58, 0x7f, 0x91, 0xe4, 0x81, 0x9d,
-  0xc0, 0x87, 0x47, 0xc7, 0x38, 0x40, 0x02, 0x7e, 0x73, 0x5c, 0xb5, 0xee, 0x44, 0xa5, 0xef, 0x0e,
-  0xd0, 0xf4, 0x22, 0xd0, 0xf5, 0x49, 0xe8, 0xcf, 0x4b, 0x26, 0xe0, 0x72, 0xe2, 0x3c, 0x52, 0x94,
-  0xab, 0xb1, 0xb1, 0x11, 0x0b, 0x17, 0x2e, 0x54, 0xbd, 0x68, 0x3d, 0x51, 0x32, 0xd9, 0xba, 0x75,
-  0xab, 0x90, 0xdf, 0xa1, 0x27, 0x9e, 0x78, 0x02, 0x40, 0x72, 0xa6, 0x3f, 0x84, 0xe2, 0x74, 0x3a,
-  0xe1, 0x74, 0x3a, 0xe1, 0x70, 0x38, 0x14, 0x7d, 0x0f, 0xca, 0xcf, 0xcf, 0x57, 0xac, 0xed, 0xb1,
-  0x9c, 0x3a, 0x75, 0x4a, 0xc8, 0x23, 0x7e, 0x39, 0x6d, 0xcc, 0x9e, 0x3d, 0x5b, 0xf6, 0xf9, 0x01,
-  0xe0, 0xec, 0xd9, 0x18, 0xaa, 0x13, 0xc4, 0xc0, 0x90, 0x63, 0x50, 0xa8, 0x5c, 0x5c, 0x7b, 0x41,
-  0x20, 0x18, 0xfd, 0xab, 0xaf, 0x84, 0xce, 0x17, 0x1e, 0xcb, 0xbb, 0x4e, 0x20, 0x7b, 0x6e, 0x20,
-  0xf0, 0x0d, 0xaa, 0x76, 0x00, 0x93, 0xee, 0x0b, 0x9c, 0x2b, 0xd2, 0x66, 0x18, 0xbf, 0xfe, 0x45,
-  0x60, 0xbb, 0xe6, 0x78, 0x37, 0xe2, 0xd8, 0xba, 0x2e, 0x50, 0x0f, 0x78, 0x66, 0x6e, 0xa0, 0x9d,
-  0x66, 0xf1, 0x65, 0x19, 0xf5, 0x17, 0x00, 0xff, 0xfa, 0xdf, 0x01, 0x97, 0xf6, 0x3b, 0xee, 0xc4,
-  0xe4, 0x4e, 0x37, 0xf0, 0x2f, 0x8d, 0xc0, 0x60, 0x02, 0xa6, 0x78, 0x28, 0xc4, 0x6e, 0xb7, 0x63,
-  0xfe, 0xfc, 0xf9, 0x28, 0x2c, 0x94, 0xb9, 0x0b, 0x0d, 0x91, 0x41, 0xb9, 0xdd, 0x6e, 0xb4, 0xb5,
-  0xb5, 0xc9, 0x0e, 0xb4, 0x2c, 0x16, 0x0b, 0x2a, 0x2a, 0x2a, 0xa2, 0x4a, 0x7f, 0x38, 0x78, 0x50,
-  0xf9, 0xda, 0x9b, 0x6a, 0xb1, 0xdb, 0xed, 0x38, 0x7c, 0xf8, 0x30, 0x36, 0x6f, 0xde, 0xac, 0x58,
-  0x4e, 0x68, 0x59, 0x59, 0x99, 0xea, 0x3b, 0xc4, 0x1d, 0x3b, 0x76, 0x4c, 0xc8, 0x66, 0x20, 0x99,
-  0x99, 0x99, 0x71, 0x7f, 0xed, 0xac, 0x59, 0xb3, 0x64, 0x9f, 0x1f, 0x50, 0xb6, 0xd6, 0x74, 0x52,
-  0x8d, 0x41, 0xad, 0x2e, 0x60, 0x79, 0x9c, 0xeb, 0x3e, 0x5e, 0xab, 0x0a, 0xbc, 0xc6, 0x12, 0xae,
-  0xed, 0x37, 0xea, 0xc2, 0xef, 0x32, 0x17, 0x4d, 0x4e, 0xf0, 0x77, 0x97, 0x45, 0x3e, 0xa6, 0xd5,
-  0x15, 0xba, 0x7f, 0xad, 0x2e, 0xc5, 0x37, 0xc3, 0xd0, 0x5f, 0xe9, 0x82, 0xf4, 0x71, 0x5a, 0xf7,
-  0x20, 0x0e, 0x92, 0xa1, 0x37, 0xc3, 0x08, 0x67, 0xed, 0xda, 0xb5, 0xaa, 0x3c, 0x8a, 0x24, 0x4a,
-  0x56, 0xa2, 0x6a, 0x02, 0x57, 0x56, 0x56, 0x46, 0x4c, 0x7f, 0xf0, 0x78, 0x3c, 0x42, 0x73, 0x4c,
-  0xf5, 0xc0, 0xe9, 0x74, 0x2a, 0x9a, 0x1b, 0x7c, 0xdf, 0x7d, 0xf7, 0x29, 0xd2, 0xee, 0x58, 0x1a,
-  0x1b, 0x1b, 0x85, 0x6c, 0xfc, 0x20, 0x27, 0x05, 0xa2, 0xa0, 0xa0, 0x40, 0xf6, 0xf9, 0xd5, 0x78,
-  0xda, 0xc0, 0x31, 0x88, 0xc6, 0xa2, 0xbf, 0x00, 0x98, 0x92, 0x86, 0xdb, 0xed, 0x36, 0xd6, 0x82,
-  0x04, 0x22, 0xc1, 0x44, 0xe5, 0xe3, 0x46, 0x33, 0x03, 0xda, 0xda, 0xda, 0x9a, 0xf0, 0xe9, 0x0f,
-  0xe1, 0x28, 0x95, 0x1b, 0x2c, 0x6a, 0x31, 0x58, 0xac, 0x44, 0xec, 0x16, 0x18, 0x6f, 0x10, 0x5b,
-  0x56, 0x56, 0x26, 0xa4, 0x8e, 0xf0, 0xae, 0x5d, 0x21, 0x36, 0x55, 0x10, 0x8c, 0x63, 0x10, 0x8d,
-  0x45, 0xbd, 0x00, 0xb8, 0xa7, 0x1b, 0x80, 0xa0, 0x45, 0x70, 0x6a, 0x8a, 0x66, 0xc1, 0xdd, 0xb8,
-  0x09, 0x00, 0xcb, 0x52, 0x85, 0xe4, 0x72, 0xb9, 0xb0, 0x65, 0xcb, 0x16, 0xad, 0xbb, 0x41, 0x94,
-  0x90, 0xdc, 0x6e, 0x37, 0x5a, 0x5a, 0x5a, 0x54, 0x39, 0x57, 0x32, 0xa5, 0x3f, 0x84, 0x12, 0x9c,
-  0x0d, 0x16, 0xb9, 0x79, 0xc6, 0xf5, 0xeb, 0xd7, 0x85, 0xb5, 0x15, 0x8b, 0xad, 0x5b, 0xb7, 0xca,
-  0x0e, 0xea, 0x82, 0xa9, 0x31, 0xb1, 0x2a, 0x2e, 0x2e, 0x96, 0x75, 0x5e, 0x00, 0x68, 0x6b, 0x6b,
-  0x43, 0x63, 0x63, 0x88, 0x9a, 0xb0, 0x0a, 0xe0, 0x18, 0x44, 0xe1, 0x88, 0xcb, 0x01, 0x5e, 0xf1,
-  0x0d, 0x20, 0x63, 0x7c, 0xf8, 0x4a, 0x0f, 0x13, 0xb3, 0x12, 0xb3, 0x12, 0xc2, 0xb5, 0x8b, 0xc0,
-  0xf1, 0x7f, 0x0d, 0xfc, 0x3d, 0xd4, 0xf7, 0x26, 0x49, 0x40, 0xf7, 0x8d, 0xc0, 0x42, 0x38, 0x0a,
-  0xa9, 0xae, 0xae, 0x0e, 0x39, 0x39, 0x39, 0xc6, 0x5a, 0x90, 0x40, 0x24, 0xc8, 0xc1, 0x83, 0x07,
-  0x15, 0xcf, 0x63, 0x4c, 0xc6, 0xf4, 0x87, 0x70, 0x4a, 0x4a, 0x4a, 0x70, 0xfa, 0xf4, 0xe9, 0x84,
-  0xde, 0x0d, 0xcd, 0xed, 0x76, 0x63, 0xfb, 0xf6, 0xed, 0xb2, 0x37, 0x00, 0x59, 0xb5, 0x6a, 0x55,
-  0xcc, 0x81, 0xe8, 0xe8, 0xda, 0xd2, 0xf1, 0x78, 0xe9, 0xa5, 0x97, 0x64, 0xb7, 0x11, 0x0b, 0x8e,
-  0x41, 0x14, 0x8a, 0xb8, 0x00, 0xf8, 0x6f, 0x1b, 0x87, 0xb6, 0xcd, 0x4b, 0x26, 0xe7, 0x4f, 0x03,
-  0x35, 0x5f, 0xd5, 0xba, 0x17, 0x09, 0x2f, 0xa9, 0x16, 0x24, 0x10, 0xa9, 0x68, 0xf7, 0xee, 0xdd,
-  0xa8, 0xae, 0xae, 0x56, 0x34, 0x60, 0x4b, 0xe6, 0xf4, 0x87, 0xd1, 0xdc, 0x6e, 0x37, 0x8e, 0x1f,
-  0x3f, 0x2e, 0x64, 0xc7, 0xb0, 0x5f, 0xfc, 0xe2, 0x17, 0x02, 0x7a, 0x14, 0x9f, 0xaa, 0xaa, 0x2a,
-  0x7c, 0xe5, 0x2b, 0x5f, 0x91, 0xb5, 0xc0, 0x6f, 0xc5, 0x8a, 0x15, 0xb0, 0xd9, 0x6c, 0x70, 0xb9,
-  0xa2, 0xdb, 0xe2, 0xb6, 0xbe, 0xbe, 0x3e, 0xaa, 0x52, 0x7a, 0x63, 0xd9, 0xbb, 0x77, 0xaf, 0xea,
-  0x0b, 0x07, 0x01, 0x8e, 0x41, 0x74, 0x2f, 0x71, 0x29, 0x10, 0x3d, 0x62, 0xf6, 0x28, 0xa7, 0xe4,
-  0xb5, 0x76, 0xed, 0x5a, 0x21, 0x8b, 0x37, 0x88, 0x8c, 0x24, 0x18, 0xb0, 0x29, 0x29, 0xd9, 0xd3,
-  0x1f, 0x94, 0xe0, 0xf1, 0x78, 0x34, 0xbf, 0x69, 0x58, 0xb7, 0x6e, 0x9d, 0xec, 0x36, 0x76, 0xec,
-  0xd8, 0x11, 0xd5, 0x71, 0x79, 0x79, 0x79, 0x58, 0xb3, 0x66, 0x8d, 0xac, 0x73, 0x75, 0x76, 0x76,
-  0xe2, 0x07, 0x3f, 0xf8, 0x81, 0xac, 0x36, 0xe4, 0xe0, 0x18, 0x44, 0xc3, 0xe9, 0x6f, 0x11, 0x9c,
-  0xc9, 0xac, 0x75, 0x0f, 0x48, 0x21, 0x6e, 0xb7, 0x1b, 0x1b, 0x37, 0x6e, 0x4c, 0x9a, 0x05, 0x09,
-  0x72, 0x67, 0x42, 0xe4, 0xc8, 0xcb, 0xcb, 0xd3, 0xec, 0xdc, 0x72, 0x69, 0xd9, 0xf7, 0x44, 0xbd,
-  0x6e, 0x27, 0x4e, 0x9c, 0x50, 0xac, 0x6d, 0x8f, 0xc7, 0x83, 0xba, 0xba, 0x30, 0xa5, 0x8e, 0x92,
-  0xd4, 0xc2, 0x85, 0x0b, 0x65, 0xb7, 0xa1, 0xf4, 0x4d, 0x49, 0x34, 0x5c, 0x2e, 0x17, 0x1a, 0x1a,
-  0x1a, 0x64, 0xb5, 0x91, 0x9b, 0x9b, 0x1b, 0xf1, 0xe7, 0xcb, 0x66, 0xb3, 0xe1, 0xc0, 0x81, 0x03,
-  0xb2, 0xdf, 0xf3, 0x36, 0x6e, 0xdc, 0xa8, 0xe9, 0x4d, 0x83, 0xde, 0xc7, 0x20, 0x49, 0x92, 0x60,
-  0x32, 0x71, 0x49, 0x51, 0x34, 0x24, 0x49, 0xfe, 0x75, 0x52, 0x2f, 0x00, 0x1e, 0xec, 0x07, 0x7e,
-  0xf2, 0x1d, 0xe0, 0xfb, 0x4f, 0x8c, 0xf1, 0xfa, 0x12, 0xf0, 0xfe, 0x3b, 0xaa, 0x75, 0x89, 0xd4,
-  0xe7, 0x74, 0x3a, 0x93, 0x66, 0x41, 0xc2, 0xe6, 0xcd, 0x9b, 0x61, 0xb3, 0x85, 0xd9, 0xc9, 0x46,
-  0x61, 0x3b, 0x77, 0xee, 0x4c, 0xd8, 0x60, 0x4e, 0xcb, 0xbe, 0x27, 0xea, 0x75, 0xab, 0xab, 0xab,
-  0x53, 0x6c, 0xd0, 0xd6, 0x43, 0x20, 0xa7, 0xa6, 0x83, 0x07, 0x0f, 0x0a, 0xb9, 0x79, 0x55, 0xf2,
-  0xa6, 0x24, 0x16, 0x55, 0x55, 0x55, 0xd8, 0xbb, 0x57, 0xde, 0xd6, 0xb1, 0x85, 0x85, 0x85, 0xe8,
-  0xe8, 0xe8, 0x80, 0xc3, 0xe1, 0x18, 0xf1, 0xef, 0x36, 0x9b, 0x0d, 0x0e, 0x87, 0x03, 0x47, 0x8e,
-  0x1c, 0x91, 0x5d, 0x4b, 0xb9, 0xa1, 0xa1, 0x41, 0x93, 0xd4, 0x87, 0xd1, 0xf4, 0x3c, 0x06, 0x99,
-  0x4c, 0x40, 0x7a, 0x9a, 0x19, 0xe9, 0x69, 0x66, 0x98, 0xf4, 0x37, 0x3d, 0xa9, 0x1b, 0x92, 0x04,
-  0xa4, 0xa6, 0x98, 0x90, 0x92, 0x62, 0x82, 0xc9, 0x14, 0x7f, 0x14, 0xac, 0xde, 0x46, 0x18, 0xfd,
-  0x7d, 0x81, 0x3d, 0xaa, 0xbb, 0xb5, 0x59, 0x35, 0x4b, 0xfa, 0x51, 0x57, 0x57, 0x87, 0x05, 0x0b,
-  0x16, 0x08, 0x29, 0xe6, 0xae, 0xa5, 0xdc, 0xdc, 0x5c, 0x1c, 0x39, 0x72, 0x24, 0xe2, 0x71, 0x45,
-  0x45, 0x45, 0x51, 0xe7, 0xd8, 0x45, 0xab, 0xb0, 0xb0, 0x10, 0xe7, 0xce, 0x9d, 0x13, 0xda, 0x66,
-  0x50, 0x43, 0x43, 0x03, 0xaa, 0xaa, 0x22, 0x14, 0x4e, 0x97, 0x21, 0xda, 0xbe, 0x4b, 0x0a, 0x4c,
-  0x83, 0x68, 0x79, 0x6e, 0xb9, 0x44, 0xe5, 0xad, 0x8e, 0xa6, 0x97, 0x40, 0x2e, 0x94, 0x83, 0x07,
-  0x0f, 0x2a, 0xf2, 0x3d, 0xcb, 0xd5, 0xd9, 0xd9, 0xa9, 0xab, 0x59, 0xf3, 0xd2, 0xd2, 0x52, 0xd9,
-  0xd7, 0xca, 0x6a, 0xb5, 0xa2, 0xbc, 0xbc, 0x5c, 0x91, 0x85, 0x62, 0x4d, 0x4d, 0x4d, 0x8a, 0xbe,
-  0xa7, 0xc4, 0x4a, 0x8f, 0x63, 0x50, 0x6f, 0x9f, 0x17, 0xe3, 0x33, 0x52, 0x90, 0x96, 0x66, 0x86,
-  0xd9, 0x6c, 0xc2, 0xe4, 0x89, 0x69, 0x5a, 0x77, 0x49, 0xb7, 0xc6, 0x67, 0x98, 0x31, 0x2e, 0x23,
-  0x05, 0x26, 0x93, 0x04, 0xaf, 0xd7, 0x87, 0xde, 0x3e, 0x6f, 0x5c, 0xed, 0xa8, 0x77, 0x8f, 0x21,
-  0x49, 0xc0, 0xb8, 0x24, 0x5c, 0x24, 0x47, 0x71, 0x29, 0x2d, 0x2d, 0x15, 0x5a, 0x8e, 0x08, 0x00,
-  0x0b, 0x9e, 0x53, 0x52, 0x13, 0x51, 0xfb, 0x75, 0x34, 0x23, 0xa6, 0x3f, 0x88, 0xf0, 0xc6, 0x1b,
-  0x6f, 0x68, 0xdd, 0x85, 0x7b, 0xac, 0x5c, 0xb9, 0x12, 0x87, 0x0e, 0x1d, 0xd2, 0xba, 0x1b, 0xf7,
-  0x68, 0x6a, 0x6a, 0x82, 0xdd, 0x1e, 0xc5, 0xae, 0x61, 0x2a, 0xd3, 0xdb, 0x18, 0x74, 0xeb, 0x56,
-  0x3f, 0x06, 0x06, 0x7d, 0x18, 0x1c, 0xf4, 0x01, 0xf0, 0xe3, 0xbe, 0x29, 0x09, 0x58, 0x35, 0x4b,
-  0x25, 0xd3, 0xee, 0x1f, 0x07, 0x93, 0x49, 0x82, 0xdf, 0xef, 0xc7, 0xa0, 0xd7, 0x8f, 0xee, 0xee,
-  0x81, 0xb8, 0xda, 0xe1, 0x24, 0x3b, 0x69, 0xa6, 0xa4, 0xa4, 0x44, 0xe8, 0x82, 0x84, 0x53, 0xa7,
-  0x4e, 0x09, 0x6b, 0x8b, 0x48, 0x6f, 0x44, 0xed, 0x00, 0x36, 0xdc, 0xfe, 0xfd, 0xfb, 0x85, 0xb6,
-  0x67, 0x04, 0xed, 0xed, 0xed, 0xba, 0x9a, 0xcd, 0x1c, 0x6e, 0xe5, 0xca, 0x95, 0xb2, 0xd3, 0x21,
-  0x44, 0x6a, 0x68, 0x68, 0xd0, 0x65, 0xf0, 0x1b, 0xa4, 0xa7, 0x31, 0xe8, 0xf2, 0x35, 0x0f, 0xfa,
-  0xfa, 0xbc, 0xf0, 0xf4, 0x0c, 0xa2, 0xaf, 0xdf, 0x87, 0xb9, 0x0f, 0x4c, 0x12, 0xd6, 0xaf, 0x64,
-  0xf3, 0xd0, 0x9c, 0xc9, 0x18, 0x1c, 0xf4, 0xe1, 0x4e, 0xef, 0x20, 0xfa, 0xfb, 0xbd, 0xb8, 0x74,
-  0xf5, 0x76, 0x5c, 0xed, 0x30, 0x00, 0x26, 0xcd, 0x04, 0x17, 0x24, 0x88, 0xf2, 0xda, 0x6b, 0xaf,
-  0x45, 0x7d, 0x6c, 0x57, 0x57, 0x97, 0xb0, 0xf3, 0xc6, 0xea, 0xd6, 0xad, 0x5b, 0x9a, 0x9d, 0x5b,
-  0x2e, 0x2d, 0xfb, 0x9e, 0xc8, 0xd7, 0x4d, 0x14, 0x91, 0x33, 0x8f, 0x1e, 0x8f, 0x47, 0xd3, 0x15,
-  0xf9, 0x89, 0xea, 0xc5, 0x17, 0x5f, 0xd4, 0xba, 0x0b, 0x63, 0x2a, 0x2d, 0x2d, 0x95, 0xbd, 0x30,
-  0x4e, 0x2e, 0x8f, 0xc7, 0x83, 0x0d, 0x1b, 0x36, 0xe8, 0xf6, 0x46, 0x21, 0x48, 0xcb, 0x31, 0x68,
-  0xb4, 0x73, 0x17, 0xba, 0xe0, 0xf3, 0xfb, 0xe1, 0xf5, 0xf9, 0x91, 0x9a, 0x62, 0xc2, 0xa7, 0x66,
-  0x4d, 0xc0, 0x82, 0x87, 0xb2, 0x84, 0xf5, 0x2d, 0x59, 0x2c, 0x78, 0x28, 0x0b, 0x39, 0xd9, 0x13,
-  0x60, 0x32, 0x49, 0x18, 0xf4, 0x06, 0xae, 0xd7, 0xb9, 0xf6, 0xf8, 0xc6, 0x73, 0x06, 0xc0, 0xa4,
-  0x29, 0xa7, 0xd3, 0x89, 0xa6, 0xa6, 0x26, 0xd9, 0xed, 0xec, 0xdd, 0xbb, 0x37, 0xa6, 0x3c, 0xdb,
-  0xed, 0xdb, 0xb7, 0x6b, 0xb6, 0x12, 0x58, 0xce, 0x9b, 0xa4, 0xd6, 0x8e, 0x1d, 0x3b, 0x66, 0xc8,
-  0x73, 0xeb, 0x45, 0x55, 0x55, 0x95, 0xb0, 0x9d, 0xe1, 0xb6, 0x6f, 0xdf, 0xae, 0x79, 0x19, 0xaf,
-  0x44, 0xa3, 0x97, 0x85, 0x5c, 0x91, 0x54, 0x55, 0x55, 0x29, 0xb2, 0xf5, 0x73, 0x34, 0xda, 0xda,
-  0xda, 0xb0, 0x68, 0xd1, 0x22, 0xd5, 0x76, 0x7a, 0x93, 0x4b, 0xab, 0x31, 0x68, 0xb4, 0x33, 0xbf,
-  0xfd, 0x33, 0xfc, 0x7e, 0xc0, 0xef, 0xf7, 0x23, 0x35, 0xd5, 0x84, 0xac, 0xcc, 0x34, 0x7c, 0xb3,
-  0x24, 0xf1, 0x16, 0xec, 0x2a, 0xed, 0x9b, 0x25, 0x79, 0x98, 0x3c, 0x29, 0x0d, 0xa9, 0xa9, 0x26,
-  0xf8, 0x7c, 0x7e, 0xf8, 0xfd, 0xc0, 0x99, 0xff, 0xf8, 0x73, 0x5c, 0x6d, 0x31, 0x00, 0x26, 0xcd,
-  0xd9, 0xed, 0x76, 0x59, 0x8f, 0xed, 0xda, 0xdb, 0xdb, 0x51, 0x5a, 0x5a, 0x1a, 0xd3, 0xd7, 0xb8,
-  0xdd, 0x6e, 0xcd, 0x06, 0x32, 0x97, 0xcb, 0x25, 0xe4, 0x0d, 0x57, 0x0b, 0x8d, 0x8d, 0x8d, 0x9a,
-  0x3d, 0x62, 0xd5, 0xf2, 0xdc, 0x7a, 0xb2, 0x76, 0xed, 0x5a, 0xd9, 0x81, 0x8d, 0xde, 0x16, 0x25,
-  0x25, 0x82, 0x44, 0xbb, 0x66, 0xc1, 0xad, 0x9f, 0xd5, 0x7a, 0xaf, 0xf1, 0x78, 0x3c, 0xa8, 0xad,
-  0xad, 0x45, 0x41, 0x41, 0x41, 0xc2, 0xdd, 0x58, 0x69, 0x31, 0x06, 0x8d, 0x76, 0xae, 0xbd, 0x0b,
-  0x57, 0x3a, 0x7a, 0x30, 0x38, 0xe8, 0xc3, 0xc0, 0x80, 0x0f, 0x69, 0xa9, 0x66, 0x7c, 0xfd, 0x2b,
-  0xf3, 0xf0, 0x48, 0xc1, 0x74, 0x59, 0xed, 0x26, 0x93, 0x47, 0x0a, 0xa6, 0x63, 0xf5, 0x97, 0xf3,
-  0x90, 0x96, 0x6a, 0xc6, 0xc0, 0x40, 0x20, 0x5f, 0xfa, 0x4a, 0x47, 0x0f, 0x67, 0x80, 0x29, 0xb1,
-  0xc5, 0xbb, 0x20, 0xa1, 0xad, 0xad, 0x0d, 0x8f, 0x3f, 0xfe, 0x78, 0x5c, 0xe7, 0xb4, 0xdb, 0xed,
-  0x9a, 0x05, 0xa2, 0x5a, 0x9e, 0x5b, 0xae, 0xd2, 0xd2, 0x52, 0xcd, 0x02, 0x51, 0x2d, 0xcf, 0xad,
-  0x17, 0x6e, 0xb7, 0x1b, 0x73, 0xe6, 0xcc, 0x89, 0x7b, 0x26, 0x58, 0xaf, 0x8b, 0x92, 0xf4, 0xac,
-  0xb6, 0xb6, 0x36, 0x61, 0xaf, 0x99, 0xdd, 0x6e, 0xc7, 0xbc, 0x79, 0xf3, 0x14, 0x7b, 0xbf, 0xf1,
-  0x78, 0x3c, 0x68, 0x6a, 0x6a, 0xc2, 0x84, 0x09, 0x13, 0x12, 0x7a, 0x41, 0xa5, 0x16, 0x63, 0xd0,
-  0x70, 0x7e, 0x3f, 0xf0, 0xf6, 0xe1, 0x8f, 0x30, 0x30, 0xe8, 0xc7, 0xed, 0x9e, 0x01, 0x0c, 0x0c,
-  0xfa, 0x60, 0x4e, 0x9d, 0x84, 0x1d, 0x2f, 0xaf, 0xc1, 0xd4, 0x29, 0x13, 0x64, 0xb7, 0x9f, 0xe8,
-  0xa6, 0x4e, 0x99, 0x80, 0x1d, 0x2f, 0xaf, 0x41, 0x4a, 0x5a, 0x26, 0x06, 0x06, 0x7d, 0x77, 0xaf,
-  0x91, 0x1f, 0x6f, 0x1f, 0xfe, 0x08, 0x7e, 0x7f, 0x7c, 0x6d, 0x8a, 0x0b, 0x80, 0x2d, 0x11, 0x12,
-  0xb6, 0xc7, 0x4d, 0x00, 0x24, 0xc6, 0xdb, 0x14, 0x5e, 0x41, 0x41, 0x41, 0x4c, 0xab, 0x98, 0x1b,
-  0x1a, 0x1a, 0x64, 0xcf, 0x36, 0xd8, 0xed, 0x76, 0x14, 0x15, 0x15, 0x69, 0xb2, 0x7a, 0xda, 0x6e,
-  0xb7, 0xe3, 0xd9, 0x67, 0x9f, 0x15, 0xbe, 0x12, 0x59, 0x0d, 0xa5, 0xa5, 0xa5, 0xd8, 0xb0, 0x61,
-  0x83, 0x26, 0x7d, 0xd7, 0xf2, 0xdc, 0x7a, 0xb2, 0x6c, 0xd9, 0x32, 0xd4, 0xd6, 0xd6, 0x46, 0x3d,
-  0x1b, 0xdc, 0xde, 0xde, 0x8e, 0x67, 0x9f, 0x7d, 0x36, 0x61, 0x03, 0x39, 0x2d, 0xb4, 0xb4, 0xb4,
-  0xa0, 0xa8, 0xa8, 0x28, 0xa1, 0x03, 0x3b, 0x20, 0x70, 0xd3, 0x64, 0xb7, 0xdb, 0x21, 0x49, 0x12,
-  0x9a, 0x9a, 0x9a, 0x84, 0xa4, 0xd1, 0x1c, 0x3a, 0x74, 0x08, 0xb5, 0xb5, 0xb5, 0x98, 0x30, 0x61,
-  0x42, 0xd2, 0xfc, 0x4c, 0x69, 0x31, 0x06, 0x0d, 0x77, 0xb4, 0xe5, 0x2a, 0x2e, 0x5d, 0xf1, 0xa0,
-  0xb7, 0xd7, 0x8b, 0x4f, 0xae, 0xf7, 0xc2, 0xe7, 0xeb, 0x45, 0x4e, 0x76, 0x16, 0xf6, 0xbe, 0x5e,
-  0x81, 0x29, 0x59, 0xc6, 0xad, 0xa2, 0x35, 0x25, 0xcb, 0x82, 0xbd, 0xaf, 0x57, 0x20, 0x27, 0x3b,
-  0x0b, 0x3e, 0x5f, 0x2f, 0x3e, 0xb9, 0xde, 0x8b, 0xde, 0x5e, 0x2f, 0x2e, 0x5d, 0xf1, 0xe0, 0x68,
-  0xcb, 0xd5, 0xb8, 0xdb, 0x95, 0x00, 0xc4, 0x19, 0x3b, 0x8f, 0xf2, 0x9d, 0x7a, 0xc0, 0x92, 0x89,
-  0x90, 0xa1, 0xb8, 0x24, 0x01, 0xbd, 0x3d, 0xc0, 0xce, 0x5a, 0xe0, 0xf6, 0x4d, 0x21, 0xa7, 0x33,
-  0x8a, 0x8e, 0x8e, 0x0e, 0xe1, 0x3b, 0x8e, 0x45, 0xaa, 0x71, 0xda, 0xda, 0xda, 0x8a, 0xfc, 0xfc,
-  0x7c, 0x21, 0x6d, 0xc5, 0xc3, 0x66, 0xb3, 0x61, 0xf5, 0xea, 0xd5, 0x58, 0xbe, 0x7c, 0xf9, 0x3d,
-  0xc5, 0xd7, 0x5b, 0x5a, 0x5a, 0x70, 0xf6, 0xec, 0x59, 0xc5, 0xde, 0x70, 0x1d, 0x0e, 0x07, 0xb2,
-  0xb3, 0xb3, 0x85, 0xd6, 0x1e, 0x8d, 0xa6, 0x0e, 0x70, 0xf0, 0x7b, 0xd6, 0xc3, 0x5e, 0xf5, 0xb1,
-  0xd6, 0x01, 0x56, 0xaa, 0xef, 0xd1, 0xfc, 0x6c, 0xa9, 0x75, 0x6e, 0x11, 0xf5, 0x68, 0x95, 0xac,
-  0x2d, 0x5c, 0x51, 0x51, 0x81, 0x85, 0x0b, 0x17, 0xa2, 0xac, 0xac, 0x0c, 0x16, 0xcb, 0xd0, 0x40,
-  0xe9, 0xf1, 0x78, 0xe0, 0x74, 0x3a, 0x71, 0xe6, 0xcc, 0x19, 0xc5, 0x72, 0x32, 0x95, 0xbc, 0x36,
-  0x5a, 0xd4, 0x01, 0x6e, 0x6b, 0x6b, 0xc3, 0xc9, 0x93, 0x27, 0xb1, 0x6b, 0xd7, 0x2e, 0x59, 0x39,
-  0x9d, 0x7a, 0xff, 0x99, 0x01, 0x80, 0x9a, 0x9a, 0x1a, 0xe4, 0xe4, 0xe4, 0x00, 0xc0, 0x98, 0xf5,
-  0x7f, 0x3b, 0x3b, 0x3b, 0xff, 0x52, 0x86, 0x4f, 0xc9, 0x9f, 0xa5, 0x20, 0x23, 0x8f, 0x41, 0xf3,
-  0x3f, 0x3d, 0x19, 0x3f, 0xfc, 0xdb, 0x85, 0x18, 0x97, 0x61, 0xc6, 0xa7, 0x66, 0x4e, 0xc0, 0xac,
-  0xec, 0x99, 0x48, 0x19, 0x37, 0x1b, 0x97, 0xae, 0x0e, 0xe2, 0x5b, 0xcf, 0xbd, 0x8e, 0x5f, 0x9d,
-  0xba, 0xa0, 0xc8, 0x79, 0xf5, 0x6a, 0xc9, 0xa2, 0x5c, 0xec, 0xf8, 0xc9, 0x5a, 0xcc, 0x9e, 0x91,
-  0x82, 0xc1, 0x3b, 0x97, 0xf0, 0xf1, 0xe5, 0x2b, 0xf8, 0xe8, 0xca, 0x6d, 0xdc, 0xe9, 0xf5, 0xe2,
-  0xef, 0x7e, 0x72, 0x06, 0x67, 0x7f, 0x7f, 0x33, 0xee, 0xb6, 0xc5, 0x05, 0xc0, 0x44, 0x44, 0x44,
-  0x44, 0x24, 0xcb, 0x97, 0xbf, 0x98, 0x83, 0x35, 0x5f, 0x9d, 0x83, 0xf4, 0x74, 0x33, 0x66, 0x4f,
-  0xb7, 0x60, 0x56, 0xf6, 0x0c, 0xa4, 0x64, 0xcc, 0x06, 0xcc, 0x99, 0x78, 0xeb, 0xe7, 0xa7, 0xf1,
-  0x8f, 0x3f, 0x3b, 0x8a, 0x0f, 0x4e, 0x27, 0x77, 0xdd, 0xfb, 0x25, 0x8b, 0x72, 0xf1, 0xad, 0x6f,
-  0x2c, 0xc7, 0xd3, 0x4f, 0x2e, 0x02, 0xbc, 0x5d, 0x18, 0xec, 0xbd, 0x84, 0x8f, 0x2f, 0x5f, 0xc5,
-  0xa5, 0xbb, 0xe5, 0xe2, 0xde, 0xf8, 0x97, 0x0b, 0xf8, 0xb7, 0x7f, 0xbf, 0x28, 0xeb, 0x1c, 0x0c,
-  0x80, 0x89, 0x88, 0x88, 0x88, 0x74, 0xe4, 0x1b, 0x5f, 0x9b, 0x8b, 0x2f, 0xd9, 0x66, 0x23, 0x3d,
-  0xcd, 0x84, 0xec, 0x19, 0x16, 0xcc, 0xce, 0x9e, 0x06, 0x73, 0xfa, 0x74, 0x98, 0x52, 0x26, 0x41,
-  0x32, 0x8f, 0xc7, 0xb5, 0xce, 0x6e, 0xfc, 0xfa, 0xc3, 0x3f, 0xe0, 0xf2, 0xc7, 0xd7, 0xd1, 0xd7,
-  0x37, 0xa8, 0x75, 0x77, 0x85, 0x48, 0x4f, 0x4f, 0x41, 0xf6, 0xac, 0x29, 0x78, 0xe4, 0x73, 0x0f,
-  0x62, 0xba, 0x75, 0x22, 0xfc, 0xde, 0x1e, 0xf8, 0x06, 0x6f, 0xc1, 0xdb, 0x77, 0x0d, 0x97, 0x2e,
-  0x77, 0xe0, 0xf2, 0x55, 0x0f, 0xfa, 0xfa, 0x7d, 0x78, 0xc7, 0x75, 0x09, 0x3f, 0xfb, 0xe7, 0xf3,
-  0xb2, 0xcf, 0xc7, 0x00, 0x98, 0x88, 0x88, 0x88, 0x48, 0x67, 0xbe, 0xfc, 0xc5, 0x1c, 0x3c, 0xfb,
-  0x54, 0x2e, 0xc6, 0x65, 0x98, 0x91, 0x95, 0x99, 0x8e, 0xd9, 0x33, 0x2d, 0xb0, 0x4c, 0x9c, 0x0a,
-  0x73, 0x6a, 0x16, 0x24, 0x73, 0x06, 0x24, 0x53, 0x06, 0x24, 0xf3, 0x78, 0x48, 0x52, 0x8a, 0xd6,
-  0x5d, 0x15, 0xc2, 0xef, 0x1f, 0x84, 0xdf, 0xdb, 0x03, 0xbf, 0xaf, 0x17, 0x7e, 0x6f, 0x2f, 0xbc,
-  0x03, 0x37, 0xe0, 0xe9, 0xfe, 0x04, 0x97, 0xae, 0x78, 0x70, 0xa3, 0xab, 0x0f, 0x77, 0x7a, 0xbd,
-  0x68, 0xde, 0xd7, 0x2e, 0x7b, 0xe6, 0x37, 0x88, 0x01, 0x30, 0x11, 0x11, 0x11, 0x91, 0x0e, 0x3d,
-  0x34, 0x67, 0x32, 0xbe, 0xbd, 0xe6, 0x21, 0xcc, 0x9a, 0x3e, 0x1e, 0x69, 0xa9, 0x26, 0x4c, 0x9e,
-  0x94, 0x8e, 0xfb, 0xb2, 0xd2, 0x31, 0x71, 0x42, 0x2a, 0xc6, 0x8d, 0x9b, 0x04, 0x53, 0xda, 0x54,
-  0x98, 0xcc, 0xc9, 0xb1, 0x6d, 0xb2, 0xcf, 0xdb, 0x0b, 0x5f, 0xff, 0x27, 0xb8, 0x73, 0xe7, 0x16,
-  0xba, 0x6f, 0x0f, 0xe0, 0xcf, 0x37, 0xfa, 0x70, 0xf3, 0x56, 0x1f, 0xfa, 0x07, 0x7c, 0xf8, 0xf8,
-  0x5a, 0x0f, 0xb6, 0xbf, 0xf9, 0xff, 0x64, 0xe5, 0xfc, 0x8e, 0xc6, 0x00, 0x98, 0x88, 0x88, 0x88,
-  0x48, 0xa7, 0x52, 0x52, 0x4c, 0xb0, 0x15, 0xce, 0xc0, 0x93, 0x45, 0x9f, 0xc2, 0xf4, 0xfb, 0xc7,
-  0x41, 0x92, 0x80, 0x14, 0xb3, 0x09, 0x13, 0x27, 0xa4, 0x62, 0xea, 0x94, 0x0c, 0x8c, 0x4b, 0x37,
-  0x6b, 0xdd, 0x45, 0x21, 0xee, 0xf4, 0x05, 0xaa, 0x5f, 0x74, 0xdf, 0x1e, 0xc0, 0xa0, 0xd7, 0x07,
-  0xbf, 0x1f, 0xb8, 0xf6, 0xa7, 0x3b, 0xf8, 0xf9, 0x91, 0x8f, 0xe0, 0x6a, 0xb9, 0x8a, 0xc1, 0x41,
-  0x9f, 0xd0, 0xf3, 0x31, 0x00, 0x26, 0x22, 0x22, 0x22, 0xd2, 0x39, 0x49, 0x02, 0xe6, 0xe5, 0x4e,
-  0xc6, 0xe7, 0x3e, 0x3b, 0x05, 0x79, 0x0f, 0x66, 0x62, 0xc6, 0xb4, 0xf1, 0x98, 0x68, 0x49, 0x45,
-  0x5a, 0x6a, 0x72, 0x94, 0x98, 0xed, 0x1f, 0xf0, 0xa1, 0xdb, 0x33, 0x80, 0xab, 0x1d, 0x3d, 0x70,
-  0xff, 0xa1, 0x0b, 0x1f, 0xfe, 0xf6, 0x3a, 0xce, 0xb5, 0xdf, 0x8c, 0xbb, 0xce, 0x6f, 0x24, 0x0c,
-  0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x92, 0xe3, 0xb6, 0x81, 0x88, 0x88, 0x88, 0x88, 0x28,
-  0x4a, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13, 0x11, 0x11, 0x11, 0x91,
-  0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00, 0x4c, 0x44, 0x44, 0x44, 0x44,
-  0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01, 0x30, 0x11, 0x11, 0x11, 0x11,
-  0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06, 0xc0, 0x44, 0x44, 0x44, 0x44,
-  0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13, 0x11, 0x11, 0x11,
-  0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00, 0x4c, 0x44, 0x44, 0x44,
-  0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01, 0x30, 0x11, 0x11, 0x11,
-  0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06, 0xc0, 0x44, 0x44, 0x44,
-  0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13, 0x11, 0x11,
-  0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00, 0x4c, 0x44, 0x44,
-  0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01, 0x30, 0x11, 0x11,
-  0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06, 0xc0, 0x44, 0x44,
-  0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13, 0x11,
-  0x11, 0x11, 0x91, 0xa1, 0x30, 0x00, 0x26, 0x22, 0x22, 0x22, 0x22, 0x43, 0x61, 0x00, 0x4c, 0x44,
-  0x44, 0x44, 0x44, 0x86, 0xc2, 0x00, 0x98, 0x88, 0x88, 0x88, 0x88, 0x0c, 0x85, 0x01, 0x30, 0x11,
-  0x11, 0x11, 0x11, 0x19, 0x0a, 0x03, 0x60, 0x22, 0x22, 0x22, 0x22, 0x32, 0x14, 0x06, 0xc0, 0x44,
-  0x44, 0x44, 0x44, 0x64, 0x28, 0x0c, 0x80, 0x89, 0x88, 0x88, 0x88, 0xc8, 0x50, 0x18, 0x00, 0x13,
-  0x11, 0x11, 0x11, 0x91, 0xa1, 0xfc, 0x7f, 0x59, 0xe0, 0x73, 0x52, 0x7c, 0xd0, 0xac, 0x5c, 0x00,
-  0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int banner_len = 9803;
@@ -11,15 +11,25 @@ INCLUDE_DIRS := \
 
 ANDROID_SOURCES_C := \
 	../src/libretro.c \
+	../src/asset.c \
+	../src/batch.c \
+	../src/blit.c \
 	../src/intv.c \
 	../src/memory.c \
 	../src/cp1610.c \
 	../src/cart.c \
+	../src/cartdb.c \
 	../src/controller.c \
 	../src/osd.c \
 	../src/ivoice.c \
+	../src/mixer.c \
+	../src/perf.c \
 	../src/psg.c \
+	../src/rewind.c \
+	../src/runahead.c \
+	../src/state.c \
 	../src/stic.c \
+	../src/timeline.c \
 	../src/stb_image_impl.c \
 	../src/deps/libretro-common/file/file_path.c \
 	../src/deps/libretro-common/compat/compat_posix_string.c \
@@ -35,6 +45,6 @@ include $(CLEAR_VARS)
 LOCAL_MODULE    := retro
 LOCAL_SRC_FILES := $(ANDROID_SOURCES_C)
 LOCAL_C_INCLUDES := $(INCLUDE_DIRS)
-LOCAL_CFLAGS    := -DANDROID -D__LIBRETRO__ -DHAVE_STRINGS_H -DRIGHTSHIFT_IS_SAR
+LOCAL_CFLAGS    := -DANDROID -D__LIBRETRO__ -DHAVE_STRINGS_H -DRIGHTSHIFT_IS_SAR -DHAVE_PTHREAD
 LOCAL_LDFLAGS   := -Wl,-version-script=$(CORE_DIR)/link.T
 include $(BUILD_SHARED_LIBRARY)
@@ -0,0 +1,93 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdlib.h>
+#include "asset.h"
+#include "stb_image.h"
+
+// An RLE image is a series of packets covering width x height pixels in
+// order.  A control byte c below 0x80 is followed by c + 1 pixels, from
+// 0x80 up by one pixel repeated c - 0x7F times.  Pixels are 4 bytes,
+// A R G B, and fully transparent ones are stored as 0 so they form runs.
+static int decodeRLE(uint32_t *dst, uint32_t count, const unsigned char *src, unsigned int size)
+{
+	const unsigned char *end = src + size;
+	uint32_t *last = dst + count;
+	uint32_t pixel;
+	int n, literal;
+
+	while (dst < last)
+	{
+		if (src >= end)
+			return 0;
+		literal = *src < 0x80;
+		n = literal ? *src + 1 : *src - 0x7F;
+		src++;
+		if (n > last - dst || (literal ? n : 1) * 4 > end - src)
+			return 0;
+		if (literal)
+		{
+			for (; n > 0; n--, src += 4)
+				*dst++ = ((uint32_t)src[0] << 24) | (src[1] << 16) | (src[2] << 8) | src[3];
+		}
+		else
+		{
+			pixel = ((uint32_t)src[0] << 24) | (src[1] << 16) | (src[2] << 8) | src[3];
+			src += 4;
+			for (; n > 0; n--)
+				*dst++ = pixel;
+		}
+	}
+	return src == end;
+}
+
+static int decodePNG(uint32_t *dst, int width, int height, const unsigned char *src, unsigned int size)
+{
+	unsigned char *rgba, *p;
+	int w, h, channels, i;
+
+	rgba = stbi_load_from_memory(src, (int)size, &w, &h, &channels, 4);
+	if (rgba == NULL)
+		return 0;
+	if (w == width && h == height)
+	{
+		for (i = 0, p = rgba; i < width * height; i++, p += 4)
+			dst[i] = ((uint32_t)p[3] << 24) | (p[0] << 16) | (p[1] << 8) | p[2];
+	}
+	stbi_image_free(rgba);
+	return w == width && h == height;
+}
+
+uint32_t *AssetDecode(const struct Asset *asset)
+{
+	uint32_t count = (uint32_t)asset->width * asset->height;
+	uint32_t *pixels = (uint32_t *)malloc(count * sizeof(uint32_t));
+	int ok;
+
+	if (pixels == NULL)
+		return NULL;
+	if (asset->format == ASSET_RLE)
+		ok = decodeRLE(pixels, count, asset->data, asset->size);
+	else
+		ok = decodePNG(pixels, asset->width, asset->height, asset->data, asset->size);
+	if (!ok)
+	{
+		free(pixels);
+		return NULL;
+	}
+	return pixels;
+}
@@ -0,0 +1,43 @@
+#ifndef ASSET_H
+#define ASSET_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Images compiled into the core.  asset_data.h is generated from the PNGs
+// in Assets/ by "make assets" (tools/mkassets.c), which stores each one
+// run-length coded or, if that comes out bigger, as the PNG itself.
+#include <stdint.h>
+
+enum AssetFormat {
+	ASSET_RLE, // packets of ARGB pixels, see asset.c
+	ASSET_PNG
+};
+
+struct Asset {
+	int width;
+	int height;
+	enum AssetFormat format;
+	const unsigned char *data;
+	unsigned int size;
+};
+
+// Returns the image as malloc'd ARGB pixels, alpha in the top byte and
+// not premultiplied (see blit.h), NULL if the data is bad or out of memory
+uint32_t *AssetDecode(const struct Asset *asset);
+
+#endif
@@ -0,0 +1,272 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdlib.h>
+#include "batch.h"
+#include "intv.h"
+#include "memory.h"
+#include "cart.h"
+#include "controller.h"
+#include "mixer.h"
+#include "psg.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+
+struct BatchWorker {
+	struct Batch *batch;
+	int index;
+};
+#endif
+
+struct BatchSlot {
+	struct Machine *machine;
+	int16_t audio[MIXER_MAX_SAMPLES * 2];
+};
+
+struct Batch {
+	int count;
+	struct BatchSlot *slots;
+	struct BatchOutput *outputs;
+
+#ifdef HAVE_PTHREAD
+	// Worker t steps machines t, t + threads, t + 2 * threads...  The
+	// caller is worker 0.  Each step bumps generation and waits for
+	// pending to drop back to 0.
+	int threads;
+	pthread_t workers[BATCH_MAX_THREADS];
+	struct BatchWorker args[BATCH_MAX_THREADS];
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t finish;
+	unsigned int generation;
+	int pending;
+	int quit;
+#endif
+};
+
+static void stepMachine(struct Batch *batch, int i)
+{
+	struct BatchSlot *slot = &batch->slots[i];
+	struct Machine *m = slot->machine;
+
+	if (m->halt)
+	{
+		batch->outputs[i].samples = 0;
+		batch->outputs[i].halted = 1;
+		return;
+	}
+	Run(m);
+	MixerFrame(m, slot->audio);
+	PSGFrame(m);
+	batch->outputs[i].samples = MixerSamples;
+	batch->outputs[i].halted = m->halt;
+}
+
+#ifdef HAVE_PTHREAD
+static void stepShare(struct Batch *batch, int worker)
+{
+	int i;
+
+	for (i = worker; i < batch->count; i += batch->threads)
+		stepMachine(batch, i);
+}
+
+static void *workerMain(void *arg)
+{
+	struct BatchWorker *w = (struct BatchWorker *)arg;
+	struct Batch *batch = w->batch;
+	unsigned int seen = 0;
+
+	pthread_mutex_lock(&batch->lock);
+	for (;;)
+	{
+		while (batch->generation == seen && !batch->quit)
+			pthread_cond_wait(&batch->start, &batch->lock);
+		if (batch->quit)
+			break;
+		seen = batch->generation;
+		pthread_mutex_unlock(&batch->lock);
+
+		stepShare(batch, w->index);
+
+		pthread_mutex_lock(&batch->lock);
+		if (--batch->pending == 0)
+			pthread_cond_signal(&batch->finish);
+	}
+	pthread_mutex_unlock(&batch->lock);
+	return NULL;
+}
+#endif
+
+struct Batch *BatchCreate(int count, int threads, const char *execPath, const char *gromPath, const char *cartPath)
+{
+	struct Batch *batch;
+	struct Machine *first;
+	int i;
+
+	if (count < 1)
+		return NULL;
+	batch = (struct Batch *)calloc(1, sizeof(struct Batch));
+	if (batch == NULL)
+		return NULL;
+	batch->slots = (struct BatchSlot *)calloc(count, sizeof(struct BatchSlot));
+	batch->outputs = (struct BatchOutput *)calloc(count, sizeof(struct BatchOutput));
+	if (batch->slots == NULL || batch->outputs == NULL)
+	{
+		BatchDestroy(batch);
+		return NULL;
+	}
+
+	// the filters are shared, make sure they exist for the current rate
+	MixerInit(MixerRate);
+
+	// boot one machine, the rest start as copies of it
+	first = MachineCreate();
+	if (first == NULL || !loadExec(first, execPath) || !loadGrom(first, gromPath) || !LoadCart(first, cartPath))
+	{
+		MachineDestroy(first);
+		BatchDestroy(batch);
+		return NULL;
+	}
+	MemoryTouchAll(first);
+	// everyone reads the BIOS and cart from one copy
+	if (!MemoryShare(first))
+	{
+		MachineDestroy(first);
+		BatchDestroy(batch);
+		return NULL;
+	}
+	for (i = 0; i < count; i++)
+	{
+		batch->slots[i].machine = i == 0 ? first : MachineClone(first);
+		if (batch->slots[i].machine == NULL)
+		{
+			batch->count = i;
+			BatchDestroy(batch);
+			return NULL;
+		}
+		batch->outputs[i].frame = batch->slots[i].machine->stic.frame;
+		batch->outputs[i].audio = batch->slots[i].audio;
+		batch->outputs[i].memory = batch->slots[i].machine->MemoryPage;
+		batch->count = i + 1;
+	}
+
+#ifdef HAVE_PTHREAD
+	if (threads < 1 || threads > count)
+		threads = count;
+	if (threads > BATCH_MAX_THREADS)
+		threads = BATCH_MAX_THREADS;
+	batch->threads = 1;
+	pthread_mutex_init(&batch->lock, NULL);
+	pthread_cond_init(&batch->start, NULL);
+	pthread_cond_init(&batch->finish, NULL);
+	for (i = 1; i < threads; i++)
+	{
+		batch->args[i].batch = batch;
+		batch->args[i].index = i;
+		if (pthread_create(&batch->workers[i], NULL, workerMain, &batch->args[i]) != 0)
+			break;
+		batch->threads = i + 1;
+	}
+#else
+	(void)threads;
+#endif
+	return batch;
+}
+
+void BatchDestroy(struct Batch *batch)
+{
+	int i;
+
+	if (batch == NULL)
+		return;
+#ifdef HAVE_PTHREAD
+	if (batch->threads > 0)
+	{
+		pthread_mutex_lock(&batch->lock);
+		batch->quit = 1;
+		pthread_cond_broadcast(&batch->start);
+		pthread_mutex_unlock(&batch->lock);
+		for (i = 1; i < batch->threads; i++)
+			pthread_join(batch->workers[i], NULL);
+		pthread_cond_destroy(&batch->finish);
+		pthread_cond_destroy(&batch->start);
+		pthread_mutex_destroy(&batch->lock);
+	}
+#endif
+	if (batch->slots)
+	{
+		for (i = 0; i < batch->count; i++)
+			MachineDestroy(batch->slots[i].machine);
+	}
+	free(batch->slots);
+	free(batch->outputs);
+	free(batch);
+}
+
+int BatchCount(const struct Batch *batch)
+{
+	return batch->count;
+}
+
+void BatchSetInput(struct Batch *batch, int index, int player, int state)
+{
+	if (index < 0 || index >= batch->count)
+		return;
+	setControllerInput(batch->slots[index].machine, player & 1, state);
+}
+
+void BatchReset(struct Batch *batch, int index)
+{
+	if (index < 0 || index >= batch->count)
+		return;
+	Reset(batch->slots[index].machine);
+}
+
+void BatchStep(struct Batch *batch)
+{
+#ifdef HAVE_PTHREAD
+	if (batch->threads > 1)
+	{
+		pthread_mutex_lock(&batch->lock);
+		batch->pending = batch->threads - 1;
+		batch->generation++;
+		pthread_cond_broadcast(&batch->start);
+		pthread_mutex_unlock(&batch->lock);
+
+		stepShare(batch, 0);
+
+		pthread_mutex_lock(&batch->lock);
+		while (batch->pending > 0)
+			pthread_cond_wait(&batch->finish, &batch->lock);
+		pthread_mutex_unlock(&batch->lock);
+		return;
+	}
+#endif
+	{
+		int i;
+
+		for (i = 0; i < batch->count; i++)
+			stepMachine(batch, i);
+	}
+}
+
+const struct BatchOutput *BatchOutputs(const struct Batch *batch)
+{
+	return batch->outputs;
+}
@@ -0,0 +1,59 @@
+#ifndef BATCH_H
+#define BATCH_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdint.h>
+
+// Batched stepping: many independent machines running the same cart,
+// advanced one frame at a time by a single call.  Meant for bots and
+// regression farms linking the core directly, without a frontend per
+// machine.  With HAVE_PTHREAD the machines are split across a pool of
+// worker threads; without it they are stepped in turn.  None of these
+// calls may overlap each other on the same batch.
+
+struct Batch;
+
+// What a machine produced in the last step, valid until the next one
+struct BatchOutput {
+	const unsigned int *frame; // 352x224 xRGB8888
+	const int16_t *audio; // interleaved stereo
+	int samples; // stereo samples in audio, MixerSamples
+	const unsigned int *const *memory; // MEMORY_PAGES pages of MEMORY_PAGE_SIZE words, see MemoryPeek()
+	int halted; // hit HLT or a bad opcode, stays put from then on
+};
+
+// count machines booted with the same BIOS and cart, threads includes the
+// caller's (0 picks one per machine, capped at BATCH_MAX_THREADS).
+// Returns NULL if anything fails to load.
+#define BATCH_MAX_THREADS 64
+struct Batch *BatchCreate(int count, int threads, const char *execPath, const char *gromPath, const char *cartPath);
+void BatchDestroy(struct Batch *batch);
+
+int BatchCount(const struct Batch *batch);
+
+// Sets a controller (0 right, 1 left) for the next step.  state is a
+// combination of the K_, D_ and B_ codes in controller.c, 0 for released.
+void BatchSetInput(struct Batch *batch, int index, int player, int state);
+
+void BatchReset(struct Batch *batch, int index); // presses the reset button
+
+void BatchStep(struct Batch *batch); // runs every machine one frame
+
+const struct BatchOutput *BatchOutputs(const struct Batch *batch); // BatchCount entries
+
+#endif
@@ -0,0 +1,147 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <string.h>
+#include "blit.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLIT_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BLIT_NEON
+#include <arm_neon.h>
+#endif
+
+void BlitScale2x(uint32_t *dst, int dstPitch, const uint32_t *src, int width, int height)
+{
+	int x, y;
+	uint32_t *row;
+
+	for (y = 0; y < height; y++)
+	{
+		row = dst + y * 2 * dstPitch;
+		x = 0;
+#if defined(BLIT_SSE2)
+		for (; x + 4 <= width; x += 4)
+		{
+			__m128i p = _mm_loadu_si128((const __m128i *)(src + x));
+			_mm_storeu_si128((__m128i *)(row + x * 2), _mm_unpacklo_epi32(p, p));
+			_mm_storeu_si128((__m128i *)(row + x * 2 + 4), _mm_unpackhi_epi32(p, p));
+		}
+#elif defined(BLIT_NEON)
+		for (; x + 4 <= width; x += 4)
+		{
+			uint32x4_t p = vld1q_u32(src + x);
+			uint32x4x2_t z = vzipq_u32(p, p);
+			vst1q_u32(row + x * 2, z.val[0]);
+			vst1q_u32(row + x * 2 + 4, z.val[1]);
+		}
+#endif
+		for (; x < width; x++)
+		{
+			row[x * 2] = src[x];
+			row[x * 2 + 1] = src[x];
+		}
+		memcpy(row + dstPitch, row, width * 2 * sizeof(uint32_t));
+		src += width;
+	}
+}
+
+// Each channel is (over * a + under * (255 - a)) / 255, which is at most
+// 255 * 255 and so fits 16 bits.  The divide is exact for that range:
+// v / 255 == (v + 1 + (v >> 8)) >> 8.
+void BlitBlendRow(uint32_t *dst, const uint32_t *under, const uint32_t *over, int count)
+{
+	int i;
+	uint32_t s, d, a, ia, c, out;
+
+	i = 0;
+#if defined(BLIT_SSE2)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i one = _mm_set1_epi16(1);
+		const __m128i full = _mm_set1_epi16(255);
+		const __m128i amask = _mm_set1_epi32((int)0xFF000000);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i sp = _mm_loadu_si128((const __m128i *)(over + i));
+			__m128i dp = _mm_loadu_si128((const __m128i *)(under + i));
+			__m128i lo, hi, s16, d16, a16, v, clear;
+
+			// two pixels per register, one 16-bit lane per channel
+			s16 = _mm_unpacklo_epi8(sp, zero);
+			d16 = _mm_unpacklo_epi8(dp, zero);
+			a16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xFF), 0xFF);
+			v = _mm_add_epi16(_mm_mullo_epi16(s16, a16), _mm_mullo_epi16(d16, _mm_sub_epi16(full, a16)));
+			lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, one), _mm_srli_epi16(v, 8)), 8);
+
+			s16 = _mm_unpackhi_epi8(sp, zero);
+			d16 = _mm_unpackhi_epi8(dp, zero);
+			a16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xFF), 0xFF);
+			v = _mm_add_epi16(_mm_mullo_epi16(s16, a16), _mm_mullo_epi16(d16, _mm_sub_epi16(full, a16)));
+			hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, one), _mm_srli_epi16(v, 8)), 8);
+
+			// transparent pixels keep under, everything else is opaque
+			clear = _mm_cmpeq_epi32(_mm_and_si128(sp, amask), zero);
+			v = _mm_or_si128(_mm_packus_epi16(lo, hi), amask);
+			v = _mm_or_si128(_mm_and_si128(clear, dp), _mm_andnot_si128(clear, v));
+			_mm_storeu_si128((__m128i *)(dst + i), v);
+		}
+	}
+#elif defined(BLIT_NEON)
+	for (; i + 8 <= count; i += 8)
+	{
+		uint8x8x4_t sp = vld4_u8((const uint8_t *)(over + i));
+		uint8x8x4_t dp = vld4_u8((const uint8_t *)(under + i));
+		uint8x8_t a = sp.val[3];
+		uint8x8_t ia = vmvn_u8(a);
+		uint8x8_t clear = vceq_u8(a, vdup_n_u8(0));
+		uint16x8_t v;
+		int ch;
+
+		// channels are deinterleaved as b, g, r, a
+		for (ch = 0; ch < 3; ch++)
+		{
+			v = vmlal_u8(vmull_u8(sp.val[ch], a), dp.val[ch], ia);
+			v = vshrq_n_u16(vaddq_u16(vaddq_u16(v, vdupq_n_u16(1)), vshrq_n_u16(v, 8)), 8);
+			sp.val[ch] = vmovn_u16(v);
+		}
+		// transparent pixels keep under, everything else is opaque
+		sp.val[3] = vdup_n_u8(255);
+		for (ch = 0; ch < 4; ch++)
+			sp.val[ch] = vbsl_u8(clear, dp.val[ch], sp.val[ch]);
+		vst4_u8((uint8_t *)(dst + i), sp);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		s = over[i];
+		d = under[i];
+		a = s >> 24;
+		if (a == 0)
+		{
+			dst[i] = d;
+			continue;
+		}
+		ia = 255 - a;
+		out = 0xFF000000;
+		for (c = 0; c < 24; c += 8)
+			out |= ((((s >> c) & 0xFF) * a + ((d >> c) & 0xFF) * ia) / 255) << c;
+		dst[i] = out;
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef BLIT_H
+#define BLIT_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdint.h>
+
+// Pixels are 32-bit ARGB, alpha in the top byte.
+
+// Scales a width x height image up 2x into dst, pitch in pixels
+void BlitScale2x(uint32_t *dst, int dstPitch, const uint32_t *src, int width, int height);
+
+// dst[i] = over[i] alpha blended onto under[i].  dst may be under.
+// Transparent pixels leave under as is, otherwise the result is opaque.
+void BlitBlendRow(uint32_t *dst, const uint32_t *under, const uint32_t *over, int count);
+
+#endif
@@ -17,49 +17,112 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intv.h"
 #include "memory.h"
 #include "cart.h"
+#include "cartdb.h"
 #include "osd.h"
 
-int isIntellicart(void);
-int loadIntellicart(void);
-int isROM(void);
-int loadROM(void);
-int getLoadMethod(void);
-void load0(void);
-void load1(void);
-void load2(void);
-void load3(void);
-void load4(void);
-void load5(void);
-void load6(void);
-void load7(void);
-void load8(void);
-void load9(void);
-
-int data[0x20000]; // rom data loaded from file
-
-int size = 0; // size of file read
-
-int pos = 0; // current position in data
-
-int LoadCart(const char *path)
+#define CART_MAX_SIZE 0x20000 // bytes read from a rom file, the rest is ignored
+
+// A rom file on its way into a machine.  Loading only reads the file's
+// bytes, so carts can be loaded into several machines at once.  Bytes
+// past the end read as 0.
+struct CartImage {
+	struct Machine *machine;
+	const unsigned char *data; // rom file contents
+	int size; // size of file read
+	int pos; // current position in data
+};
+
+#define cartByte(img, i) ((i) < (img)->size ? (img)->data[(i)] : 0)
+
+int isIntellicart(struct CartImage *img);
+int loadIntellicart(struct CartImage *img);
+int isROM(struct CartImage *img);
+int loadROM(struct CartImage *img);
+int getLoadMethod(struct CartImage *img);
+void load0(struct CartImage *img);
+void load1(struct CartImage *img);
+void load2(struct CartImage *img);
+void load3(struct CartImage *img);
+void load4(struct CartImage *img);
+void load5(struct CartImage *img);
+void load6(struct CartImage *img);
+void load7(struct CartImage *img);
+void load8(struct CartImage *img);
+void load9(struct CartImage *img);
+
+static int loadImage(struct CartImage *img)
+{
+	int ok = 1;
+
+	OSD_drawText(8, 7, "SIZE:");
+	OSD_drawInt(14, 7, img->size, 10);
+
+    if(isIntellicart(img)) // intellicart format
+    {
+		OSD_drawText(8, 8, "INTELLICART");
+        printf("[INFO] [FREEINTV] Intellicart cartridge format detected\n");		
+        ok = loadIntellicart(img);
+    }
+    else
+    {
+		if(isROM(img))
+		{
+			OSD_drawText(8, 8, "INTELLICART");
+			OSD_drawText(8, 9, "MISSING A8!");
+			printf("[INFO] [FREEINTV] Possible Intellicart cartridge format detected\n");
+			ok = loadROM(img);
+		}
+		else
+		{
+			// check cartinfo database for load method
+			printf("[INFO] [FREEINTV] Raw ROM image. Determining load method via database.\n");		
+			switch(getLoadMethod(img))
+			{
+					case 0: load0(img); break;
+					case 1: load1(img); break;
+					case 2: load2(img); break;
+					case 3: load3(img); break;
+					case 4: load4(img); break;
+					case 5: load5(img); break;
+					case 6: load6(img); break;
+					case 7: load7(img); break;
+					case 8: load8(img); break;
+					case 9: load9(img); break;
+					default: printf("[INFO] [FREEINTV] No database match. Using default cartridge memory map.\n"); load0(img);
+			}
+		}
+    }
+	return ok;
+}
+
+int LoadCart(struct Machine *m, const char *path)
 {
-	unsigned char word[1];
 	FILE *fp;
+	struct CartImage img;
+	unsigned char *data;
+	int ok = 1;
 
     printf("[INFO] [FREEINTV] Attempting to load cartridge ROM from: %s\n", path);		
 
-	size = 0;
+	data = (unsigned char *)malloc(CART_MAX_SIZE);
+	if(data == NULL)
+	{
+		printf("[ERROR] [FREEINTV] Out of memory loading cartridge ROM.\n");
+		return 0;
+	}
+	img.machine = m;
+	img.data = data;
+	img.size = 0;
+	img.pos = 0;
 
 	if((fp = fopen(path,"rb"))!=NULL)
 	{
-		while(fread(word,sizeof(word),1,fp) && size<0x20000)
-		{
-			data[size] = word[0];
-			size++;
-		}
-        fclose(fp);
+		img.size = (int)fread(data, 1, CART_MAX_SIZE, fp);
         if (feof(fp))
         {
             printf("[INFO] [FREEINTV] Successful cartridge load: EOF indicator set\n");
@@ -68,178 +131,166 @@ int LoadCart(const char *path)
         {
             printf("[ERROR] [FREEINTV] Cartridge load error indicator set\n");
         }
-        
-		OSD_drawText(8, 7, "SIZE:");
-		OSD_drawInt(14, 7, size, 10);
+        fclose(fp);
 
-        if(isIntellicart()) // intellicart format
-        {
-			OSD_drawText(8, 8, "INTELLICART");
-            printf("[INFO] [FREEINTV] Intellicart cartridge format detected\n");		
-            return loadIntellicart();
-        }
-        else
-        {
-			if(isROM())
-			{
-				OSD_drawText(8, 8, "INTELLICART");
-				OSD_drawText(8, 9, "MISSING A8!");
-				printf("[INFO] [FREEINTV] Possible Intellicart cartridge format detected\n");
-				return loadROM();
-			}
-			else
-			{
-				// check cartinfo database for load method
-				printf("[INFO] [FREEINTV] Raw ROM image. Determining load method via database.\n");		
-				switch(getLoadMethod())
-				{
-						case 0: load0(); break;
-						case 1: load1(); break;
-						case 2: load2(); break;
-						case 3: load3(); break;
-						case 4: load4(); break;
-						case 5: load5(); break;
-						case 6: load6(); break;
-						case 7: load7(); break;
-						case 8: load8(); break;
-						case 9: load9(); break;
-						default: printf("[INFO] [FREEINTV] No database match. Using default cartridge memory map.\n"); load0();
-				}
-			}
-        }
-        return 1; // loaded okay
+		ok = loadImage(&img);
 	}
     else
     {
         printf("[ERROR] [FREEINTV] Failed to load cartridge ROM file.\n");		
-        return 0;
+        ok = 0;
     }
+	free(data);
+	return ok; // 1 - loaded okay
 }
 
-int readWord(void)
+int LoadCartData(struct Machine *m, const void *data, size_t size)
+{
+	struct CartImage img;
+
+	printf("[INFO] [FREEINTV] Loading cartridge ROM from memory, %lu bytes\n", (unsigned long)size);
+	if(data == NULL || size == 0)
+	{
+		printf("[ERROR] [FREEINTV] No cartridge ROM data.\n");
+		return 0;
+	}
+	img.machine = m;
+	img.data = (const unsigned char *)data;
+	img.size = size < CART_MAX_SIZE ? (int)size : CART_MAX_SIZE;
+	img.pos = 0;
+	return loadImage(&img);
+}
+
+int readWord(struct CartImage *img)
 {
    int val;
 
-	pos = pos * (pos<size);
-	val = (data[pos]<<8) | data[pos+1];
-	pos+=2;
+	img->pos = img->pos * (img->pos<img->size);
+	val = (cartByte(img, img->pos)<<8) | cartByte(img, img->pos+1);
+	img->pos+=2;
 	return val;
 }
 
-void loadRange(int start, int stop)
+void loadRange(struct CartImage *img, int start, int stop)
 {
-	while(start<=stop && pos<size) // load segment
-	{
-		Memory[start] = readWord();
-		start++;
-	}
+	int words = (img->size - img->pos) / 2; // whole words left in the file
+
+	if (img->pos >= img->size || start > stop)
+		return;
+	if (words > stop - start + 1)
+		words = stop - start + 1;
+	MemoryLoadWords(img->machine, start, img->data + img->pos, words);
+	img->pos += 2 * words;
+	start += words;
+	if (start <= stop && img->pos < img->size)
+		MemoryPoke(img->machine, start) = readWord(img); // odd byte at the end of the file
 }
 
 // http://spatula-city.org/~im14u2c/intv/jzintv-1.0-beta3/doc/rom_fmt/IntellicartManual.booklet.pdf
-int isIntellicart() // check for intellicart format rom
+int isIntellicart(struct CartImage *img) // check for intellicart format rom
 {
 	// check magic number (used for intellicart baud rate detection)
-	return (data[0]==0xA8); 
+	return (cartByte(img, 0)==0xA8); 
 }
 
-int isROM() // some Intellicart roms don't start with A8 for no apparent reason
+int isROM(struct CartImage *img) // some Intellicart roms don't start with A8 for no apparent reason
 {
 	// the third byte should be the 1's compliment of the second byte
-	return data[1] == (data[2]^0xFF);
+	return cartByte(img, 1) == (cartByte(img, 2)^0xFF);
 }
 
-int loadIntellicart() // load intellicart format rom
+int loadIntellicart(struct CartImage *img) // load intellicart format rom
 {
 	int start;
 	int stop;
 	int i, t;
 	int segments;
 
-	pos = 0;
-	segments = readWord() & 0xFF; // number of non-contiguous rom segments (drop magic number)
-	pos++; // 1's compliment of segments (ignore)
+	img->pos = 0;
+	segments = readWord(img) & 0xFF; // number of non-contiguous rom segments (drop magic number)
+	img->pos++; // 1's compliment of segments (ignore)
 
 	for(i=0; i<segments; i++)
 	{
-		t = readWord(); // high bytes of segment start and stop addresses
+		t = readWord(img); // high bytes of segment start and stop addresses
 		start = t & 0xFF00;
 		stop = ((t<<8) & 0xFF00) | 0xFF;
-		loadRange(start, stop);
-		t = readWord(); // CRC for segment (ignored)
+		loadRange(img, start, stop);
+		t = readWord(img); // CRC for segment (ignored)
 	}
 	// Enable tables (ignored)
 	return 1;
 }
 
-int loadROM() // load ROM formatted cart
+int loadROM(struct CartImage *img) // load ROM formatted cart
 {
-	return loadIntellicart();
+	return loadIntellicart(img);
 }
 
 // http://atariage.com/forums/topic/203179-config-files-to-use-with-various-intellivision-titles/
 
-void load0() // default - handles majority of carts
+void load0(struct CartImage *img) // default - handles majority of carts
 {
-	loadRange(0x5000, 0x6FFF);
-	loadRange(0xD000, 0xDFFF);
-	loadRange(0xF000, 0xFFFF);
+	loadRange(img, 0x5000, 0x6FFF);
+	loadRange(img, 0xD000, 0xDFFF);
+	loadRange(img, 0xF000, 0xFFFF);
 }
 
-void load1()
+void load1(struct CartImage *img)
 {
-	loadRange(0x5000, 0x6FFF);
-	loadRange(0xD000, 0xFFFF);
+	loadRange(img, 0x5000, 0x6FFF);
+	loadRange(img, 0xD000, 0xFFFF);
 }
 
-void load2()
+void load2(struct CartImage *img)
 {
-	loadRange(0x5000, 0x6FFF);
-	loadRange(0x9000, 0xBFFF);
-	loadRange(0xD000, 0xDFFF);
+	loadRange(img, 0x5000, 0x6FFF);
+	loadRange(img, 0x9000, 0xBFFF);
+	loadRange(img, 0xD000, 0xDFFF);
 }
 
-void load3()
+void load3(struct CartImage *img)
 {
-	loadRange(0x5000, 0x6FFF);
-	loadRange(0x9000, 0xAFFF);
-	loadRange(0xD000, 0xDFFF);
-	loadRange(0xF000, 0xFFFF);
+	loadRange(img, 0x5000, 0x6FFF);
+	loadRange(img, 0x9000, 0xAFFF);
+	loadRange(img, 0xD000, 0xDFFF);
+	loadRange(img, 0xF000, 0xFFFF);
 }
 
-void load4()
+void load4(struct CartImage *img)
 {
-	loadRange(0x5000, 0x6FFF);
-	d000_ram = 1; /* $D000-$D3FF = RAM 8 */
+	loadRange(img, 0x5000, 0x6FFF);
+	img->machine->d000_ram = 1; /* $D000-$D3FF = RAM 8 */
 }
 
-void load5()
+void load5(struct CartImage *img)
 {
-	loadRange(0x5000, 0x7FFF);
-	loadRange(0x9000, 0xBFFF);
+	loadRange(img, 0x5000, 0x7FFF);
+	loadRange(img, 0x9000, 0xBFFF);
 }
 
-void load6()
+void load6(struct CartImage *img)
 {
-	loadRange(0x6000, 0x7FFF);
+	loadRange(img, 0x6000, 0x7FFF);
 }
 
-void load7()
+void load7(struct CartImage *img)
 {
-	loadRange(0x4800, 0x67FF);
+	loadRange(img, 0x4800, 0x67FF);
 }
 
-void load8()
+void load8(struct CartImage *img)
 {
-	loadRange(0x5000, 0x5FFF);
-	loadRange(0x7000, 0x7FFF);
+	loadRange(img, 0x5000, 0x5FFF);
+	loadRange(img, 0x7000, 0x7FFF);
 }
 
-void load9()
+void load9(struct CartImage *img)
 {
-	loadRange(0x5000, 0x6FFF);
-	loadRange(0x9000, 0xAFFF);
-	loadRange(0xD000, 0xDFFF);
-	loadRange(0xF000, 0xFFFF);
+	loadRange(img, 0x5000, 0x6FFF);
+	loadRange(img, 0x9000, 0xAFFF);
+	loadRange(img, 0xD000, 0xDFFF);
+	loadRange(img, 0xF000, 0xFFFF);
 	// [memattr] $8800 - $8FFF = RAM 8 // is this automatic too??? 
 }
 
@@ -444,14 +495,31 @@ int fingerprints[] =
 11566, 0  // Zaxxon (1982) (Coleco)
 };
 
-int getLoadMethod() // lazy, but it works
+int getLoadMethod(struct CartImage *img)
 {
 	int i;
 	int fingerprint = 0;
+	uint32_t crc = CartCRC32(img->data, img->size);
+	const struct CartInfo *info = CartDBFind(crc);
+
+	printf("[INFO] [FREEINTV] Cartridge CRC32: %08X\n", (unsigned int)crc);
+	if(info)
+	{
+		printf("[INFO] [FREEINTV] Cartridge database match: %s, memory map %i\n", info->name, info->map);
+		if(info->flags & CART_RAM8)
+			img->machine->d000_ram = 1;
+		if(info->flags & CART_IVOICE)
+			printf("[INFO] [FREEINTV] This cartridge uses the Intellivoice\n");
+		if(info->flags & CART_ECS)
+			printf("[WARN] [FREEINTV] This cartridge needs the ECS, which is not emulated\n");
+		return info->map;
+	}
+
+	// not in the database, fall back on the fingerprint table (lazy, but it works)
 	// find fingerprint
 	for(i=0; i<256; i++)
 	{
-		fingerprint = fingerprint + data[i];
+		fingerprint = fingerprint + cartByte(img, i);
 	}
 	printf("[INFO] [FREEINTV] Cartridge fingerprint code: %i\n", fingerprint);
 	
@@ -464,7 +532,7 @@ int getLoadMethod() // lazy, but it works
 			if(fingerprint==11349)
 			{
 				// Baseball or MTE Test Cart?
-				if(size>8192) { return 8; } // load method 8 for MTE Test Cart
+				if(img->size>8192) { return 8; } // load method 8 for MTE Test Cart
 				return 0; // default method for BaseBall
 			}
 			return fingerprints[i+1];
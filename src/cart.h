@@ -18,6 +18,11 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-int LoadCart(const char *path);
+#include <stddef.h>
+
+struct Machine;
+
+int LoadCart(struct Machine *m, const char *path);
+int LoadCartData(struct Machine *m, const void *data, size_t size); // a rom file already in memory, only read
 
 #endif
\ No newline at end of file
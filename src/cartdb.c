@@ -0,0 +1,388 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cartdb.h"
+
+// Built-in entries, sorted by CRC for bsearch().  The CRCs and names are
+// the TOSEC set in metadata/, the memory maps those of the same titles in
+// the fingerprint table in cart.c, plus the bundled 4-Tris build.
+static const struct CartInfo builtin[] = {
+	{ 0x03E9E62E, 0, 0, "Tennis (1980)(Mattel)" },
+	{ 0x0458A491, 0, 0, "Royal Dealer (1981)(Mattel)[a]" },
+	{ 0x04977992, 0, 0, "Lock 'N' Chase (1982)(Mattel)[a2]" },
+	{ 0x05A06292, 0, 0, "Minehunter (2004-03-20)(Kinnen, Ryan)(PD)" },
+	{ 0x07FB9435, 0, CART_IVOICE, "TRON - Solar Sailer (1982)(Mattel)" },
+	{ 0x095638C0, 9, 0, "Triple Challenge (1986)(Intv Corp)" },
+	{ 0x0B50A367, 0, CART_ECS, "Mr. Basic Meets Bits 'N Bytes (1983)(Mattel)(ECS)" },
+	{ 0x0BF464C6, 2, 0, "Chip Shot - Super Pro Golf (1987)(Intv Corp)" },
+	{ 0x11C3BCFA, 0, 0, "Adventure -AD&D- Cloudy Mountain (1982)(Mattel)" },
+	{ 0x11FB9974, 0, 0, "Mission X (1982)(Mattel)" },
+	{ 0x12BBF7AD, 0, 0, "Baseball (1978)(Mattel)[a]" },
+	{ 0x13EE56F1, 2, 0, "Diner (1987)(Intv Corp)" },
+	{ 0x13FF363C, 7, 0, "Atlantis (1981)(Imagic)" },
+	{ 0x159AF7F7, 5, 0, "Dig Dug (1987)(Intv Corp)" },
+	{ 0x15C65DC5, 0, 0, "Zaxxon (1982)(Coleco)" },
+	{ 0x15D9D27A, 0, 0, "World Cup Football (1985)(Nice Ideas)" },
+	{ 0x15E88FCE, 0, 0, "Swords and Serpents (1982)(Imagic)" },
+	{ 0x1682D0B4, 0, 0, "Robot Rubble (1983)(Activision)(proto)[o]" },
+	{ 0x169E3584, 0, 0, "PBA Bowling (1980)(Mattel)" },
+	{ 0x16BFB8EB, 2, 0, "Super Pro Decathlon (1988)(Intv Corp)" },
+	{ 0x16C3B62F, 0, 0, "Advanced Dungeons and Dragons - Treasure of Tarmin (1982)(Mattel)" },
+	{ 0x18E08520, 0, 0, "Bouncing Pixels (1999)(-)(PD)" },
+	{ 0x1AC989E2, 0, 0, "Triple Action (1981)(Mattel)" },
+	{ 0x1ECDD51B, 0, 0, "Tag-Along Todd v3.13 (20xx)(Z., Joe - H., David)(beta)" },
+	{ 0x1F584A69, 0, 0, "Takeover (1982)(Mattel)" },
+	{ 0x20ACE89D, 0, 0, "Easter Eggs (1981)(Mattel)" },
+	{ 0x24B667B9, 0, 0, "Worm Whomper (1983)(Activision)" },
+	{ 0x275F3512, 0, 0, "Turbo (1983)(Coleco)" },
+	{ 0x291AC826, 0, 0, "Grid Shock (1982)(Mattel)" },
+	{ 0x2A4C761D, 0, 0, "Shark! Shark! (1982)(Mattel)" },
+	{ 0x2C668249, 0, 0, "Air Strike (1982)(Mattel)" },
+	{ 0x2DEACD15, 0, 0, "Stampede (1982)(Activision)" },
+	{ 0x2F9C93FC, 0, 0, "Minotaur - Treasure of Tarmin (1982)(Mattel)[h BSR]" },
+	{ 0x32076E9D, 2, 0, "Super Pro Football (1986)(Intv Corp)" },
+	{ 0x32697B72, 0, CART_IVOICE, "Bomb Squad (1982)(Mattel)" },
+	{ 0x3289C8BA, 2, 0, "Commando (1987)(Mattel)" },
+	{ 0x36E1D858, 0, 0, "Checkers (1979)(Mattel)" },
+	{ 0x37222762, 0, 0, "Frog Bog (1982)(Mattel)" },
+	{ 0x3784DC52, 0, CART_IVOICE, "Space Spartans (1981)(Mattel)" },
+	{ 0x3825C25B, 4, 0, "Land Battle (1982)(Mattel)" },
+	{ 0x39D3B895, 0, 0, "Space Hawk (1981)(Mattel)" },
+	{ 0x3B99B889, 0, 0, "Dreadnaught Factor, The (1983)(Activision)" },
+	{ 0x3D9949EA, 0, 0, "Sub Hunt (1981)(Mattel)" },
+	{ 0x4221EDE7, 0, 0, "Fathom (1983)(Imagic)" },
+	{ 0x43806375, 0, 0, "BurgerTime! (1982)(Mattel)" },
+	{ 0x43870908, 0, 0, "Carnival (1982)(Coleco-CBS)" },
+	{ 0x4422868E, 1, 0, "King of the Mountain (1982)(Mattel)" },
+	{ 0x47AA7977, 0, 0, "Safecracker (1983)(Imagic)" },
+	{ 0x4830F720, 0, 0, "Street (1981)(Mattel)" },
+	{ 0x48D74D3C, 0, 0, "Las Vegas Roulette (1979)(Mattel)" },
+	{ 0x4B23A757, 5, 0, "Congo Bongo (1983)(Sega)" },
+	{ 0x4B8C5932, 0, 0, "Happy Trails (1983)(Activision)" },
+	{ 0x4B91CF16, 0, 0, "NFL Football (1978)(Mattel)" },
+	{ 0x4CC46A04, 1, 0, "Championship Tennis (1985)(Mattel)" },
+	{ 0x4F3E3F69, 0, 0, "Ice Trek (1983)(Imagic)" },
+	{ 0x515E1D7E, 2, 0, "Body Slam - Super Pro Wrestling (1988)(Intv Corp)" },
+	{ 0x51B82EB7, 0, 0, "Super Soccer (1983)(Mattel)" },
+	{ 0x573B9B6D, 0, 0, "Masters of the Universe - The Power of He-Man! (1983)(Mattel)" },
+	{ 0x598662F2, 0, 0, "Mouse Trap (1982)(Coleco)" },
+	{ 0x5C7E9848, 0, 0, "Lock 'N' Chase (1982)(Mattel)[a]" },
+	{ 0x5E6A8CD8, 7, 0, "Demon Attack (1982)(Imagic)" },
+	{ 0x5EE2CC2A, 0, 0, "Nova Blast (1983)(Imagic)" },
+	{ 0x5F6E1AF6, 0, 0, "Motocross (1982)(Mattel)" },
+	{ 0x604611C0, 0, 0, "Las Vegas Blackjack and Poker (1979)(Mattel)" },
+	{ 0x6802B191, 2, 0, "Deep Pockets - Super Pro Pool and Billiards (1990)(Realtime)" },
+	{ 0x6B5EA9C4, 0, 0, "Mountain Madness - Super Pro Skiing (1987)(Intv Corp)" },
+	{ 0x6B6E80EE, 0, 0, "Loco-Motion (1982)(Mattel)" },
+	{ 0x6DF61A9F, 0, 0, "Donkey Kong Jr (1982)(Coleco)" },
+	{ 0x6E4E8EB4, 5, 0, "Pac-Man (1983)(Intv Corp)" },
+	{ 0x6EFA67B2, 0, 0, "Venture (1982)(Coleco)" },
+	{ 0x6F23A741, 0, 0, "Tropical Trouble (1982)(Imagic)" },
+	{ 0x6F91FBC1, 0, 0, "Armor Battle (1978)(Mattel)" },
+	{ 0x6FA698B3, 0, 0, "Tutankham (1983)(Parker Bros)" },
+	{ 0x72E11FCA, 0, 0, "Star Strike (1981)(Mattel)" },
+	{ 0x7334CD44, 0, 0, "Night Stalker (1982)(Mattel)" },
+	{ 0x734F3260, 0, 0, "Truckin' (1983)(Imagic)" },
+	{ 0x7473916D, 0, 0, "Robot Rubble (1983)(Activision)(proto)" },
+	{ 0x752FD927, 4, 0, "USCF Chess (1981)(Mattel)" },
+	{ 0x76564A13, 0, 0, "NHL Hockey (1979)(Mattel)" },
+	{ 0x7A558CF5, 0, 0, "TRON - Maze-A-Tron (1981)(Mattel)" },
+	{ 0x7C32C9B8, 0, 0, "Super Cobra (1983)(Parker Brothers)[a2]" },
+	{ 0x800B572F, 2, 0, "Slam Dunk - Super Pro Basketball (1987)(Intv Corp)" },
+	{ 0x81E7FB8C, 0, 0, "NBA Basketball (1978)(Mattel)" },
+	{ 0x82CC04F6, 0, 0, "Super Cobra (1983)(Parker Brothers)[a]" },
+	{ 0x84BEDCC1, 0, 0, "Dracula (1982)(Imagic)" },
+	{ 0x8910C37A, 0, 0, "River Raid (1983)(Activision)" },
+	{ 0x8AD19AB3, 0, CART_IVOICE, "B-17 Bomber (1981)(Mattel)" },
+	{ 0x8C9819A2, 0, 0, "Kool-Aid Man (1983)(Mattel)" },
+	{ 0x8F7D3069, 0, 0, "Super Cobra (1983)(Parker Brothers)" },
+	{ 0x8F959A6E, 0, 0, "Snafu (1981)(Mattel)" },
+	{ 0x95466AD3, 0, 0, "River Raid v1 (1983)(Activision)(proto)" },
+	{ 0x999CCEED, 0, 0, "Bump 'N' Jump (1983)(Mattel)" },
+	{ 0x99AE29A9, 0, 0, "Sea Battle (1980)(Mattel)" },
+	{ 0x9C75EFCC, 0, 0, "Pitfall! (1982)(Activision)" },
+	{ 0x9D57498F, 0, CART_ECS, "Mind Strike! (1982)(Mattel)(ECS)" },
+	{ 0x9F85015B, 0, 0, "Brickout! (1981)(Mattel)" },
+	{ 0xA12C27E1, 1, CART_ECS | CART_IVOICE, "World Series Major League Baseball (1983)(Mattel)(ECS)" },
+	{ 0xA21C31C3, 5, 0, "Pac-Man (1983)(Atarisoft)" },
+	{ 0xA3147630, 0, 0, "Hypnotic Lights (1981)(Mattel)" },
+	{ 0xA4A20354, 0, 0, "Vectron (1982)(Mattel)" },
+	{ 0xA5E28783, 0, 0, "Robot Rubble v2 (1983)(Activision)(proto)" },
+	{ 0xA60E25FC, 0, 0, "ABPA Backgammon (1978)(Mattel)" },
+	{ 0xA6840736, 0, 0, "Lady Bug (1983)(Coleco)" },
+	{ 0xA95021FC, 2, 0, "Spiker! - Super Pro Volleyball (1988)(Intv Corp)" },
+	{ 0xA982E8D5, 0, 0, "Pong (1999)(-)(PD)" },
+	{ 0xA9F1D874, 0, 0, "Minehunter (2004)(Kinnen, Ryan)" },
+	{ 0xAB87C16F, 0, 0, "Boxing (1980)(Mattel)" },
+	{ 0xAF8718A1, 0, 0, "Dragonfire (1982)(Imagic)" },
+	{ 0xB03F739B, 0, 0, "Blockade Runner (1983)(Interphase)" },
+	{ 0xB35C1101, 0, 0, "Auto Racing (1979)(Mattel)" },
+	{ 0xB45633CF, 0, 0, "All-Star Major League Baseball (1983)(Mattel)" },
+	{ 0xB5C7F25D, 0, 0, "Horse Racing (1980)(Mattel)" },
+	{ 0xB6A3D4DE, 0, 0, "Hard Hat (1979)(Mattel)" },
+	{ 0xB745C1CA, 2, 0, "Stadium Mud Buggies (1988)(Intv Corp)" },
+	{ 0xB91488E2, 0, 0, "4-TRIS (2001) (Joseph Zbiciak)" },
+	{ 0xBA68FF28, 0, 0, "Slap Shot - Super Pro Hockey (1987)(Intv Corp)" },
+	{ 0xBAB638F2, 0, 0, "Super Masters! (1982)(Mattel)" },
+	{ 0xBB939881, 2, 0, "Pole Position (1986)(Intv Corp)" },
+	{ 0xBD731E3C, 0, 0, "Minotaur (1981)(Mattel)" },
+	{ 0xBF4D0E9B, 0, 0, "Dreadnaught Factor, The (1983)(Activision)(proto)" },
+	{ 0xC047D487, 7, 0, "Beauty and the Beast (1982)(Imagic)" },
+	{ 0xC1F1CA74, 0, 0, "Thunder Castle (1982)(Mattel)" },
+	{ 0xC30F61C0, 0, 0, "Donkey Kong (1982)(Coleco)" },
+	{ 0xC51464E0, 0, 0, "Popeye (1983)(Parker Bros)" },
+	{ 0xC7BB1B0E, 0, 0, "Reversi (1984)(Mattel)" },
+	{ 0xCA447BBD, 0, 0, "TRON - Deadly Discs (1981)(Mattel)" },
+	{ 0xCDC14ED8, 0, 0, "TRON - Deadly Discs - Deadly Dogs (1987)(Intv Corp)" },
+	{ 0xD1D352A0, 3, 0, "Tower of Doom (1986)(Intv Corp)" },
+	{ 0xD27495E9, 0, 0, "Frogger (1983)(Parker Bros)" },
+	{ 0xD43FD410, 0, 0, "Tetris (2000)(Zbiciak, Joseph)(PD)" },
+	{ 0xD5363B8C, 6, 0, "Centipede (1983)(Atarisoft)" },
+	{ 0xD5B0135A, 0, 0, "Star Wars - The Empire Strikes Back (1983)(Parker Bros)" },
+	{ 0xD7C5849C, 0, 0, "Pinball (1981)(Mattel)" },
+	{ 0xD7C78754, 0, 0, "4-TRIS (2000)(Zbiciak, Joseph)(PD)" },
+	{ 0xD8C9856A, 0, 0, "Q-bert (1983)(Parker Bros)" },
+	{ 0xD8F99AA2, 5, 0, "Defender (1983)(Atarisoft)" },
+	{ 0xDAB36628, 0, 0, "Baseball (1978)(Mattel)" },
+	{ 0xDBAB54CA, 0, 0, "NASL Soccer (1979)(Mattel)" },
+	{ 0xDBCA82C5, 0, 0, "Go For the Gold (1981)(Mattel)" },
+	{ 0xDCF4B15D, 0, 0, "Royal Dealer (1981)(Mattel)" },
+	{ 0xE00D1399, 0, 0, "Lock 'N' Chase (1982)(Mattel)" },
+	{ 0xE0F0D3DA, 0, 0, "Sewer Sam (1983)(Interphase)" },
+	{ 0xE1EE408F, 0, 0, "Crazy Clones (1981)(Mattel)" },
+	{ 0xE221808C, 0, 0, "Santa's Helper (1983)(Mattel)" },
+	{ 0xE5D1A8D2, 0, 0, "Number Jumble (1983)(Mattel)" },
+	{ 0xE7576C1F, 0, 0, "Robot Rubble (1983)(Activision)(proto)[a]" },
+	{ 0xE806AD91, 7, 0, "Microsurgeon (1982)(Imagic)" },
+	{ 0xE8B8EBA5, 0, 0, "Space Armada (1981)(Mattel)" },
+	{ 0xE9E3F60D, 0, CART_ECS, "Scooby Doo's Maze Chase (1983)(Mattel)" },
+	{ 0xEAF650CC, 0, 0, "BeamRider (1983)(Activision)" },
+	{ 0xF093E801, 0, 0, "U.S. Ski Team Skiing (1980)(Mattel)" },
+	{ 0xF1ED7D27, 0, 0, "White Water! (1983)(Imagic)" },
+	{ 0xF3DF94E0, 0, 0, "Duncan's Thin Ice (1983)(Mattel)" },
+	{ 0xF8B1F2B7, 0, 0, "Advanced Dungeons and Dragons (1982)(Mattel)" },
+	{ 0xF8EF3E5A, 0, 0, "Space Cadet (1982)(Mattel)" },
+	{ 0xF95504E0, 0, 0, "Space Battle (1979)(Mattel)" },
+	{ 0xF9E0789E, 0, 0, "Utopia (1981)(Mattel)" },
+	{ 0xFA492BBD, 0, 0, "Buzz Bombers (1982)(Mattel)" },
+	{ 0xFAB2992C, 0, 0, "Astrosmash (1981)(Mattel)" },
+	{ 0xFF7CB79E, 0, 0, "Sharp Shot (1982)(Mattel)" },
+	{ 0xFF83FF80, 2, 0, "Hover Force (1986)(Intv Corp)" },
+	{ 0xFF87FAEC, 0, 0, "PGA Golf (1979)(Mattel)" },
+};
+
+#define BUILTIN_COUNT ((int)(sizeof(builtin) / sizeof(builtin[0])))
+
+// Entries from the database file, found through an open addressed table
+// of indexes into entries, at most half full
+static struct CartInfo *entries;
+static int entryCount;
+static int entrySize;
+static int *slots; // -1 for empty
+static unsigned int slotMask;
+
+// CRC-32 (IEEE 802.3), four bits at a time
+static const uint32_t crcNibble[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t CartCRC32(const unsigned char *data, size_t size)
+{
+	uint32_t crc = 0xFFFFFFFF;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		crc ^= data[i];
+		crc = (crc >> 4) ^ crcNibble[crc & 15];
+		crc = (crc >> 4) ^ crcNibble[crc & 15];
+	}
+	return crc ^ 0xFFFFFFFF;
+}
+
+static unsigned int slotOf(uint32_t crc)
+{
+	// the CRC is already well mixed, fold it so small tables see every bit
+	return (crc ^ (crc >> 16)) & slotMask;
+}
+
+static int byCrc(const void *key, const void *entry)
+{
+	uint32_t crc = *(const uint32_t *)key;
+	uint32_t other = ((const struct CartInfo *)entry)->crc;
+
+	return crc < other ? -1 : crc > other;
+}
+
+const struct CartInfo *CartDBFind(uint32_t crc)
+{
+	unsigned int s;
+
+	if (slots)
+	{
+		for (s = slotOf(crc); slots[s] >= 0; s = (s + 1) & slotMask)
+			if (entries[slots[s]].crc == crc)
+				return &entries[slots[s]];
+	}
+	return (const struct CartInfo *)bsearch(&crc, builtin, BUILTIN_COUNT, sizeof(builtin[0]), byCrc);
+}
+
+// Rebuilds the table with room for twice the entries
+static int growSlots(void)
+{
+	unsigned int size = slots ? 2 * (slotMask + 1) : 64;
+	int *grown = (int *)malloc(size * sizeof(int));
+	unsigned int s;
+	int i;
+
+	if (grown == NULL)
+		return 0;
+	free(slots);
+	slots = grown;
+	slotMask = size - 1;
+	for (s = 0; s < size; s++)
+		slots[s] = -1;
+	for (i = 0; i < entryCount; i++)
+	{
+		for (s = slotOf(entries[i].crc); slots[s] >= 0; s = (s + 1) & slotMask) { }
+		slots[s] = i;
+	}
+	return 1;
+}
+
+// Adds an entry, or replaces the one with the same CRC
+static int addEntry(uint32_t crc, int map, int flags, const char *name)
+{
+	char *copy = (char *)malloc(strlen(name) + 1);
+	unsigned int s;
+
+	if (copy == NULL)
+		return 0;
+	strcpy(copy, name);
+	if (slots == NULL || 2 * (entryCount + 1) > (int)(slotMask + 1))
+	{
+		if (!growSlots())
+		{
+			free(copy);
+			return 0;
+		}
+	}
+	for (s = slotOf(crc); slots[s] >= 0; s = (s + 1) & slotMask)
+	{
+		struct CartInfo *e = &entries[slots[s]];
+
+		if (e->crc == crc)
+		{
+			free((char *)e->name);
+			e->map = map;
+			e->flags = flags;
+			e->name = copy;
+			return 1;
+		}
+	}
+	if (entryCount == entrySize)
+	{
+		int size = entrySize ? 2 * entrySize : 64;
+		struct CartInfo *grown = (struct CartInfo *)realloc(entries, size * sizeof(struct CartInfo));
+
+		if (grown == NULL)
+		{
+			free(copy);
+			return 0;
+		}
+		entries = grown;
+		entrySize = size;
+	}
+	entries[entryCount].crc = crc;
+	entries[entryCount].map = map;
+	entries[entryCount].flags = flags;
+	entries[entryCount].name = copy;
+	slots[s] = entryCount++;
+	return 1;
+}
+
+static int parseAttributes(char *list, int *flags)
+{
+	char *word;
+
+	*flags = 0;
+	if (strcmp(list, "-") == 0)
+		return 1;
+	for (word = strtok(list, ","); word; word = strtok(NULL, ","))
+	{
+		if (strcmp(word, "ram8") == 0)
+			*flags |= CART_RAM8;
+		else if (strcmp(word, "ivoice") == 0)
+			*flags |= CART_IVOICE;
+		else if (strcmp(word, "ecs") == 0)
+			*flags |= CART_ECS;
+		else
+			return 0;
+	}
+	return 1;
+}
+
+int CartDBLoad(const char *path)
+{
+	char line[512], attributes[64];
+	unsigned long crc;
+	int map, flags, name, number = 0, count = 0;
+	size_t end;
+	FILE *fp = fopen(path, "r");
+
+	if (fp == NULL)
+		return -1;
+	while (fgets(line, sizeof(line), fp))
+	{
+		number++;
+		end = strlen(line);
+		while (end > 0 && (line[end - 1] == '\n' || line[end - 1] == '\r' || line[end - 1] == ' ' || line[end - 1] == '\t'))
+			line[--end] = '\0';
+		name = 0;
+		if (line[strspn(line, " \t")] == '\0' || line[strspn(line, " \t")] == '#')
+			continue;
+		if (sscanf(line, "%lx %d %63s %n", &crc, &map, attributes, &name) < 3 || name == 0 ||
+			map < 0 || map > 9 || !parseAttributes(attributes, &flags))
+		{
+			printf("[WARN] [FREEINTV] %s line %d: expected crc32, memory map 0-9, attributes and name\n", path, number);
+			continue;
+		}
+		if (!addEntry((uint32_t)crc, map, flags, line + name))
+			break;
+		count++;
+	}
+	fclose(fp);
+	return count;
+}
+
+void CartDBFree(void)
+{
+	int i;
+
+	for (i = 0; i < entryCount; i++)
+		free((char *)entries[i].name);
+	free(entries);
+	free(slots);
+	entries = NULL;
+	slots = NULL;
+	entryCount = entrySize = 0;
+	slotMask = 0;
+}
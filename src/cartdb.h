@@ -0,0 +1,59 @@
+#ifndef CARTDB_H
+#define CARTDB_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+// Cartridge database, keyed by the CRC32 of the whole rom file.  Raw
+// images are looked up here first and in the older fingerprint table in
+// cart.c after that, which only unknown carts should reach.  Entries come
+// from a built-in list and from an optional database file, which takes
+// precedence.  Load the file before loading carts on other threads;
+// lookups only read.
+//
+// The file has one cart per line, blank lines and lines starting with #
+// are skipped:
+//
+//   crc32 map attributes name
+//   B91488E2 0 - 4-TRIS (2001) (Joseph Zbiciak)
+//
+// map is the memory map, load0() to load9() in cart.c.  attributes is "-"
+// or a comma separated list of ram8, ivoice and ecs.
+
+#define CARTDB_FILE "freeintv_carts.txt" // in the system directory
+
+#define CART_RAM8   0x01 // $D000-$D3FF is 8-bit RAM
+#define CART_IVOICE 0x02 // uses the Intellivoice
+#define CART_ECS    0x04 // needs the ECS, which isn't emulated
+
+struct CartInfo {
+	uint32_t crc;
+	int map;
+	int flags;
+	const char *name;
+};
+
+uint32_t CartCRC32(const unsigned char *data, size_t size);
+
+const struct CartInfo *CartDBFind(uint32_t crc); // NULL if unknown
+
+int CartDBLoad(const char *path); // entries read from a database file, -1 if it can't be opened
+void CartDBFree(void); // drops what CartDBLoad() read
+
+#endif
@@ -16,6 +16,7 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 #include <math.h>
+#include "intv.h"
 #include "controller.h"
 #include "memory.h"
 
@@ -78,10 +79,11 @@ void controllerInit()
 	// swap the left and right controllers
 }
 
-void setControllerInput(int player, int state)
+void setControllerInput(struct Machine *m, int player, int state)
 {
 	int byte_val = (state^0xFF) & 0xFF;
-	Memory[(player^controllerSwap) + 0x1FE] = byte_val;
+	MemoryPoke(m, (player^controllerSwap) + 0x1FE) = byte_val;
+	MemoryTouch(m, 0x1FE);
 	// Note: Debug logging would go here if needed
 	// The value written is state XORed with 0xFF, then masked to 0xFF
 	// For K_9 (0x24): written value = (0x24 ^ 0xFF) & 0xFF = 0xDB
@@ -20,83 +20,86 @@
 #include "intv.h"
 #include "memory.h"
 #include "cp1610.h"
+#include "state.h"
+#include "profile.h"
+#include "timeline.h"
+#include "heatmap.h"
 
 // http://wiki.intellivision.us/index.php?title=CP1610#Instruction_Set
 // http://spatula-city.org/~im14u2c/chips/GICP1600.pdf
 // ftp://bitsavers.informatik.uni-stuttgart.de/components/gi/CP1600/CP-1600_Microprocessor_Users_Manual_May75.pdf
 
-int (*OpCodes[0x400])(int);
+int (*OpCodes[0x400])(struct Machine *, int);
 int Interuptable[0x400];
 const char *Nmemonic[0x400];
 
-unsigned int R[8] = {0, 0, 0, 0, 0, 0, 0x02F1, 0x1000}; // Registers R0-R7
-
 const int PC = 7; // const Program Counter (R7)
 const int SP = 6; // const Stack Pointer (R6)
 
-int InstructionRegister = 0; // four external lines?
-
-int Flag_DoubleByteData = 0;
-int Flag_InteruptEnable = 0;
-int Flag_Carry = 0;
-int Flag_Sign = 0;
-int Flag_Zero = 0;
-int Flag_Overflow = 0;
-
-void CP1610Serialize(struct CP1610serialized *all)
+void CP1610Serialize(struct Machine *m, struct StateBuffer *state)
 {
-    all->Flag_DoubleByteData = Flag_DoubleByteData;
-    all->Flag_InteruptEnable = Flag_InteruptEnable;
-    all->Flag_Carry = Flag_Carry;
-    all->Flag_Sign = Flag_Sign;
-    all->Flag_Zero = Flag_Zero;
-    all->Flag_Overflow = Flag_Overflow;
-    memcpy(&all->R[0], &R[0], sizeof(R));
+    size_t mark = StateChunkBegin(state, "CPU ");
+    int i;
+
+    StatePut8(state, m->cpu.Flag_DoubleByteData);
+    StatePut8(state, m->cpu.Flag_InteruptEnable);
+    StatePut8(state, m->cpu.Flag_Carry);
+    StatePut8(state, m->cpu.Flag_Sign);
+    StatePut8(state, m->cpu.Flag_Zero);
+    StatePut8(state, m->cpu.Flag_Overflow);
+    for (i = 0; i < 8; i++)
+        StatePut32(state, m->cpu.R[i]);
+    StateChunkEnd(state, mark);
 }
 
-void CP1610Unserialize(const struct CP1610serialized *all)
+void CP1610Unserialize(struct Machine *m, struct StateBuffer *state)
 {
-    Flag_DoubleByteData = all->Flag_DoubleByteData;
-    Flag_InteruptEnable = all->Flag_InteruptEnable;
-    Flag_Carry = all->Flag_Carry;
-    Flag_Sign = all->Flag_Sign;
-    Flag_Zero = all->Flag_Zero;
-    Flag_Overflow = all->Flag_Overflow;
-    memcpy(&R[0], &all->R[0], sizeof(R));
+    int i;
+
+    if (!StateChunkOpen(state, "CPU "))
+        return;
+    m->cpu.Flag_DoubleByteData = StateGet8(state);
+    m->cpu.Flag_InteruptEnable = StateGet8(state);
+    m->cpu.Flag_Carry = StateGet8(state);
+    m->cpu.Flag_Sign = StateGet8(state);
+    m->cpu.Flag_Zero = StateGet8(state);
+    m->cpu.Flag_Overflow = StateGet8(state);
+    for (i = 0; i < 8; i++)
+        m->cpu.R[i] = StateGet32(state);
 }
 
-void CP1610Reset()
+void CP1610Reset(struct Machine *m)
 {
-	Flag_DoubleByteData = 0;
-	Flag_InteruptEnable = 0;
-	Flag_Carry = 0;
-	Flag_Sign = 0;
-	Flag_Zero = 0;
-	Flag_Overflow = 0;
-	R[0] = R[1] = R[2] = R[3] = R[4] = R[5] = 0;
-	R[SP] = 0x02F1; // Stack is at System Ram 0x02F1-0x0318
-	R[PC] = 0x1000; // EXEC entry point
+	m->cpu.Flag_DoubleByteData = 0;
+	m->cpu.Flag_InteruptEnable = 0;
+	m->cpu.Flag_Carry = 0;
+	m->cpu.Flag_Sign = 0;
+	m->cpu.Flag_Zero = 0;
+	m->cpu.Flag_Overflow = 0;
+	m->cpu.R[0] = m->cpu.R[1] = m->cpu.R[2] = m->cpu.R[3] = m->cpu.R[4] = m->cpu.R[5] = 0;
+	m->cpu.R[SP] = 0x02F1; // Stack is at System Ram 0x02F1-0x0318
+	m->cpu.R[PC] = 0x1000; // EXEC entry point
 }
 
-int readIndirect(int reg) // Read Indirect, handle SDBD, update autoincriment registers
+int readIndirect(struct Machine *m, int reg) // Read Indirect, handle SDBD, update autoincriment registers
 {
     int val = 0;
     int adr = 0;
     
-    if(reg==6) { R[reg] = R[reg] - 1; } // decriment R6 (SP) before read
-    adr = R[reg];
+    if(reg==6) { m->cpu.R[reg] = m->cpu.R[reg] - 1; } // decriment R6 (SP) before read
+    adr = m->cpu.R[reg];
     
-    val = readMem(adr);
+    val = readMem(m, adr);
     if(reg==4 || reg==5 || reg==7) // autoincrement registers R4-R7 excluding SP (R6)
     {
-        R[reg] = (R[reg]+1) & 0xFFFF;
+        m->cpu.R[reg] = (m->cpu.R[reg]+1) & 0xFFFF;
     }
-    if(Flag_DoubleByteData == 1) {
+    if(m->cpu.Flag_DoubleByteData == 1) {
         val &= 0xff;
         if(reg==4 || reg==5 || reg==7) // autoincrement registers (incremented twice for double byte data)
         {
-            val |= ((readMem(adr+1) & 0xFF)<<8);
-            R[reg] = (R[reg]+1) & 0xFFFF;
+            val |= ((readMem(m, adr+1) & 0xFF)<<8);
+            m->cpu.R[reg] = (m->cpu.R[reg]+1) & 0xFFFF;
         } else {
             val |= val << 8;
         }
@@ -104,71 +107,87 @@ int readIndirect(int reg) // Read Indirect, handle SDBD, update autoincriment re
     return val;
 }
 
-void writeIndirect(int reg, int val)
+void writeIndirect(struct Machine *m, int reg, int val)
 {
-	int adr = R[reg];
-	writeMem(adr, val);
+	int adr = m->cpu.R[reg];
+	writeMem(m, adr, val);
 	if(reg>=4) // autoincrement registers R4-R7
 	{
-		R[reg] = (R[reg]+1) & 0xFFFF;
+		m->cpu.R[reg] = (m->cpu.R[reg]+1) & 0xFFFF;
 	}
 }
 
-int readOperand(void)
+int readOperand(struct Machine *m)
 {
-	int val = readMem(R[PC]);
-	R[PC]++;
+	int val = readMem(m, m->cpu.R[PC]);
+	m->cpu.R[PC]++;
 	return val;
 }
 
-int readOperandIndirect(void)
+int readOperandIndirect(struct Machine *m)
 {
-	int adr = readMem(R[PC]);
-	int val = readMem(adr);
-	R[PC]++;
+	int adr = readMem(m, m->cpu.R[PC]);
+	int val = readMem(m, adr);
+	m->cpu.R[PC]++;
 	return val;
 }
 
-void SetFlagsSZ(int reg)
+void SetFlagsSZ(struct Machine *m, int reg)
 {
-	R[reg] = R[reg] & 0xFFFF;
-	Flag_Sign = (R[reg] & 0x8000)!=0;
-	Flag_Zero = R[reg]==0;
+	m->cpu.R[reg] = m->cpu.R[reg] & 0xFFFF;
+	m->cpu.Flag_Sign = (m->cpu.R[reg] & 0x8000)!=0;
+	m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 }
 
-int AddSetSZOC(int A, int B)
+int AddSetSZOC(struct Machine *m, int A, int B)
 {
 	int signa = A & 0x8000;
 	int signb = B & 0x8000;
 	int result = (A+B);
 	int signr =  result & 0x8000;
 
-	Flag_Overflow = (signa==signb && signa!=signr) ? 1 : 0;
-	Flag_Carry = (result & 0x10000) != 0;
+	m->cpu.Flag_Overflow = (signa==signb && signa!=signr) ? 1 : 0;
+	m->cpu.Flag_Carry = (result & 0x10000) != 0;
 
 	result = result & 0xFFFF;
 
-	Flag_Sign = (result & 0x8000)!=0;
-	Flag_Zero = result==0;
+	m->cpu.Flag_Sign = (result & 0x8000)!=0;
+	m->cpu.Flag_Zero = result==0;
 	return result;
 }
-int SubSetOC(int A, int B)
+int SubSetOC(struct Machine *m, int A, int B)
 {
 	int signa = A & 0x8000;
 	int signb = B & 0x8000;
 	int result = (A + (B ^ 0xFFFF) + 1); // A - B using 1's compliment;
 	int signr =  result & 0x8000;
-	Flag_Carry = (result & 0x10000)!=0;
-	Flag_Overflow = (signa!=signb && signa!=signr) ? 1 : 0;
+	m->cpu.Flag_Carry = (result & 0x10000)!=0;
+	m->cpu.Flag_Overflow = (signa!=signb && signa!=signr) ? 1 : 0;
 	return result & 0xFFFF;
 }
 
-int CP1610Tick(int debug)
+void CP1610Trace(const struct CP1610 *cpu, int instruction, int sr1, long count, char *line, int size)
+{
+	snprintf(line, size, " %04X %04X %04X %04X %04X %04X %04X %04X %c%c%c%c%c%c%c%c %20s %ld\n",
+		cpu->R[0], cpu->R[1], cpu->R[2], cpu->R[3], cpu->R[4], cpu->R[5], cpu->R[6], cpu->R[7],
+		cpu->Flag_Sign ? 'S' : '-',
+		cpu->Flag_Zero ? 'Z' : '-',
+		cpu->Flag_Overflow ? 'O' : '-',
+		cpu->Flag_Carry ? 'C' : '-',
+		cpu->Flag_InteruptEnable ? 'I' : '-',
+		cpu->Flag_DoubleByteData ? 'D' : '-',
+		instruction <= 0x03FF && Interuptable[instruction] ? 'i' : '-',
+		sr1 > 0 ? 'q' : '-',
+		instruction <= 0x03FF && Nmemonic[instruction] ? Nmemonic[instruction] : "???", count);
+}
+
+int CP1610Tick(struct Machine *m, int debug)
 {
 	// execute one instruction //
-	int sdbd = Flag_DoubleByteData;
+	int sdbd = m->cpu.Flag_DoubleByteData;
 
-	unsigned int instruction = readMem(R[PC]);
+	unsigned int pc = m->cpu.R[PC];
+	unsigned int instruction = readMem(m, pc);
 
 	int ticks = 0;
 #if 0
@@ -180,22 +199,15 @@ int CP1610Tick(int debug)
     {
         FILE *debug_file;
         
-        fprintf(stdout, "%04x:[%03x%c %04x %04x %04x %04x %04x %04x %04x %s %c%c%c%c%c%c\n", R[7], instruction, instruction > 0x03ff ? 'X' : ']', R[0], R[1], R[2], R[3], R[4], R[5], R[6], Nmemonic[instruction], Flag_Sign ? 'S' : '-', Flag_Carry ? 'C' : '-', Flag_Overflow ? 'O' : '-', Flag_Zero ? 'Z' : '-', Flag_InteruptEnable ? 'I' : '-', Flag_DoubleByteData ? 'D' : '-');
+        fprintf(stdout, "%04x:[%03x%c %04x %04x %04x %04x %04x %04x %04x %s %c%c%c%c%c%c\n", m->cpu.R[7], instruction, instruction > 0x03ff ? 'X' : ']', m->cpu.R[0], m->cpu.R[1], m->cpu.R[2], m->cpu.R[3], m->cpu.R[4], m->cpu.R[5], m->cpu.R[6], Nmemonic[instruction], m->cpu.Flag_Sign ? 'S' : '-', m->cpu.Flag_Carry ? 'C' : '-', m->cpu.Flag_Overflow ? 'O' : '-', m->cpu.Flag_Zero ? 'Z' : '-', m->cpu.Flag_InteruptEnable ? 'I' : '-', m->cpu.Flag_DoubleByteData ? 'D' : '-');
     }
 #endif
 #if 0   // Debug output compatible with JZINTV for comparison purposes
     {
-        FILE *debug_file;
-        
-        fprintf(debug_file, " %04X %04X %04X %04X %04X %04X %04X %04X %c%c%c%c%c%c%c%c %20s %d\n", R[0], R[1], R[2], R[3], R[4], R[5], R[6], R[7],
-            Flag_Sign ? 'S' : '-',
-            Flag_Zero ? 'Z' : '-',
-            Flag_Overflow ? 'O' : '-',
-            Flag_Carry ? 'C' : '-',
-            Flag_InteruptEnable ? 'I' : '-',
-            Flag_DoubleByteData ? 'D' : '-',
-            Interuptable[instruction] ? 'i' : '-',
-            SR1 > 0 ? 'q' : '-' , Nmemonic[instruction], global_ticks);
+        char line[CP1610_TRACE_LINE];
+
+        CP1610Trace(&m->cpu, instruction, m->SR1, global_ticks, line, sizeof(line));
+        fputs(line, stdout);
     }
 #endif
     
@@ -206,24 +218,29 @@ int CP1610Tick(int debug)
 		return 0;
 	}
 
-	R[PC]++; // point PC/R7 at operand/next address
+	HEATMAP_ACCESS(m, HEATMAP_EXECUTES, pc, instruction);
+	m->cpu.R[PC]++; // point PC/R7 at operand/next address
     
-	ticks = OpCodes[instruction](instruction); // execute instruction
+	ticks = OpCodes[instruction](m, instruction); // execute instruction
+	PROFILE_INSTRUCTION(m, pc, instruction, ticks);
 
-	if(sdbd==1) { Flag_DoubleByteData = 0; } // reset SDBD
+	if(sdbd==1) { m->cpu.Flag_DoubleByteData = 0; } // reset SDBD
 
 	// check interupt request
-	if(Flag_InteruptEnable == 1 && SR1>0)
+	if(m->cpu.Flag_InteruptEnable == 1 && m->SR1>0)
 	{
 		if(Interuptable[instruction])
 		{
 			// Take VBlank Interupt //
-			SR1 = 0;
-			writeIndirect(SP, R[PC]); // push PC...
-			R[PC] = 0x1004; // Jump
+			m->SR1 = 0;
+			PROFILE_INTERRUPT(m, m->cpu.R[PC], 12);
+			TIMELINE_MARK(TIMELINE_VBLANK_IRQ, m->cpu.R[PC]);
+			writeIndirect(m, SP, m->cpu.R[PC]); // push PC...
+			m->cpu.R[PC] = 0x1004; // Jump
             ticks += 12;
 		}
 	}
+	HEATMAP_TICK(m, ticks);
 
 #if 0
     global_ticks += ticks;
@@ -231,150 +248,150 @@ int CP1610Tick(int debug)
 	return ticks;
 }
 
-int HLT(int v)
+int HLT(struct Machine *m, int v)
 {
     // Halt Instruction found! //
     printf("\n\n[ERROR] [FREEINTV] HALT!\n");
   
-    R[PC]--; // Repeat instruction forever instead of exiting without warning
+    m->cpu.R[PC]--; // Repeat instruction forever instead of exiting without warning
     return 0;
 }
 
-int SDBD(int v) { Flag_DoubleByteData = 1; return 4; } // Set Double Byte Data
-int EIS(int v)  { Flag_InteruptEnable = 1; return 4; } // Enable Interrupt System
-int DIS(int v)  { Flag_InteruptEnable = 0; return 4; } // Disable Interrupt System
-int Jump(int v)
+int SDBD(struct Machine *m, int v) { m->cpu.Flag_DoubleByteData = 1; return 4; } // Set Double Byte Data
+int EIS(struct Machine *m, int v)  { m->cpu.Flag_InteruptEnable = 1; return 4; } // Enable Interrupt System
+int DIS(struct Machine *m, int v)  { m->cpu.Flag_InteruptEnable = 0; return 4; } // Disable Interrupt System
+int Jump(struct Machine *m, int v)
 { 
 	// J, JE, JD, JSR, JSRE, JSRD, CALL
 	// 0000:0000:0000:0100  0000:00rr:aaaa:aaff  0000:00aa:aaaa:aaaa
-	int decle2 = readOperand();
-	int decle3 = readOperand() & 0x3FF;
+	int decle2 = readOperand(m);
+	int decle3 = readOperand(m) & 0x3FF;
 	int reg = (decle2>>8) & 0x03; // 0-R4, 1-R5, 2-R6, 3-don't store return address
 	int adr = (((decle2>>2) & 0x3F)<<10) | decle3;
 	int ff = decle2 & 0x03; // Interrupt flag (0-no change, 1-set, 2-clear, 3-undefined)
 	if(reg!=3)
 	{
 		reg = reg + 4;
-		R[reg] = R[PC]; // store return address (PC already advanced to PC+3)
+		m->cpu.R[reg] = m->cpu.R[PC]; // store return address (PC already advanced to PC+3)
 	}
-	if(ff==1) { Flag_InteruptEnable = 1; } // set Interupt flag
-	if(ff==2) { Flag_InteruptEnable = 0; } // clear Interrupt flag
-	R[PC] = adr; // Jump
+	if(ff==1) { m->cpu.Flag_InteruptEnable = 1; } // set Interupt flag
+	if(ff==2) { m->cpu.Flag_InteruptEnable = 0; } // clear Interrupt flag
+	m->cpu.R[PC] = adr; // Jump
 	return 13;
 }
-int TCI(int v)  { return 4; } // Terminate Current Interrupt (not used)
-int CLRC(int v) { Flag_Carry = 0; return 4; } // Clear Carry
-int SETC(int v) { Flag_Carry = 1; return 4; } // Set Carry
+int TCI(struct Machine *m, int v)  { return 4; } // Terminate Current Interrupt (not used)
+int CLRC(struct Machine *m, int v) { m->cpu.Flag_Carry = 0; return 4; } // Clear Carry
+int SETC(struct Machine *m, int v) { m->cpu.Flag_Carry = 1; return 4; } // Set Carry
 
 #define EXTRA_IF_R6(reg)  (reg == 6 ? 3 : 0)
 #define EXTRA_IF_R6R7(reg)  (reg >= 6 ? 1 : 0)
 
-int INCR(int v) // Increment Register
+int INCR(struct Machine *m, int v) // Increment Register
 {
 	int reg = v & 0x07;
-	R[reg] = R[reg]+1;
-	SetFlagsSZ(reg);
+	m->cpu.R[reg] = m->cpu.R[reg]+1;
+	SetFlagsSZ(m, reg);
     return 6 + EXTRA_IF_R6R7(reg);
 }
-int DECR(int v) // Decrement Register
+int DECR(struct Machine *m, int v) // Decrement Register
 {
 	int reg = v & 0x07;
-	R[reg] = R[reg]-1;
-	SetFlagsSZ(reg);
+	m->cpu.R[reg] = m->cpu.R[reg]-1;
+	SetFlagsSZ(m, reg);
     return 6 + EXTRA_IF_R6R7(reg);
 }
-int COMR(int v) // Complement Register (One's Compliment)
+int COMR(struct Machine *m, int v) // Complement Register (One's Compliment)
 {
 	int reg = v & 0x07;
-	R[reg] = R[reg] ^ 0xFFFF;
-	SetFlagsSZ(reg);
+	m->cpu.R[reg] = m->cpu.R[reg] ^ 0xFFFF;
+	SetFlagsSZ(m, reg);
     return 6 + EXTRA_IF_R6R7(reg);
 }
-int NEGR(int v) // Negate Register (Two's Compliment)
+int NEGR(struct Machine *m, int v) // Negate Register (Two's Compliment)
 {
 	int reg = v & 0x07;
-	R[reg] = SubSetOC(0, R[reg]);
-    SetFlagsSZ(reg);
+	m->cpu.R[reg] = SubSetOC(m, 0, m->cpu.R[reg]);
+    SetFlagsSZ(m, reg);
     return 6 + EXTRA_IF_R6R7(reg);
 }
-int ADCR(int v) // Add Carry to Register
+int ADCR(struct Machine *m, int v) // Add Carry to Register
 {
 	int reg = v & 0x07;
-	R[reg] = AddSetSZOC(R[reg], Flag_Carry);
+	m->cpu.R[reg] = AddSetSZOC(m, m->cpu.R[reg], m->cpu.Flag_Carry);
     return 6 + EXTRA_IF_R6R7(reg);
 }
-int GSWD(int v) // Get the Status Word szoc:0000:szoc:0000
+int GSWD(struct Machine *m, int v) // Get the Status Word szoc:0000:szoc:0000
 {
 	int reg = v & 0x03;
-	unsigned int szoc = (Flag_Sign<<3) | (Flag_Zero<<2) | (Flag_Overflow<<1) | Flag_Carry;
-	R[reg] = (szoc<<12) | (szoc<<4);
+	unsigned int szoc = (m->cpu.Flag_Sign<<3) | (m->cpu.Flag_Zero<<2) | (m->cpu.Flag_Overflow<<1) | m->cpu.Flag_Carry;
+	m->cpu.R[reg] = (szoc<<12) | (szoc<<4);
 	return 6;
 }
-int NOP(int v) { return 6; } // No Operation
-int SIN(int v) { return 6; } // Software Interrupt (not used)
+int NOP(struct Machine *m, int v) { return 6; } // No Operation
+int SIN(struct Machine *m, int v) { return 6; } // Software Interrupt (not used)
 
-int RSWD(int v) // Return Status Word szoc:0000
+int RSWD(struct Machine *m, int v) // Return Status Word szoc:0000
 {
 	int reg = v & 0x07;
-	unsigned int szoc = R[reg]>>4;
-	Flag_Sign = (szoc>>3) & 1;
-	Flag_Zero = (szoc>>2) & 1;
-	Flag_Overflow = (szoc>>1) & 1;
-	Flag_Carry = szoc & 1;
+	unsigned int szoc = m->cpu.R[reg]>>4;
+	m->cpu.Flag_Sign = (szoc>>3) & 1;
+	m->cpu.Flag_Zero = (szoc>>2) & 1;
+	m->cpu.Flag_Overflow = (szoc>>1) & 1;
+	m->cpu.Flag_Carry = szoc & 1;
 	return 6;
 }
-int SWAP(int v) // Swap 0000:0trr
+int SWAP(struct Machine *m, int v) // Swap 0000:0trr
 {
 	int reg = v & 0x03;
 	int times = (v>>2) & 1;
-	int upper = (R[reg]>>8) & 0xFF;
-	int lower = R[reg] & 0xFF;
+	int upper = (m->cpu.R[reg]>>8) & 0xFF;
+	int lower = m->cpu.R[reg] & 0xFF;
 	if(times==0) // single swap
 	{
-		R[reg] = (lower<<8) | upper;
-		Flag_Sign = (R[reg]>>7) & 1;
-		Flag_Zero = R[reg]==0;
+		m->cpu.R[reg] = (lower<<8) | upper;
+		m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+		m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 		return 6;
 	}
 	else // double swap
 	{
-		R[reg] = (lower<<8) | lower;
-		Flag_Sign = (R[reg]>>7) & 1;
-		Flag_Zero = R[reg]==0;
+		m->cpu.R[reg] = (lower<<8) | lower;
+		m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+		m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 		return 8;
 	}
 }
-int SLL(int v) // Shift Logical Left 0000:1drr
+int SLL(struct Machine *m, int v) // Shift Logical Left 0000:1drr
 {
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1)+1;
-	R[reg] = R[reg]<<dist;
-	SetFlagsSZ(reg);
+	m->cpu.R[reg] = m->cpu.R[reg]<<dist;
+	SetFlagsSZ(m, reg);
 	return 6+(2*(dist-1)); // 6 <<1 or 8 <<2
 }
-int RLC(int v) // Rotate Left Through Carry
+int RLC(struct Machine *m, int v) // Rotate Left Through Carry
 {
 	int reg = v & 0x03;
 	int times = ((v>>2) & 1);
-	int bit15 = (R[reg]>>15) & 1;
-	int bit14 = (R[reg]>>14) & 1;
+	int bit15 = (m->cpu.R[reg]>>15) & 1;
+	int bit14 = (m->cpu.R[reg]>>14) & 1;
 	if(times==0) // Single rotate
 	{
-		R[reg] = R[reg] << 1;
-		R[reg] = R[reg] | Flag_Carry;
-		Flag_Carry = bit15;
+		m->cpu.R[reg] = m->cpu.R[reg] << 1;
+		m->cpu.R[reg] = m->cpu.R[reg] | m->cpu.Flag_Carry;
+		m->cpu.Flag_Carry = bit15;
 	}
 	else // Double rotate
 	{
-		R[reg] = R[reg] << 2;
-		R[reg] = R[reg] | ((Flag_Carry << 1) | Flag_Overflow);
-		Flag_Carry = bit15;
-		Flag_Overflow = bit14;
+		m->cpu.R[reg] = m->cpu.R[reg] << 2;
+		m->cpu.R[reg] = m->cpu.R[reg] | ((m->cpu.Flag_Carry << 1) | m->cpu.Flag_Overflow);
+		m->cpu.Flag_Carry = bit15;
+		m->cpu.Flag_Overflow = bit14;
 	}
-	SetFlagsSZ(reg);
+	SetFlagsSZ(m, reg);
 	return 6+(2*times); // 6 single or 8 double
 }
-int SLLC(int v) // Shift Logical Left through Carry
+int SLLC(struct Machine *m, int v) // Shift Logical Left through Carry
 {
 	// CP-1600 Manual says to use O as bit 16 and C as bit 17
 	// on a double shift, and C as bit 16 on a single shift.
@@ -383,144 +400,144 @@ int SLLC(int v) // Shift Logical Left through Carry
 	// The wiki method seems to be correct
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1)+1;
-	int bit15 = (R[reg]>>15) & 1;
-	int bit14 = (R[reg]>>14) & 1;
-	R[reg] = (R[reg]<<dist);
-	Flag_Carry = bit15;			
+	int bit15 = (m->cpu.R[reg]>>15) & 1;
+	int bit14 = (m->cpu.R[reg]>>14) & 1;
+	m->cpu.R[reg] = (m->cpu.R[reg]<<dist);
+	m->cpu.Flag_Carry = bit15;			
 	if(dist==2)
 	{
-		Flag_Overflow = bit14; // wiki.intellivision.us method 
+		m->cpu.Flag_Overflow = bit14; // wiki.intellivision.us method 
 		//Flag_Carry = bit14; // CP-1600 Manual method
 		//Flag_Overflow = bit15; // CP-1600 Manual method
 	}
-	SetFlagsSZ(reg);
+	SetFlagsSZ(m, reg);
 	return 6+(2*(dist-1)); // 6 <<1 or 8 <<2
 }
-int SLR(int v) // Shift Logical Right
+int SLR(struct Machine *m, int v) // Shift Logical Right
 {
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1)+1;
-	R[reg] = R[reg]>>dist;
-	Flag_Sign = (R[reg]>>7) & 1;
-	Flag_Zero = R[reg]==0;
+	m->cpu.R[reg] = m->cpu.R[reg]>>dist;
+	m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+	m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 	return 6+(2*(dist-1)); // 6 <<1 or 8 <<2
 }
-int SAR(int v) // Shift Arithmetic Right
+int SAR(struct Machine *m, int v) // Shift Arithmetic Right
 {
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1)+1;
-	int bit15 = (R[reg]>>15) & 1;
+	int bit15 = (m->cpu.R[reg]>>15) & 1;
 
-	R[reg] = R[reg]>>dist;
+	m->cpu.R[reg] = m->cpu.R[reg]>>dist;
 	if(dist==1)
 	{
-		R[reg] = R[reg] | (bit15<<15);
+		m->cpu.R[reg] = m->cpu.R[reg] | (bit15<<15);
 	}
 	else
 	{
-		R[reg] = R[reg] | (bit15<<15);
-		R[reg] = R[reg] | (bit15<<14); // CP-1600 manual says "sign bit copied to high bits"
+		m->cpu.R[reg] = m->cpu.R[reg] | (bit15<<15);
+		m->cpu.R[reg] = m->cpu.R[reg] | (bit15<<14); // CP-1600 manual says "sign bit copied to high bits"
 	}
-	Flag_Sign = (R[reg]>>7) & 1;
-	Flag_Zero = R[reg]==0;
+	m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+	m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 	return 6+(2*(dist-1)); // 6 <<1 or 8 <<2
 }
-int RRC(int v) // Rotate Right Through Carry
+int RRC(struct Machine *m, int v) // Rotate Right Through Carry
 {
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1);
-	int bit1 = (R[reg]>>1) & 1;
-	int bit0 = R[reg] & 1;
+	int bit1 = (m->cpu.R[reg]>>1) & 1;
+	int bit0 = m->cpu.R[reg] & 1;
 
 	if(dist==0)
 	{
-		R[reg] = R[reg]>>1;
-		R[reg] = R[reg] | (Flag_Carry<<15);
+		m->cpu.R[reg] = m->cpu.R[reg]>>1;
+		m->cpu.R[reg] = m->cpu.R[reg] | (m->cpu.Flag_Carry<<15);
 	}
 	else
 	{
-		R[reg] = R[reg]>>2;
-		R[reg] = R[reg] | (Flag_Overflow<<15);
-		R[reg] = R[reg] | (Flag_Carry<<14);
-		Flag_Overflow = bit1;
+		m->cpu.R[reg] = m->cpu.R[reg]>>2;
+		m->cpu.R[reg] = m->cpu.R[reg] | (m->cpu.Flag_Overflow<<15);
+		m->cpu.R[reg] = m->cpu.R[reg] | (m->cpu.Flag_Carry<<14);
+		m->cpu.Flag_Overflow = bit1;
 	}
-	Flag_Carry = bit0;
-	Flag_Sign = (R[reg]>>7) & 1;
-	Flag_Zero = R[reg]==0;
+	m->cpu.Flag_Carry = bit0;
+	m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+	m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 	return 6+(2*(dist)); // 6 <<1 or 8 <<2
 }
-int SARC(int v) // Shift Arithmetic Right Through Carry 
+int SARC(struct Machine *m, int v) // Shift Arithmetic Right Through Carry 
 {
 	int reg = v & 0x03;
 	int dist = ((v>>2) & 1)+1;
-	int bit15 = (R[reg]>>15) & 1;
-	int bit1 = (R[reg]>>1) & 1;
-	int bit0 = R[reg] & 1;
+	int bit15 = (m->cpu.R[reg]>>15) & 1;
+	int bit1 = (m->cpu.R[reg]>>1) & 1;
+	int bit0 = m->cpu.R[reg] & 1;
 
-	R[reg] = R[reg]>>dist;
-	R[reg] = R[reg] | (bit15<<15);
+	m->cpu.R[reg] = m->cpu.R[reg]>>dist;
+	m->cpu.R[reg] = m->cpu.R[reg] | (bit15<<15);
 	if(dist==2)
 	{
-		R[reg] = R[reg] | (bit15<<14); // CP-1600 manual says "sign bit copied to high 2 bits"
-		Flag_Overflow = bit1;
+		m->cpu.R[reg] = m->cpu.R[reg] | (bit15<<14); // CP-1600 manual says "sign bit copied to high 2 bits"
+		m->cpu.Flag_Overflow = bit1;
 	}
-	Flag_Carry = bit0;
-	Flag_Sign = (R[reg]>>7) & 1;
-	Flag_Zero = R[reg]==0;
+	m->cpu.Flag_Carry = bit0;
+	m->cpu.Flag_Sign = (m->cpu.R[reg]>>7) & 1;
+	m->cpu.Flag_Zero = m->cpu.R[reg]==0;
 	return 6+(2*(dist-1)); // 6 <<1 or 8 <<2
 }
-int MOVR(int v) // Move Register
+int MOVR(struct Machine *m, int v) // Move Register
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	R[dreg] = R[sreg];
-	SetFlagsSZ(dreg);
+	m->cpu.R[dreg] = m->cpu.R[sreg];
+	SetFlagsSZ(m, dreg);
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int ADDR(int v) // Add Registers
+int ADDR(struct Machine *m, int v) // Add Registers
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	R[dreg] = AddSetSZOC(R[dreg], R[sreg]);
+	m->cpu.R[dreg] = AddSetSZOC(m, m->cpu.R[dreg], m->cpu.R[sreg]);
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int SUBR(int v) // Subtract Registers
+int SUBR(struct Machine *m, int v) // Subtract Registers
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	R[dreg] = SubSetOC(R[dreg], R[sreg]);
-	SetFlagsSZ(dreg);
+	m->cpu.R[dreg] = SubSetOC(m, m->cpu.R[dreg], m->cpu.R[sreg]);
+	SetFlagsSZ(m, dreg);
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int CMPR(int v) // Compare Registers
+int CMPR(struct Machine *m, int v) // Compare Registers
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	int res = SubSetOC(R[dreg], R[sreg]);
-	Flag_Sign = (res & 0x8000)!=0;
-	Flag_Zero = res==0;
+	int res = SubSetOC(m, m->cpu.R[dreg], m->cpu.R[sreg]);
+	m->cpu.Flag_Sign = (res & 0x8000)!=0;
+	m->cpu.Flag_Zero = res==0;
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int ANDR(int v) // And Registers
+int ANDR(struct Machine *m, int v) // And Registers
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	R[dreg] = R[dreg] & R[sreg];
-	SetFlagsSZ(dreg);
+	m->cpu.R[dreg] = m->cpu.R[dreg] & m->cpu.R[sreg];
+	SetFlagsSZ(m, dreg);
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int XORR(int v) // Xor Registers
+int XORR(struct Machine *m, int v) // Xor Registers
 {
 	int sreg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;
-	R[dreg] = R[dreg] ^ R[sreg];
-	SetFlagsSZ(dreg);
+	m->cpu.R[dreg] = m->cpu.R[dreg] ^ m->cpu.R[sreg];
+	SetFlagsSZ(m, dreg);
     return 6 + EXTRA_IF_R6R7(dreg);
 }
-int Branch(int v) // Branch - B, BC, BOV, BPL, BEQ, BLT, BLE, BUSC, NOPP, BNC, BNOV, BMI, BNEQ, BGE, BGT, BESC, BEXT
+int Branch(struct Machine *m, int v) // Branch - B, BC, BOV, BPL, BEQ, BLT, BLE, BUSC, NOPP, BNC, BNOV, BMI, BNEQ, BGE, BGT, BESC, BEXT
 {
 	//0000:0010:00de:nccc  aaaa:aaaa:aaaa:aaaa
-	int offset = readOperand();
+	int offset = readOperand(m);
 	int direction = (v >> 5) & 0x01;
 	int ext = (v >> 4) & 0x01;
 	int notbit = (v >> 3) & 0x01;
@@ -535,10 +552,10 @@ int Branch(int v) // Branch - B, BC, BOV, BPL, BEQ, BLT, BLE, BUSC, NOPP, BNC, B
 		// digital states to be sampled by the CPU during the execution of the BEXT
 		// (Branch on EXTernal) instruction
 		// --- I don't know what is meant by 'instruction register'
-		if((InstructionRegister & 0x0F)==(v & 0x0F))
+		if((m->cpu.InstructionRegister & 0x0F)==(v & 0x0F))
 		{
-			if(direction==0) { R[PC] = R[PC]+offset; }
-			if(direction==1) { R[PC] = R[PC]-offset-1; }
+			if(direction==0) { m->cpu.R[PC] = m->cpu.R[PC]+offset; }
+			if(direction==1) { m->cpu.R[PC] = m->cpu.R[PC]-offset-1; }
             return 9;
 		}
 		return 7;
@@ -546,179 +563,179 @@ int Branch(int v) // Branch - B, BC, BOV, BPL, BEQ, BLT, BLE, BUSC, NOPP, BNC, B
 	switch(condition)
 	{
 		case 0: branch = 1; break; // B, NOPP
-		case 1: branch = (Flag_Carry==1); break; // BC, BNC
-		case 2: branch = (Flag_Overflow==1); break; // BOV, BNOV
-		case 3: branch = (Flag_Sign==0); break; // BPL, BMI
-		case 4: branch = (Flag_Zero==1); break; // BEQ, BNEQ
-		case 5: branch = (Flag_Sign!=Flag_Overflow); break; // BLT, BGE
-		case 6: branch = (Flag_Zero==1)||(Flag_Sign!=Flag_Overflow); break; // BLE, BGT
-		case 7: branch = (Flag_Sign!=Flag_Carry); break; // BUSC, BESC
+		case 1: branch = (m->cpu.Flag_Carry==1); break; // BC, BNC
+		case 2: branch = (m->cpu.Flag_Overflow==1); break; // BOV, BNOV
+		case 3: branch = (m->cpu.Flag_Sign==0); break; // BPL, BMI
+		case 4: branch = (m->cpu.Flag_Zero==1); break; // BEQ, BNEQ
+		case 5: branch = (m->cpu.Flag_Sign!=m->cpu.Flag_Overflow); break; // BLT, BGE
+		case 6: branch = (m->cpu.Flag_Zero==1)||(m->cpu.Flag_Sign!=m->cpu.Flag_Overflow); break; // BLE, BGT
+		case 7: branch = (m->cpu.Flag_Sign!=m->cpu.Flag_Carry); break; // BUSC, BESC
 	}
 	if(notbit==1) { branch = !branch; }
 	if(branch)
 	{
-		if(direction==0) { R[PC] = R[PC]+offset; }
-		if(direction==1) { R[PC] = R[PC]-(offset+1); }
+		if(direction==0) { m->cpu.R[PC] = m->cpu.R[PC]+offset; }
+		if(direction==1) { m->cpu.R[PC] = m->cpu.R[PC]-(offset+1); }
 		return 9;
 	}
 	return 7;
 }
-int MVO(int v) // Move Out
+int MVO(struct Machine *m, int v) // Move Out
 {
 	int reg = v & 0x07;
-	int adr = readOperand();
-	writeMem(adr, R[reg]);
+	int adr = readOperand(m);
+	writeMem(m, adr, m->cpu.R[reg]);
 	return 11;
 }
-int MVOa(int v) // MVO@ - Move Out Indirect  0000:0010:01aa:asss
+int MVOa(struct Machine *m, int v) // MVO@ - Move Out Indirect  0000:0010:01aa:asss
 {
 	// The PSHR Rx instruction is an alias for MVOa Rx, R6
 	int areg = (v >> 3) & 0x7;
 	int sreg = v & 0x7;
-	writeIndirect(areg, R[sreg]);
+	writeIndirect(m, areg, m->cpu.R[sreg]);
 	return 9;
 }
-int MVOI(int v) // Move Out Immediate 0000:0010:0111:1sss
+int MVOI(struct Machine *m, int v) // Move Out Immediate 0000:0010:0111:1sss
 {
-	return(MVOa(v)); // call indirect copies R[sss] to address in R[PC]
+	return(MVOa(m, v)); // call indirect copies R[sss] to address in R[PC]
 }
-int MVI(int v) // 	Move In 0000:0010:1000:0rrr  aaaa:aaaa:aaaa:aaaa
+int MVI(struct Machine *m, int v) // 	Move In 0000:0010:1000:0rrr  aaaa:aaaa:aaaa:aaaa
 {
 	int reg = v & 0x07;
-	R[reg] = readOperandIndirect();
+	m->cpu.R[reg] = readOperandIndirect(m);
 	return 10 + EXTRA_IF_R6R7(reg);
 }
-int MVIa(int v) // Move In Indirect 0000:0010:10aa:addd
+int MVIa(struct Machine *m, int v) // Move In Indirect 0000:0010:10aa:addd
 {
 	int areg = (v >> 3) & 0x7;
 	int dreg = v & 0x7;	
-	R[dreg] = readIndirect(areg);
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(dreg) + EXTRA_IF_R6(areg);
+	m->cpu.R[dreg] = readIndirect(m, areg);
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(dreg) + EXTRA_IF_R6(areg);
 }
-int MVII(int v) // Move In Immediate (copies operand to register)
+int MVII(struct Machine *m, int v) // Move In Immediate (copies operand to register)
 {
 	// These instructions are only one word, so don't advance PC past operand.
 	// Auto incrementing registers will move past the operands automatically.
 	// This works exactly like MVI@ with PC as the address register.
 	// All nnnI instructions work this way.
 	v = v | 0x0038;  // set address register to PC
-	return(MVIa(v)); // call indirect
+	return(MVIa(m, v)); // call indirect
 }
-int ADD(int v) // Add
+int ADD(struct Machine *m, int v) // Add
 {
 	int reg = v & 0x07;
-	int val = readOperandIndirect();
-	R[reg] = AddSetSZOC(R[reg], val);
+	int val = readOperandIndirect(m);
+	m->cpu.R[reg] = AddSetSZOC(m, m->cpu.R[reg], val);
 	return 10 + EXTRA_IF_R6R7(reg);;
 }
-int ADDa(int v) // Add Indirect
+int ADDa(struct Machine *m, int v) // Add Indirect
 {
 	int areg = (v >> 3) & 0x07;
 	int dreg = v & 0x07;
-	int val = readIndirect(areg);
-	R[dreg] = AddSetSZOC(R[dreg], val);
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
+	int val = readIndirect(m, areg);
+	m->cpu.R[dreg] = AddSetSZOC(m, m->cpu.R[dreg], val);
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
 }
-int ADDI(int v) // Add Immediate
+int ADDI(struct Machine *m, int v) // Add Immediate
 {
 	v = v | 0x0038;  // set address register to PC
-	return(ADDa(v)); // call indirect
+	return(ADDa(m, v)); // call indirect
 }
-int SUB(int v) // Subtract
+int SUB(struct Machine *m, int v) // Subtract
 {
 	int reg = v & 0x07;
-	int val = readOperandIndirect();
-	R[reg] = SubSetOC(R[reg], val);
-	SetFlagsSZ(reg);
+	int val = readOperandIndirect(m);
+	m->cpu.R[reg] = SubSetOC(m, m->cpu.R[reg], val);
+	SetFlagsSZ(m, reg);
 	return 10 + EXTRA_IF_R6R7(reg);
 }
-int SUBa(int v)  // Subtract Indirect
+int SUBa(struct Machine *m, int v)  // Subtract Indirect
 {
 	int areg = (v >> 3) & 0x07;
 	int dreg = v & 0x07;
-	int val = readIndirect(areg);
-	R[dreg] = SubSetOC(R[dreg], val);
-	SetFlagsSZ(dreg);
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
+	int val = readIndirect(m, areg);
+	m->cpu.R[dreg] = SubSetOC(m, m->cpu.R[dreg], val);
+	SetFlagsSZ(m, dreg);
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
 }
-int SUBI(int v) // Subtract Immediate
+int SUBI(struct Machine *m, int v) // Subtract Immediate
 {
 	v = v | 0x0038;  // set address register to PC
-	return(SUBa(v)); // call indirect
+	return(SUBa(m, v)); // call indirect
 }
-int CMP(int v)
+int CMP(struct Machine *m, int v)
 {
 	int reg = v & 0x07;
-	int val = readOperandIndirect();
-	int res = SubSetOC(R[reg], val);
-	Flag_Sign = (res & 0x8000)!=0;
-	Flag_Zero = res==0;
+	int val = readOperandIndirect(m);
+	int res = SubSetOC(m, m->cpu.R[reg], val);
+	m->cpu.Flag_Sign = (res & 0x8000)!=0;
+	m->cpu.Flag_Zero = res==0;
 	return 10 + EXTRA_IF_R6R7(reg);
 }
-int CMPa(int v)
+int CMPa(struct Machine *m, int v)
 {
 	int areg = (v >> 3) & 0x07;
 	int dreg = v & 0x07;
-	int val = readIndirect(areg);
-	int res = SubSetOC(R[dreg], val);
-	Flag_Sign = (res & 0x8000)!=0;
-	Flag_Zero = res==0;
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
+	int val = readIndirect(m, areg);
+	int res = SubSetOC(m, m->cpu.R[dreg], val);
+	m->cpu.Flag_Sign = (res & 0x8000)!=0;
+	m->cpu.Flag_Zero = res==0;
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
 }
-int CMPI(int v) // CMP Immediate
+int CMPI(struct Machine *m, int v) // CMP Immediate
 {
 	v = v | 0x0038;  // set address register to PC
-	return(CMPa(v)); // call indirect
+	return(CMPa(m, v)); // call indirect
 }
-int AND(int v) // And
+int AND(struct Machine *m, int v) // And
 {
 	int reg = v & 0x07;
-	int val = readOperandIndirect();
-	R[reg] = R[reg] & val;
-	SetFlagsSZ(reg);
+	int val = readOperandIndirect(m);
+	m->cpu.R[reg] = m->cpu.R[reg] & val;
+	SetFlagsSZ(m, reg);
 	return 10 + EXTRA_IF_R6R7(reg);
 }
-int ANDa(int v) // And Indirect
+int ANDa(struct Machine *m, int v) // And Indirect
 {
 	int areg = (v >> 3) & 0x07;
 	int dreg = v & 0x07;
-	int val = readIndirect(areg);
-	R[dreg] = R[dreg] & val;
-	SetFlagsSZ(dreg);
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
+	int val = readIndirect(m, areg);
+	m->cpu.R[dreg] = m->cpu.R[dreg] & val;
+	SetFlagsSZ(m, dreg);
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
 }
-int ANDI(int v) // And Immediate
+int ANDI(struct Machine *m, int v) // And Immediate
 {
 	v = v | 0x0038;  // set address register to PC
-	return(ANDa(v)); // call indirect
+	return(ANDa(m, v)); // call indirect
 }
-int XOR(int v) // Xor
+int XOR(struct Machine *m, int v) // Xor
 {
 	int reg = v & 0x07;
-	int val = readOperandIndirect();
-	R[reg] = R[reg] ^ val;
-	SetFlagsSZ(reg);
+	int val = readOperandIndirect(m);
+	m->cpu.R[reg] = m->cpu.R[reg] ^ val;
+	SetFlagsSZ(m, reg);
 	return 10 + EXTRA_IF_R6R7(reg);
 }
-int XORa(int v) // Xor Indirect
+int XORa(struct Machine *m, int v) // Xor Indirect
 {
 	int areg = (v >> 3) & 0x07;
 	int dreg = v & 0x07;
-	int val = readIndirect(areg);
-	R[dreg] = R[dreg] ^ val;
-	SetFlagsSZ(dreg);
-    return (Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
+	int val = readIndirect(m, areg);
+	m->cpu.R[dreg] = m->cpu.R[dreg] ^ val;
+	SetFlagsSZ(m, dreg);
+    return (m->cpu.Flag_DoubleByteData == 1 ? 10 : 8) + EXTRA_IF_R6R7(areg) + EXTRA_IF_R6(areg);
 }
-int XORI(int v) // Xor Immediate
+int XORI(struct Machine *m, int v) // Xor Immediate
 {
 	v = v | 0x0038;  // set address register to PC
-	return(XORa(v)); // call indirect
+	return(XORa(m, v)); // call indirect
 }
 
 // Make a big table of function pointers for opcodes
 // as well as a table of flags so that opcodes can
 // be quickly executed and determined to be interuptable 
-void addInstruction(int start, int end, int caninterupt, const char *name, int (*callback)(int))
+void addInstruction(int start, int end, int caninterupt, const char *name, int (*callback)(struct Machine *, int))
 {
 	int i;
 	for(i=start; i<=end; i++)
@@ -731,6 +748,11 @@ void addInstruction(int start, int end, int caninterupt, const char *name, int (
 
 void CP1610Init()
 {
+	static int done = 0;
+
+	if(done) { return; } // the tables are shared by every machine
+	done = 1;
+
 	addInstruction(0x0000, 0x0000, 0, "HLT   ", HLT   );
 	addInstruction(0x0001, 0x0001, 0, "SDBD  ", SDBD  );
 	addInstruction(0x0002, 0x0002, 0, "EIS   ", EIS   );
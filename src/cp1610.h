@@ -18,23 +18,34 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-struct CP1610serialized {
-    int Flag_DoubleByteData;
-    int Flag_InteruptEnable;
-    int Flag_Carry;
-    int Flag_Sign;
-    int Flag_Zero;
-    int Flag_Overflow;
-    unsigned int R[8];
+struct StateBuffer;
+struct Machine;
+
+struct CP1610 {
+	unsigned int R[8]; // Registers R0-R7
+	int InstructionRegister; // four external lines?
+	int Flag_DoubleByteData;
+	int Flag_InteruptEnable;
+	int Flag_Carry;
+	int Flag_Sign;
+	int Flag_Zero;
+	int Flag_Overflow;
 };
 
-void CP1610Serialize(struct CP1610serialized *);
-void CP1610Unserialize(const struct CP1610serialized *);
+void CP1610Serialize(struct Machine *m, struct StateBuffer *); // writes the "CPU " chunk
+void CP1610Unserialize(struct Machine *m, struct StateBuffer *);
 
-void CP1610Init(void); // Adds opcodes to lookup tables
+void CP1610Init(void); // Adds opcodes to lookup tables, shared by all machines
 
-void CP1610Reset(void); // reset cpu
+extern const char *Nmemonic[0x400]; // opcode names, filled in by CP1610Init
 
-int CP1610Tick(int debug); // execute a single instruction, return cycles used
+void CP1610Reset(struct Machine *m); // reset cpu
+
+int CP1610Tick(struct Machine *m, int debug); // execute a single instruction, return cycles used
+
+// Formats the state before running instruction as a line in the same
+// layout as jzIntv's debugger trace, so the two can be diffed
+#define CP1610_TRACE_LINE 96
+void CP1610Trace(const struct CP1610 *cpu, int instruction, int sr1, long count, char *line, int size);
 
 #endif
@@ -0,0 +1,289 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "heatmap.h"
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#define TRACE_RECORD 8
+#define TRACE_CHUNK 65536 // records
+#define TRACE_CHUNKS 8
+
+// The emulator fills chunks in turn and the writer thread empties them in
+// the same order.  filled and written count chunks since the start; the
+// emulator waits when all of them are waiting to be written.
+struct BusTrace {
+	FILE *fp;
+	unsigned char *chunks[TRACE_CHUNKS];
+	int lengths[TRACE_CHUNKS]; // records in each filled chunk
+	int fill; // records in the chunk being filled
+	unsigned long filled;
+	unsigned long written;
+	int error;
+
+#ifdef HAVE_PTHREAD
+	pthread_t writer;
+	pthread_mutex_t lock;
+	pthread_cond_t ready;
+	pthread_cond_t space;
+	int quit;
+#endif
+};
+
+static const char *deviceNames[HEATMAP_DEVICES] = { "STIC", "PSG", "Intellivoice" };
+
+struct Heatmap *HeatmapCreate(void)
+{
+	return (struct Heatmap *)calloc(1, sizeof(struct Heatmap));
+}
+
+void HeatmapDestroy(struct Heatmap *h)
+{
+	if (h == NULL)
+		return;
+	HeatmapTraceEnd(h);
+	free(h);
+}
+
+static void writeChunk(struct BusTrace *t, int i)
+{
+	if (fwrite(t->chunks[i], TRACE_RECORD, t->lengths[i], t->fp) != (size_t)t->lengths[i])
+		t->error = 1;
+}
+
+#ifdef HAVE_PTHREAD
+static void *writerMain(void *arg)
+{
+	struct BusTrace *t = (struct BusTrace *)arg;
+	int i;
+
+	pthread_mutex_lock(&t->lock);
+	for (;;)
+	{
+		while (t->written == t->filled && !t->quit)
+			pthread_cond_wait(&t->ready, &t->lock);
+		if (t->written == t->filled)
+			break;
+		i = t->written % TRACE_CHUNKS;
+		pthread_mutex_unlock(&t->lock);
+
+		writeChunk(t, i);
+
+		pthread_mutex_lock(&t->lock);
+		t->written++;
+		pthread_cond_signal(&t->space);
+	}
+	pthread_mutex_unlock(&t->lock);
+	return NULL;
+}
+#endif
+
+// Hands the chunk being filled to the writer and waits for a free one
+static void submitChunk(struct BusTrace *t)
+{
+	t->lengths[t->filled % TRACE_CHUNKS] = t->fill;
+	t->fill = 0;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&t->lock);
+	t->filled++;
+	pthread_cond_signal(&t->ready);
+	while (t->filled - t->written >= TRACE_CHUNKS)
+		pthread_cond_wait(&t->space, &t->lock);
+	pthread_mutex_unlock(&t->lock);
+#else
+	writeChunk(t, t->filled % TRACE_CHUNKS);
+	t->filled++;
+	t->written++;
+#endif
+}
+
+static void freeTrace(struct BusTrace *t)
+{
+	int i;
+
+	for (i = 0; i < TRACE_CHUNKS; i++)
+		free(t->chunks[i]);
+	free(t);
+}
+
+int HeatmapTrace(struct Heatmap *h, const char *path)
+{
+	struct BusTrace *t;
+	int i;
+
+	HeatmapTraceEnd(h);
+	t = (struct BusTrace *)calloc(1, sizeof(struct BusTrace));
+	if (t == NULL)
+		return 0;
+	for (i = 0; i < TRACE_CHUNKS; i++)
+	{
+		t->chunks[i] = (unsigned char *)malloc(TRACE_CHUNK * TRACE_RECORD);
+		if (t->chunks[i] == NULL)
+		{
+			freeTrace(t);
+			return 0;
+		}
+	}
+	t->fp = fopen(path, "wb");
+	if (t->fp == NULL)
+	{
+		freeTrace(t);
+		return 0;
+	}
+	if (fwrite("FIBTRACE", 1, 8, t->fp) != 8)
+		t->error = 1;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_init(&t->lock, NULL);
+	pthread_cond_init(&t->ready, NULL);
+	pthread_cond_init(&t->space, NULL);
+	if (pthread_create(&t->writer, NULL, writerMain, t) != 0)
+	{
+		pthread_cond_destroy(&t->space);
+		pthread_cond_destroy(&t->ready);
+		pthread_mutex_destroy(&t->lock);
+		fclose(t->fp);
+		freeTrace(t);
+		return 0;
+	}
+#endif
+	h->trace = t;
+	return 1;
+}
+
+int HeatmapTraceEnd(struct Heatmap *h)
+{
+	struct BusTrace *t = h->trace;
+	int ok;
+
+	if (t == NULL)
+		return 1;
+	if (t->fill)
+		submitChunk(t);
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&t->lock);
+	t->quit = 1;
+	pthread_cond_signal(&t->ready);
+	pthread_mutex_unlock(&t->lock);
+	pthread_join(t->writer, NULL);
+	pthread_cond_destroy(&t->space);
+	pthread_cond_destroy(&t->ready);
+	pthread_mutex_destroy(&t->lock);
+#endif
+	ok = !t->error;
+	if (fclose(t->fp) != 0)
+		ok = 0;
+	freeTrace(t);
+	h->trace = NULL;
+	return ok;
+}
+
+void HeatmapAccess(struct Heatmap *h, int kind, int adr, int val)
+{
+	struct BusTrace *t = h->trace;
+
+	h->pages[kind][adr >> MEMORY_PAGE_SHIFT]++;
+	if (kind != HEATMAP_EXECUTES)
+	{
+		if ((adr & 0x3FC0) == 0x0000)
+			h->devices[HEATMAP_STIC][kind]++;
+		else if (adr >= 0x1F0 && adr <= 0x1FF)
+			h->devices[HEATMAP_PSG][kind]++;
+		else if (adr == 0x80 || adr == 0x81)
+			h->devices[HEATMAP_IVOICE][kind]++;
+	}
+
+	if (t)
+	{
+		unsigned char *r = t->chunks[t->filled % TRACE_CHUNKS] + t->fill * TRACE_RECORD;
+		uint32_t word = (uint32_t)(h->cycle << 2) | kind;
+
+		r[0] = word & 0xFF;
+		r[1] = (word >> 8) & 0xFF;
+		r[2] = (word >> 16) & 0xFF;
+		r[3] = word >> 24;
+		r[4] = adr & 0xFF;
+		r[5] = (adr >> 8) & 0xFF;
+		r[6] = val & 0xFF;
+		r[7] = (val >> 8) & 0xFF;
+		if (++t->fill == TRACE_CHUNK)
+			submitChunk(t);
+	}
+}
+
+static uint64_t pageTotal(struct Heatmap *h, int page)
+{
+	return h->pages[HEATMAP_READS][page] + h->pages[HEATMAP_WRITES][page] + h->pages[HEATMAP_EXECUTES][page];
+}
+
+void HeatmapReport(struct Heatmap *h, FILE *fp, int top)
+{
+	int order[MEMORY_PAGES];
+	uint64_t totals[HEATMAP_KINDS] = { 0, 0, 0 };
+	uint64_t fromRam = 0;
+	int i, j, k;
+
+	for (i = 0; i < MEMORY_PAGES; i++)
+	{
+		for (k = 0; k < HEATMAP_KINDS; k++)
+			totals[k] += h->pages[k][i];
+		if (h->pages[HEATMAP_WRITES][i])
+			fromRam += h->pages[HEATMAP_EXECUTES][i];
+	}
+	fprintf(fp, "%llu reads, %llu writes, %llu instructions in %llu cycles\n",
+		(unsigned long long)totals[HEATMAP_READS], (unsigned long long)totals[HEATMAP_WRITES],
+		(unsigned long long)totals[HEATMAP_EXECUTES], (unsigned long long)h->cycle);
+	if (totals[HEATMAP_EXECUTES])
+		fprintf(fp, "%llu instructions (%.2f%%) ran from pages that were written to\n",
+			(unsigned long long)fromRam, 100.0 * fromRam / totals[HEATMAP_EXECUTES]);
+
+	fprintf(fp, "\n%-14s %12s %12s\n", "device", "reads", "writes");
+	for (i = 0; i < HEATMAP_DEVICES; i++)
+		fprintf(fp, "%-14s %12llu %12llu\n", deviceNames[i],
+			(unsigned long long)h->devices[i][HEATMAP_READS], (unsigned long long)h->devices[i][HEATMAP_WRITES]);
+
+	// busiest pages first, insertion sort is plenty for 256
+	for (i = 0; i < MEMORY_PAGES; i++)
+	{
+		for (j = i; j > 0 && pageTotal(h, order[j - 1]) < pageTotal(h, i); j--)
+			order[j] = order[j - 1];
+		order[j] = i;
+	}
+	fprintf(fp, "\n%-11s %12s %12s %12s\n", "page", "reads", "writes", "executes");
+	for (i = 0; i < MEMORY_PAGES && i < top && pageTotal(h, order[i]); i++)
+		fprintf(fp, "$%04X-$%04X %12llu %12llu %12llu\n", order[i] << MEMORY_PAGE_SHIFT,
+			((order[i] + 1) << MEMORY_PAGE_SHIFT) - 1,
+			(unsigned long long)h->pages[HEATMAP_READS][order[i]],
+			(unsigned long long)h->pages[HEATMAP_WRITES][order[i]],
+			(unsigned long long)h->pages[HEATMAP_EXECUTES][order[i]]);
+}
+
+int HeatmapWritePages(struct Heatmap *h, const char *path)
+{
+	FILE *fp = fopen(path, "w");
+	int i;
+
+	if (fp == NULL)
+		return 0;
+	for (i = 0; i < MEMORY_PAGES; i++)
+		fprintf(fp, "%02X %llu %llu %llu\n", i, (unsigned long long)h->pages[HEATMAP_READS][i],
+			(unsigned long long)h->pages[HEATMAP_WRITES][i], (unsigned long long)h->pages[HEATMAP_EXECUTES][i]);
+	return fclose(fp) == 0;
+}
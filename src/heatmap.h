@@ -0,0 +1,89 @@
+#ifndef HEATMAP_H
+#define HEATMAP_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include "memory.h"
+
+// Memory heatmap: reads, writes and instructions executed per 256-word
+// page, plus the accesses that reach the STIC, PSG and Intellivoice.
+// Reads include instruction fetches and operands.  It can also stream
+// every bus access to a file, written from a background thread when built
+// with HAVE_PTHREAD.
+//
+// Built with FREEINTV_HEATMAP, readMem(), writeMem() and CP1610Tick report
+// to the machine's heatmap, if it has one.  Without it the hooks compile
+// to nothing.
+//
+// The trace file is "FIBTRACE" followed by 8-byte records, little endian:
+// a 32-bit word holding the access kind in bits 0-1 (enum HeatmapKind)
+// and the low 30 bits of the CPU cycle above them, the 16-bit address,
+// then the 16-bit value (the opcode for executes).  The cycle is when the
+// instruction making the access started; it wraps every 2^30 cycles, and
+// consecutive records are never that far apart.
+
+enum HeatmapKind {
+	HEATMAP_READS,
+	HEATMAP_WRITES,
+	HEATMAP_EXECUTES,
+	HEATMAP_KINDS
+};
+
+enum HeatmapDevice {
+	HEATMAP_STIC,
+	HEATMAP_PSG,
+	HEATMAP_IVOICE,
+	HEATMAP_DEVICES
+};
+
+struct BusTrace;
+
+struct Heatmap {
+	uint64_t pages[HEATMAP_KINDS][MEMORY_PAGES];
+	uint64_t devices[HEATMAP_DEVICES][2]; // reads and writes
+	uint64_t cycle; // CPU cycles since the heatmap was made
+	struct BusTrace *trace; // NULL unless streaming
+};
+
+struct Heatmap *HeatmapCreate(void); // NULL if out of memory
+void HeatmapDestroy(struct Heatmap *h); // finishes any trace first
+
+int HeatmapTrace(struct Heatmap *h, const char *path); // starts streaming, 0 on error
+int HeatmapTraceEnd(struct Heatmap *h); // flushes and closes the trace, 0 on a write error
+
+void HeatmapAccess(struct Heatmap *h, int kind, int adr, int val);
+
+void HeatmapReport(struct Heatmap *h, FILE *fp, int top); // summary and the top pages
+int HeatmapWritePages(struct Heatmap *h, const char *path); // "page reads writes executes" lines, 0 on error
+
+#ifdef FREEINTV_HEATMAP
+#define HEATMAP_ACCESS(m, kind, adr, val) do { \
+		if ((m)->heatmap) \
+			HeatmapAccess((m)->heatmap, (kind), (adr), (val)); \
+	} while (0)
+#define HEATMAP_TICK(m, ticks) do { \
+		if ((m)->heatmap) \
+			(m)->heatmap->cycle += (ticks); \
+	} while (0)
+#else
+#define HEATMAP_ACCESS(m, kind, adr, val) ((void)0)
+#define HEATMAP_TICK(m, ticks) ((void)0)
+#endif
+
+#endif
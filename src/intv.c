@@ -17,6 +17,7 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "intv.h"
 #include "memory.h"
 #include "cp1610.h"
@@ -26,15 +27,53 @@
 #include "cart.h"
 #include "osd.h"
 #include "ivoice.h"
+#include "state.h"
+#include "perf.h"
+#include "timeline.h"
 
-int SR1;
-int intv_halt;
+struct Machine *MachineCreate(void)
+{
+	struct Machine *m = (struct Machine *)calloc(1, sizeof(struct Machine));
 
-int exec(void);
+	if (m == NULL)
+		return NULL;
+	if (!MemoryAlloc(m))
+	{
+		free(m);
+		return NULL;
+	}
+	Init(m);
+	Reset(m);
+	return m;
+}
 
-void LoadGame(const char* path) // load cart rom //
+struct Machine *MachineClone(const struct Machine *src)
 {
-	if(LoadCart(path))
+	struct Machine *m = (struct Machine *)malloc(sizeof(struct Machine));
+
+	if (m == NULL)
+		return NULL;
+	memcpy(m, src, sizeof(struct Machine));
+	if (!MemoryClone(m, src))
+	{
+		MachineDestroy(m);
+		return NULL;
+	}
+	return m;
+}
+
+void MachineDestroy(struct Machine *m)
+{
+	if (m == NULL)
+		return;
+	ivoice_dtor(&m->ivoice);
+	MemoryFree(m);
+	free(m);
+}
+
+static void cartLoaded(struct Machine *m, int ok)
+{
+	if(ok)
 	{
 		OSD_drawText(3, 3, "LOAD CART: OKAY");
 	}
@@ -42,90 +81,161 @@ void LoadGame(const char* path) // load cart rom //
 	{
 		OSD_drawText(3, 3, "LOAD CART: FAIL");
 	}
+	MemoryTouchAll(m); // the cart was written straight into memory
+}
+
+void LoadGame(struct Machine *m, const char* path) // load cart rom //
+{
+	cartLoaded(m, LoadCart(m, path));
 }
 
-void loadExec(const char* path)
+void LoadGameData(struct Machine *m, const void *data, size_t size)
+{
+	cartLoaded(m, LoadCartData(m, data, size));
+}
+
+int loadExec(struct Machine *m, const char* path)
 {
 	// EXEC lives at 0x1000-0x1FFF
-	int i;
-	unsigned char word[2];
+	unsigned char rom[0x2000];
 	FILE *fp;
 	if((fp = fopen(path,"rb"))!=NULL)
 	{
-		for(i=0x1000; i<=0x1FFF; i++)
-		{
-			fread(word,sizeof(word),1,fp);
-			Memory[i] = (word[0]<<8) | word[1];
-		}
+		memset(rom, 0, sizeof(rom)); // a short file leaves the rest zero
+		fread(rom, 1, sizeof(rom), fp);
+		MemoryLoadWords(m, 0x1000, rom, 0x1000);
 
 		fclose(fp);
 		OSD_drawText(3, 1, "LOAD EXEC: OKAY");
 		printf("[INFO] [FREEINTV] Succeeded loading Executive BIOS from: %s\n", path);		
+		return 1;
 	}
 	else
 	{
 		OSD_drawText(3, 1, "LOAD EXEC: FAIL");
         OSD_drawTextBG(3, 6, "PUT GROM/EXEC IN SYSTEM DIRECTORY");
 		printf("[ERROR] [FREEINTV] Failed loading Executive BIOS from: %s\n", path);
+		return 0;
 	}
 }
 
-void loadGrom(const char* path)
+int loadGrom(struct Machine *m, const char* path)
 {
 	// GROM lives at 0x3000-0x37FF
-	int i;
-	unsigned char word[1];
+	unsigned char rom[0x800];
 	FILE *fp;
 	if((fp = fopen(path,"rb"))!=NULL)
 	{
-		for(i=0x3000; i<=0x37FF; i++)
-		{
-			fread(word,sizeof(word),1,fp);
-			Memory[i] = word[0];
-		}
+		memset(rom, 0, sizeof(rom));
+		fread(rom, 1, sizeof(rom), fp);
+		MemoryLoadBytes(m, 0x3000, rom, 0x800);
 
 		fclose(fp);
 		OSD_drawText(3, 2, "LOAD GROM: OKAY");
 		printf("[INFO] [FREEINTV] Succeeded loading Graphics BIOS from: %s\n", path);
-		
+		return 1;
 	}
 	else
 	{
 		OSD_drawText(3, 2, "LOAD GROM: FAIL");
         OSD_drawTextBG(3, 6, "PUT GROM/EXEC IN SYSTEM DIRECTORY");
 		printf("[ERROR] [FREEINTV] Failed loading Graphics BIOS from: %s\n", path);
+		return 0;
 	}
 }
 
-void Reset()
+void Reset(struct Machine *m)
 {
-	SR1 = 0;
-    intv_halt = 0;
-	CP1610Reset();
-	STICReset();
-    ivoice_reset();
+	m->SR1 = 0;
+    m->halt = 0;
+	CP1610Reset(m);
+	STICReset(m);
+    ivoice_reset(&m->ivoice);
 }
 
-void Init()
+void Init(struct Machine *m)
 {
 	CP1610Init();
-	MemoryInit();
-    PSGInit();
-    ivoice_init(0, 1.0);
+	MemoryInit(m);
+    PSGInit(m);
+    ivoice_init(&m->ivoice, 0);
 }
 
-void Run()
+void SerializeMachine(struct Machine *m, struct StateBuffer *state, int memory)
+{
+	size_t mark;
+
+	CP1610Serialize(m, state);
+	STICSerialize(m, state);
+	PSGSerialize(m, state);
+	ivoiceSerialize(&m->ivoice, state);
+	if (memory)
+		MemorySerialize(m, state);
+
+	mark = StateChunkBegin(state, "INTV");
+	StatePutInt(state, m->SR1);
+	StatePut8(state, m->halt);
+	StateChunkEnd(state, mark);
+}
+
+int UnserializeMachine(struct Machine *m, struct StateBuffer *state, int memory)
+{
+	// check every chunk is present before touching the machine
+	if (!StateChunkOpen(state, "CPU ") || !StateChunkOpen(state, "STIC") ||
+		!StateChunkOpen(state, "PSG ") || !StateChunkOpen(state, "IVOC") ||
+		(memory && !StateChunkOpen(state, "MEM ")) || !StateChunkOpen(state, "INTV"))
+		return 0;
+
+	CP1610Unserialize(m, state);
+	STICUnserialize(m, state);
+	PSGUnserialize(m, state);
+	ivoiceUnserialize(&m->ivoice, state);
+	if (memory)
+		MemoryUnserialize(m, state);
+	if (StateChunkOpen(state, "INTV"))
+	{
+		m->SR1 = StateGetInt(state);
+		m->halt = StateGet8(state);
+	}
+	return !state->error;
+}
+
+void Run(struct Machine *m)
 {
     // run for one frame
 	// exec will call drawFrame for us only when needed
-	while(exec()) { }
+	PERF_PHASE(PERF_CPU);
+	while(exec(m)) { }
+	PERF_PHASE(PERF_OTHER);
+}
+
+// The PSG and Intellivoice ticks after one instruction in PERF_SAMPLE_EVERY,
+// timed for the counters
+static void tickSoundCounted(struct Machine *m, int ticks)
+{
+	static int countdown;
+	uint64_t start, middle;
+
+	if (--countdown > 0)
+	{
+		PSGTick(m, ticks);
+		ivoice_tk(&m->ivoice, ticks);
+		return;
+	}
+	countdown = PERF_SAMPLE_EVERY;
+	start = PerfNow();
+	PSGTick(m, ticks);
+	middle = PerfNow();
+	ivoice_tk(&m->ivoice, ticks);
+	PerfSample(PERF_IVOICE, PerfNow() - middle);
+	PerfSample(PERF_PSG, middle - start);
 }
 
-int exec(void) // Run one instruction 
+int exec(struct Machine *m) // Run one instruction 
 {
     int ticks;
     
-    ticks = CP1610Tick(0); // Tick CP-1610 CPU, runs one instruction, returns used cycles
+    ticks = CP1610Tick(m, 0); // Tick CP-1610 CPU, runs one instruction, returns used cycles
 
 	if(ticks==0)    // Undefined instruction (>= 0x0400) or HLT
 	{
@@ -133,90 +243,128 @@ int exec(void) // Run one instruction
 #if 0
         {
             FILE *debug_file;
-            extern unsigned int R[];
+            unsigned int *R = m->cpu.R;
 
-            fprintf(stdout, "%04x:[%03x] %04x %04x %04x %04x %04x %04x %04x\n", R[7] - 1, readMem(R[7] - 1), R[0], R[1], R[2], R[3], R[4], R[5], R[6]);
-            fprintf(stdout, "%04x:[%03x] %04x %04x %04x %04x %04x %04x %04x\n", R[7], readMem(R[7]), R[0], R[1], R[2], R[3], R[4], R[5], R[6]);
+            fprintf(stdout, "%04x:[%03x] %04x %04x %04x %04x %04x %04x %04x\n", R[7] - 1, readMem(m, R[7] - 1), R[0], R[1], R[2], R[3], R[4], R[5], R[6]);
+            fprintf(stdout, "%04x:[%03x] %04x %04x %04x %04x %04x %04x %04x\n", R[7], readMem(m, R[7]), R[0], R[1], R[2], R[3], R[4], R[5], R[6]);
         }
 #endif
-        intv_halt = 1;
+        m->halt = 1;
 		return 0;
 	}
 
-	// Tick PSG
-	PSGTick(ticks);
- 
-    // Tick Intellivoice
-    ivoice_tk(ticks);
+	// Tick PSG and Intellivoice
+	if (PerfCounting)
+		tickSoundCounted(m, ticks);
+	else
+	{
+		PERF_MARK(PERF_PSG);
+		PSGTick(m, ticks);
+		PERF_MARK(PERF_IVOICE);
+		ivoice_tk(&m->ivoice, ticks);
+		PERF_MARK(PERF_CPU);
+	}
     
-    if(SR1>0)
+    if(m->SR1>0)
     {
-        SR1 = SR1 - ticks;
-        if(SR1<0) { SR1 = 0; }
+        m->SR1 = m->SR1 - ticks;
+        if(m->SR1<0) { m->SR1 = 0; }
     }
     
-    phase_len -= ticks;
-    if (phase_len < 0) {
-        stic_phase = (stic_phase + 1) & 15;
-        switch (stic_phase) {
+    m->stic.phase_len -= ticks;
+    if (m->stic.phase_len < 0) {
+        m->stic.phase = (m->stic.phase + 1) & 15;
+        TIMELINE_MARK(TIMELINE_STIC_PHASE, m->stic.phase);
+        switch (m->stic.phase) {
             case 0: // Start of VBLANK
-                stic_reg = 1;   // STIC registers accessible
-                stic_gram = 1;  // GRAM accessible
-                phase_len += 2900;
-                SR1 = phase_len;
+                m->stic.reg = 1;   // STIC registers accessible
+                m->stic.gram = 1;  // GRAM accessible
+                m->stic.phase_len += 2900;
+                m->SR1 = m->stic.phase_len;
                 // Render Frame //
-                STICDrawFrame(stic_vid_enable);
+                PERF_PHASE(PERF_STIC);
+                TIMELINE_BEGIN(TIMELINE_STIC_RENDER);
+                STICDrawFrame(m, m->stic.vid_enable);
+                TIMELINE_END(TIMELINE_STIC_RENDER);
                 // The following line was below just after
                 //   "stic_vid_enable = DisplayEnabled;"
                 // It caused D1K Homebrew to fail:
                 // o D1K misses a video interrupt.
                 // o However it updates DisplayEnabled in time (writing to 0x20)
                 // o So the DisplayEnabled variable should be reset here.
-                DisplayEnabled = 0;
+                m->stic.DisplayEnabled = 0;
                 return 0;
             case 1:
-                phase_len += 3796 - 2900;
-                stic_vid_enable = DisplayEnabled;
-                if (stic_vid_enable)
-                    stic_reg = 0;   // STIC registers now inaccessible
-                stic_gram = 1;  // GRAM accessible
+                m->stic.phase_len += 3796 - 2900;
+                m->stic.vid_enable = m->stic.DisplayEnabled;
+                if (m->stic.vid_enable)
+                    m->stic.reg = 0;   // STIC registers now inaccessible
+                m->stic.gram = 1;  // GRAM accessible
                 break;
             case 2:
-                delayV = ((Memory[0x31])&0x7);
-                delayH = ((Memory[0x30])&0x7);
-                phase_len += 120 + 114 * delayV + delayH;
-                if (stic_vid_enable) {
-                    stic_gram = 0;  // GRAM now inaccessible
-                    phase_len -= 68;    // BUSRQ period (STIC reads RAM)
-                    PSGTick(68);
-                    ivoice_tk(68);
+                m->stic.delayV = ((MemoryPeek(m, 0x31))&0x7);
+                m->stic.delayH = ((MemoryPeek(m, 0x30))&0x7);
+                m->stic.phase_len += 120 + 114 * m->stic.delayV + m->stic.delayH;
+                if (m->stic.vid_enable) {
+                    m->stic.gram = 0;  // GRAM now inaccessible
+                    m->stic.phase_len -= 68;    // BUSRQ period (STIC reads RAM)
+                    PERF_PHASE(PERF_PSG);
+                    TIMELINE_BEGIN(TIMELINE_PSG_CATCHUP);
+                    PSGTick(m, 68);
+                    TIMELINE_END(TIMELINE_PSG_CATCHUP);
+                    PERF_PHASE(PERF_IVOICE);
+                    TIMELINE_BEGIN(TIMELINE_IVOICE_CATCHUP);
+                    ivoice_tk(&m->ivoice, 68);
+                    TIMELINE_END(TIMELINE_IVOICE_CATCHUP);
+                    PERF_PHASE(PERF_CPU);
                 }
                 break;
             default:
-                phase_len += 912;
-                if (stic_vid_enable) {
-                    phase_len -= 108;   // BUSRQ period (STIC reads RAM)
-                    PSGTick(108);
-                    ivoice_tk(108);
+                m->stic.phase_len += 912;
+                if (m->stic.vid_enable) {
+                    m->stic.phase_len -= 108;   // BUSRQ period (STIC reads RAM)
+                    PERF_PHASE(PERF_PSG);
+                    TIMELINE_BEGIN(TIMELINE_PSG_CATCHUP);
+                    PSGTick(m, 108);
+                    TIMELINE_END(TIMELINE_PSG_CATCHUP);
+                    PERF_PHASE(PERF_IVOICE);
+                    TIMELINE_BEGIN(TIMELINE_IVOICE_CATCHUP);
+                    ivoice_tk(&m->ivoice, 108);
+                    TIMELINE_END(TIMELINE_IVOICE_CATCHUP);
+                    PERF_PHASE(PERF_CPU);
                 }
                 break;
             case 14:
-                delayV = ((Memory[0x31])&0x7);
-                delayH = ((Memory[0x30])&0x7);
-                phase_len += 912 - 114 * delayV - delayH;
-                if (stic_vid_enable) {
-                    phase_len -= 108;   // BUSRQ period (STIC reads RAM)
-                    PSGTick(108);
-                    ivoice_tk(108);
+                m->stic.delayV = ((MemoryPeek(m, 0x31))&0x7);
+                m->stic.delayH = ((MemoryPeek(m, 0x30))&0x7);
+                m->stic.phase_len += 912 - 114 * m->stic.delayV - m->stic.delayH;
+                if (m->stic.vid_enable) {
+                    m->stic.phase_len -= 108;   // BUSRQ period (STIC reads RAM)
+                    PERF_PHASE(PERF_PSG);
+                    TIMELINE_BEGIN(TIMELINE_PSG_CATCHUP);
+                    PSGTick(m, 108);
+                    TIMELINE_END(TIMELINE_PSG_CATCHUP);
+                    PERF_PHASE(PERF_IVOICE);
+                    TIMELINE_BEGIN(TIMELINE_IVOICE_CATCHUP);
+                    ivoice_tk(&m->ivoice, 108);
+                    TIMELINE_END(TIMELINE_IVOICE_CATCHUP);
+                    PERF_PHASE(PERF_CPU);
                 }
                 break;
             case 15:
-                delayV = ((Memory[0x31])&0x7);
-                phase_len += 57 + 17;
-                if (stic_vid_enable && delayV == 0) {
-                    phase_len -= 38;    // BUSRQ period (STIC reads RAM)
-                    PSGTick(38);
-                    ivoice_tk(38);
+                m->stic.delayV = ((MemoryPeek(m, 0x31))&0x7);
+                m->stic.phase_len += 57 + 17;
+                if (m->stic.vid_enable && m->stic.delayV == 0) {
+                    m->stic.phase_len -= 38;    // BUSRQ period (STIC reads RAM)
+                    PERF_PHASE(PERF_PSG);
+                    TIMELINE_BEGIN(TIMELINE_PSG_CATCHUP);
+                    PSGTick(m, 38);
+                    TIMELINE_END(TIMELINE_PSG_CATCHUP);
+                    PERF_PHASE(PERF_IVOICE);
+                    TIMELINE_BEGIN(TIMELINE_IVOICE_CATCHUP);
+                    ivoice_tk(&m->ivoice, 38);
+                    TIMELINE_END(TIMELINE_IVOICE_CATCHUP);
+                    PERF_PHASE(PERF_CPU);
                 }
                 break;
                 
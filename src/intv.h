@@ -18,22 +18,70 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#define AUDIO_FREQUENCY     44100
+#include <stddef.h>
+#include "memory.h"
+#include "cp1610.h"
+#include "stic.h"
+#include "psg.h"
+#include "ivoice.h"
+#include "mixer.h"
 
-extern int SR1; // SR1 line for interrupt
+// Everything one console needs.  Several can run side by side in one
+// process; the opcode, colour and filter tables they share are read-only
+// once built.
+struct Machine {
+	const unsigned int *MemoryPage[MEMORY_PAGES]; // see MemoryPeek()
+	unsigned int *MemoryOwned[MEMORY_PAGES]; // NULL while the page is shared
+	unsigned int *MemoryFlat; // NULL once shared
+	struct MemoryImage *MemoryShared;
+	unsigned char MemoryDirty[MEMORY_BLOCKS];
+	int d000_ram; /* 1 = $D000-$D3FF is 8-bit RAM (e.g. USCF Chess) */
+#ifdef FREEINTV_TRACE
+	struct MemoryWrite MemoryWrites[MEMORY_WRITE_LOG]; // see MemoryLogWrite()
+	int MemoryWriteCount;
+#endif
+#ifdef FREEINTV_PROFILE
+	struct Profile *profile; // see profile.h, NULL when not profiling
+#endif
+#ifdef FREEINTV_HEATMAP
+	struct Heatmap *heatmap; // see heatmap.h, NULL when not counting
+#endif
+
+	struct CP1610 cpu;
+	struct STIC stic;
+	struct PSG psg;
+	ivoice_t ivoice;
+	struct Mixer mixer;
+
+	int SR1; // SR1 line for interrupt
+	int halt;
+};
+
+struct Machine *MachineCreate(void); // a powered-on machine with empty memory, NULL if out of memory
+struct Machine *MachineClone(const struct Machine *src); // shares src's memory image, if it has one
+void MachineDestroy(struct Machine *m);
+
+void LoadGame(struct Machine *m, const char *path);
+void LoadGameData(struct Machine *m, const void *data, size_t size); // the rom file's contents
+
+int loadExec(struct Machine *m, const char *path); // 0 if the file can't be read
+
+int loadGrom(struct Machine *m, const char *path);
 
-extern int intv_halt;
+void Run(struct Machine *m);
 
-void LoadGame(const char *path);
+int exec(struct Machine *m); // runs one instruction, 0 at the end of a frame or on a halt
 
-void loadExec(const char *path);
+void Init(struct Machine *m);
 
-void loadGrom(const char *path);
+void Reset(struct Machine *m);
 
-void Run(void);
+struct StateBuffer;
 
-void Init(void);
+// Writes every chunk of a save state, "MEM " only if memory is set
+void SerializeMachine(struct Machine *m, struct StateBuffer *state, int memory);
 
-void Reset(void);
+// Returns 0, leaving the machine untouched, if a chunk is missing
+int UnserializeMachine(struct Machine *m, struct StateBuffer *state, int memory);
 
 #endif
@@ -66,26 +66,119 @@
 #include "retro_inline.h"
 #include "intv.h"
 #include "ivoice.h"
+#include "state.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LPC12_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LPC12_NEON
+#include <arm_neon.h>
+#endif
 
 #define CONDFREE(p)  if (p) free(p)
 
-ivoice_t intellivoice;
-int ivoiceBufferSize;
-int16_t ivoiceBuffer[AUDIO_FREQUENCY / 60 * 2];
+static const int16_t ivoiceSilence[IVOICE_SILENCE_SIZE];
 
-void ivoiceSerialize(struct ivoiceSerialized *data)
+/* ======================================================================== */
+/*  IVOICE_SERIALIZE -- Saves the chip and timing state.  States are taken  */
+/*                      between frames, once the mixer has drained the      */
+/*                      output ring, so no samples need to be kept.  The    */
+/*                      ROM page pointers belong to this build and are      */
+/*                      left alone.                                         */
+/* ======================================================================== */
+void ivoiceSerialize(ivoice_t *ivoice, struct StateBuffer *state)
 {
-    memcpy(&data->main, &intellivoice, sizeof(intellivoice));
-    data->ivoiceBufferSize = ivoiceBufferSize;
-    memcpy(data->ivoiceBuffer, ivoiceBuffer, sizeof(ivoiceBuffer));
+    size_t mark = StateChunkBegin(state, "IVOC");
+    int i;
+
+    StatePut64(state, ivoice->now);
+    StatePut64(state, ivoice->sound_current);
+    StatePut64(state, ivoice->idle);
+    StatePut8 (state, ivoice->silent);
+    StatePut8 (state, ivoice->dormant);
+    StatePutInt(state, ivoice->silent_len);
+
+    StatePutInt(state, ivoice->filt.rpt);
+    StatePutInt(state, ivoice->filt.cnt);
+    StatePut32(state, ivoice->filt.per);
+    StatePut32(state, ivoice->filt.rng);
+    StatePutInt(state, ivoice->filt.amp);
+    for (i = 0; i < 6; i++)
+    {
+        StatePut16(state, (uint16_t)ivoice->filt.f_coef[i]);
+        StatePut16(state, (uint16_t)ivoice->filt.b_coef[i]);
+        StatePut16(state, (uint16_t)ivoice->filt.z_data[i][0]);
+        StatePut16(state, (uint16_t)ivoice->filt.z_data[i][1]);
+    }
+    for (i = 0; i < 16; i++)
+        StatePut8(state, ivoice->filt.r[i]);
+    StatePutInt(state, ivoice->filt.interp);
+
+    StatePutInt(state, ivoice->lrq);
+    StatePutInt(state, ivoice->ald);
+    StatePutInt(state, ivoice->pc);
+    StatePutInt(state, ivoice->stack);
+    StatePutInt(state, ivoice->fifo_sel);
+    StatePutInt(state, ivoice->halted);
+    StatePut32(state, ivoice->mode);
+    StatePut32(state, ivoice->page);
+
+    StatePut32(state, ivoice->fifo_head);
+    StatePut32(state, ivoice->fifo_tail);
+    StatePut32(state, ivoice->fifo_bitp);
+    for (i = 0; i < 64; i++)
+        StatePut16(state, ivoice->fifo[i]);
+
+    StateChunkEnd(state, mark);
 }
 
-void ivoiceUnserialize(const struct ivoiceSerialized *data)
+void ivoiceUnserialize(ivoice_t *ivoice, struct StateBuffer *state)
 {
-    // Copies everything except the pointers
-    memcpy(&intellivoice, &data->main, (unsigned char *) &intellivoice.cur_buf - (unsigned char *) &intellivoice);
-    ivoiceBufferSize = data->ivoiceBufferSize;
-    memcpy(ivoiceBuffer, data->ivoiceBuffer, sizeof(ivoiceBuffer));
+    int i;
+
+    if (!StateChunkOpen(state, "IVOC"))
+        return;
+
+    ivoice->now           = StateGet64(state);
+    ivoice->sound_current = StateGet64(state);
+    ivoice->idle          = StateGet64(state);
+    ivoice->silent        = StateGet8(state);
+    ivoice->dormant       = StateGet8(state);
+    ivoice->silent_len    = StateGetInt(state);
+    ivoice->sc_tail       = ivoice->sc_head;
+
+    ivoice->filt.rpt      = StateGetInt(state);
+    ivoice->filt.cnt      = StateGetInt(state);
+    ivoice->filt.per      = StateGet32(state);
+    ivoice->filt.rng      = StateGet32(state);
+    ivoice->filt.amp      = StateGetInt(state);
+    for (i = 0; i < 6; i++)
+    {
+        ivoice->filt.f_coef[i]    = (int16_t)StateGet16(state);
+        ivoice->filt.b_coef[i]    = (int16_t)StateGet16(state);
+        ivoice->filt.z_data[i][0] = (int16_t)StateGet16(state);
+        ivoice->filt.z_data[i][1] = (int16_t)StateGet16(state);
+    }
+    for (i = 0; i < 16; i++)
+        ivoice->filt.r[i] = (uint8_t)StateGet8(state);
+    ivoice->filt.interp   = StateGetInt(state);
+
+    ivoice->lrq           = StateGetInt(state);
+    ivoice->ald           = StateGetInt(state);
+    ivoice->pc            = StateGetInt(state);
+    ivoice->stack         = StateGetInt(state);
+    ivoice->fifo_sel      = StateGetInt(state);
+    ivoice->halted        = StateGetInt(state);
+    ivoice->mode          = StateGet32(state);
+    ivoice->page          = StateGet32(state);
+
+    ivoice->fifo_head     = StateGet32(state);
+    ivoice->fifo_tail     = StateGet32(state);
+    ivoice->fifo_bitp     = StateGet32(state);
+    for (i = 0; i < 64; i++)
+        ivoice->fifo[i] = (uint16_t)StateGet16(state);
 }
 
 /* ======================================================================== */
@@ -97,6 +190,8 @@ static int             lpc12_update(lpc12_t *f, int, int16_t *, uint32_t *);
 static void            lpc12_regdec(lpc12_t *f);
 static uint32_t        sp0256_getb(ivoice_t *ivoice, int len);
 static void            sp0256_micro(ivoice_t *iv);
+static void            ivoice_catchup(ivoice_t *ivoice);
+static void            ivoice_wake(ivoice_t *ivoice);
 
 /* ======================================================================== */
 /*  IVOICE_QTBL  -- Coefficient Quantization Table.  This comes from a      */
@@ -174,15 +269,180 @@ static int amp_decode(uint8_t a)
     return ampl;
 }
 
+/* ======================================================================== */
+/*  LPC12_FILT       -- The six 2nd order stages, held in registers for     */
+/*                      the length of one lpc12_update() call.  The         */
+/*                      coefficients only change between calls (in          */
+/*                      lpc12_regdec), so they're loaded once per batch.    */
+/*                                                                          */
+/*  Every stage's two taps depend only on the previous sample's delay       */
+/*  line, so all twelve products can be formed at once.  What's left is a  */
+/*  running sum down the cascade:  stage j outputs samp + t[0] + ... t[j].  */
+/*  The original accumulates into an int16_t, so only the low 16 bits of    */
+/*  each (product >> shift) matter, and the sums wrap exactly as before.    */
+/*  Lanes 6 and 7 carry zero coefficients and never feed lanes 0..5.        */
+/* ======================================================================== */
+#if defined(LPC12_SSE2)
+typedef struct lpc12_filt_t
+{
+    __m128i f, b;           /* F0..F5, B0..B5                               */
+    __m128i z0, z1;         /* Delay line, newest and oldest.               */
+} lpc12_filt_t;
+
+static INLINE int16_t lpc12_filt_step(lpc12_filt_t *s, int16_t samp)
+{
+    __m128i lo, hi, t;
+
+    /* (B * z1) >> 9 and (F * z0) >> 8, low 16 bits of each.               */
+    lo = _mm_mullo_epi16(s->b, s->z1);
+    hi = _mm_mulhi_epi16(s->b, s->z1);
+    t  = _mm_or_si128(_mm_srli_epi16(lo, 9), _mm_slli_epi16(hi, 7));
+    lo = _mm_mullo_epi16(s->f, s->z0);
+    hi = _mm_mulhi_epi16(s->f, s->z0);
+    t  = _mm_add_epi16(t, _mm_or_si128(_mm_srli_epi16(lo, 8),
+                                       _mm_slli_epi16(hi, 8)));
+
+    /* Running sum down the cascade, then add in the excitation.           */
+    t  = _mm_add_epi16(t, _mm_slli_si128(t, 2));
+    t  = _mm_add_epi16(t, _mm_slli_si128(t, 4));
+    t  = _mm_add_epi16(t, _mm_slli_si128(t, 8));
+    t  = _mm_add_epi16(t, _mm_set1_epi16(samp));
+
+    s->z1 = s->z0;
+    s->z0 = t;
+
+    return (int16_t)_mm_extract_epi16(t, 5);
+}
+
+#elif defined(LPC12_NEON)
+typedef struct lpc12_filt_t
+{
+    int16x8_t f, b;         /* F0..F5, B0..B5                               */
+    int16x8_t z0, z1;       /* Delay line, newest and oldest.               */
+} lpc12_filt_t;
+
+static INLINE int16_t lpc12_filt_step(lpc12_filt_t *s, int16_t samp)
+{
+    int16x8_t zero = vdupq_n_s16(0);
+    int16x8_t t;
+
+    /* (B * z1) >> 9 and (F * z0) >> 8, narrowed to the low 16 bits.       */
+    t = vcombine_s16(
+            vshrn_n_s32(vmull_s16(vget_low_s16 (s->b), vget_low_s16 (s->z1)), 9),
+            vshrn_n_s32(vmull_s16(vget_high_s16(s->b), vget_high_s16(s->z1)), 9));
+    t = vaddq_s16(t, vcombine_s16(
+            vshrn_n_s32(vmull_s16(vget_low_s16 (s->f), vget_low_s16 (s->z0)), 8),
+            vshrn_n_s32(vmull_s16(vget_high_s16(s->f), vget_high_s16(s->z0)), 8)));
+
+    /* Running sum down the cascade, then add in the excitation.           */
+    t = vaddq_s16(t, vextq_s16(zero, t, 7));
+    t = vaddq_s16(t, vextq_s16(zero, t, 6));
+    t = vaddq_s16(t, vextq_s16(zero, t, 4));
+    t = vaddq_s16(t, vdupq_n_s16(samp));
+
+    s->z1 = s->z0;
+    s->z0 = t;
+
+    return vgetq_lane_s16(t, 5);
+}
+
+#else
+typedef struct lpc12_filt_t
+{
+    int16_t f[8], b[8];     /* F0..F5, B0..B5                               */
+    int16_t z0[8], z1[8];   /* Delay line, newest and oldest.               */
+} lpc12_filt_t;
+
+static INLINE int16_t lpc12_filt_step(lpc12_filt_t *s, int16_t samp)
+{
+    int t[6];
+    int j;
+
+    for (j = 0; j < 6; j++)
+        t[j] = (((int)s->b[j] * (int)s->z1[j]) >> 9)
+             + (((int)s->f[j] * (int)s->z0[j]) >> 8);
+
+    for (j = 0; j < 6; j++)
+    {
+        samp     += t[j];
+        s->z1[j]  = s->z0[j];
+        s->z0[j]  = samp;
+    }
+
+    return samp;
+}
+#endif
+
+/* ======================================================================== */
+/*  LPC12_FILT_LOAD  -- Gather the filter state into an lpc12_filt_t.      */
+/*  LPC12_FILT_SAVE  -- And scatter it back.                                */
+/* ======================================================================== */
+static void lpc12_filt_load(lpc12_filt_t *s, const lpc12_t *f)
+{
+    int16_t fc[8] = { 0 }, bc[8] = { 0 }, z0[8] = { 0 }, z1[8] = { 0 };
+    int j;
+
+    for (j = 0; j < 6; j++)
+    {
+        fc[j] = f->f_coef[j];
+        bc[j] = f->b_coef[j];
+        z0[j] = f->z_data[j][0];
+        z1[j] = f->z_data[j][1];
+    }
+
+#if defined(LPC12_SSE2)
+    s->f  = _mm_loadu_si128((const __m128i *)fc);
+    s->b  = _mm_loadu_si128((const __m128i *)bc);
+    s->z0 = _mm_loadu_si128((const __m128i *)z0);
+    s->z1 = _mm_loadu_si128((const __m128i *)z1);
+#elif defined(LPC12_NEON)
+    s->f  = vld1q_s16(fc);
+    s->b  = vld1q_s16(bc);
+    s->z0 = vld1q_s16(z0);
+    s->z1 = vld1q_s16(z1);
+#else
+    memcpy(s->f,  fc, sizeof(fc));
+    memcpy(s->b,  bc, sizeof(bc));
+    memcpy(s->z0, z0, sizeof(z0));
+    memcpy(s->z1, z1, sizeof(z1));
+#endif
+}
+
+static void lpc12_filt_save(const lpc12_filt_t *s, lpc12_t *f)
+{
+    int16_t z0[8], z1[8];
+    int j;
+
+#if defined(LPC12_SSE2)
+    _mm_storeu_si128((__m128i *)z0, s->z0);
+    _mm_storeu_si128((__m128i *)z1, s->z1);
+#elif defined(LPC12_NEON)
+    vst1q_s16(z0, s->z0);
+    vst1q_s16(z1, s->z1);
+#else
+    memcpy(z0, s->z0, sizeof(z0));
+    memcpy(z1, s->z1, sizeof(z1));
+#endif
+
+    for (j = 0; j < 6; j++)
+    {
+        f->z_data[j][0] = z0[j];
+        f->z_data[j][1] = z1[j];
+    }
+}
+
 /* ======================================================================== */
 /*  LPC12_UPDATE     -- Update the 12-pole filter, outputting samples.      */
 /* ======================================================================== */
 static int lpc12_update(lpc12_t *f, int num_samp, int16_t *out, uint32_t *optr)
 {
-    int i, j;
+    int i;
     int16_t samp;
     int do_int, bit;
     int oidx = *optr;
+    lpc12_filt_t filt;
+
+    lpc12_filt_load(&filt, f);
 
     /* -------------------------------------------------------------------- */
     /*  Iterate up to the desired number of samples.  We actually may       */
@@ -256,30 +516,7 @@ static int lpc12_update(lpc12_t *f, int num_samp, int16_t *out, uint32_t *optr)
         /*                +-----------[B]<---------+                        */
         /*                                                                  */
         /* ---------------------------------------------------------------- */
-        for (j = 0; j < 6; j++)
-        {
-#if 1
-            samp += (((int)f->b_coef[j] * (int)f->z_data[j][1]) >> 9);
-            samp += (((int)f->f_coef[j] * (int)f->z_data[j][0]) >> 8);
-#else
-            int temp;
-            /*temp  = ((int)f->f_coef[j] * (int)f->z_data[j][0]) << 1;*/
-            /*temp += ((int)f->b_coef[j] * (int)f->z_data[j][1]);*/
-            static int fdly = 0;
-
-            if (f->f_coef[j] >= 0)
-                temp =    2 * f->f_coef[j] * f->z_data[j][0] + fdly;
-            else
-                temp = -(-2 * f->f_coef[j] * f->z_data[j][0] + fdly);
-
-            fdly  =  1 & (temp >> 26);
-            temp +=  samp_mpy(f->b_coef[j], f->z_data[j][1]);
-            samp +=  temp >> 9;
-#endif
-
-            f->z_data[j][1] = f->z_data[j][0];
-            f->z_data[j][0] = samp;
-        }
+        samp = lpc12_filt_step(&filt, samp);
 
 #ifdef HIGH_QUALITY /* Higher quality than the original, but who cares? */
         out[oidx++ & SCBUF_MASK] = limit(samp) * 4;
@@ -288,11 +525,22 @@ static int lpc12_update(lpc12_t *f, int num_samp, int16_t *out, uint32_t *optr)
 #endif
     }
 
+    lpc12_filt_save(&filt, f);
     *optr = oidx;
 
     return i;
 }
 
+#ifdef FREEINTV_PERF
+/* ======================================================================== */
+/*  IVOICE_LPC12_UPDATE -- lpc12_update() for tools/microbench.c            */
+/* ======================================================================== */
+int ivoice_lpc12_update(lpc12_t *f, int num_samp, int16_t *out, uint32_t *optr)
+{
+    return lpc12_update(f, num_samp, out, optr);
+}
+#endif
+
 /*static int stage_map[6] = { 4, 2, 0, 5, 3, 1 };*/
 /*static int stage_map[6] = { 3, 0, 4, 1, 5, 2 };*/
 /*static int stage_map[6] = { 3, 0, 1, 4, 2, 5 };*/
@@ -1318,14 +1566,23 @@ static void sp0256_micro(ivoice_t *iv)
 /*  IVOICE_TK    -- Where the magic happens.  Generate voice data for       */
 /*                  our good friend, the Intellivoice.                      */
 /* ======================================================================== */
-uint32_t ivoice_tk(uint32_t len)
+uint32_t ivoice_tk(ivoice_t *ivoice, uint32_t len)
 {
-    ivoice_t *ivoice = &intellivoice;
-    uint64_t until = (ivoice->now + len) * 4;
+    uint64_t until;
     int samples, did_samp, old_idx;
-    int sys_clock = ivoice->pal_mode ? 4000000 : 3579545;
     int clock_per_samp = ivoice->pal_mode ? 400 : 358;
 
+    /* -------------------------------------------------------------------- */
+    /*  Until the game first talks to us, just keep time.                   */
+    /* -------------------------------------------------------------------- */
+    if (ivoice->dormant)
+    {
+        ivoice->now += len;
+        return 0;
+    }
+
+    until = (ivoice->now + len) * 4;
+
     /* -------------------------------------------------------------------- */
     /*  If the rest of the machine hasn't caught up to us, just return.     */
     /* -------------------------------------------------------------------- */
@@ -1348,78 +1605,6 @@ uint32_t ivoice_tk(uint32_t len)
             ivoice->sc_tail -= SCBUF_SIZE;
         }
 
-        /* ---------------------------------------------------------------- */
-        /*  First, drain as much of our scratch buffer as we can into the   */
-        /*  sound buffers.                                                  */
-        /* ---------------------------------------------------------------- */
-        while (ivoice->sc_tail < ivoice->sc_head)
-        {
-            int32_t s, ws;
-
-            ws = s = ivoice->scratch[ivoice->sc_tail++ & SCBUF_MASK];
-
-            if (ivoice->skipping < 0.0)
-            {
-                ivoice->skipping += 1.0;
-                continue;
-            }
-
-            if (ivoice->time_scale <= 1.0)
-            {
-                ivoice->sample_frc += ivoice->rate * clock_per_samp /
-                                        ivoice->time_scale;
-            } else
-            {
-                ivoice->sample_frc += ivoice->rate * clock_per_samp;
-                ivoice->skipping += ivoice->time_scale - 1.0;
-            }
-
-            if (ivoice->skipping >= 512.0)
-                ivoice->skipping = -ivoice->skipping;
-
-            /* ------------------------------------------------------------ */
-            /*  Update the sliding window in down-sample mode               */
-            /* ------------------------------------------------------------ */
-            if (ivoice->rate < 10000)
-            {
-                ivoice->wind_sum -= ivoice->window[ivoice->wind_ptr  ];
-                ivoice->wind_sum += ivoice->window[ivoice->wind_ptr++] = s;
-                if (ivoice->wind_ptr >= ivoice->wind) ivoice->wind_ptr = 0;
-
-                ws = ivoice->wind_sum / ivoice->wind;
-            }
-
-            while (ivoice->sample_frc > sys_clock)
-            {
-                ivoice->sample_frc -= sys_clock;
-
-                /* -------------------------------------------------------- */
-                /*  Update the sliding window in up-sample mode             */
-                /* -------------------------------------------------------- */
-                if (ivoice->rate >= 10000)
-                {
-                    ivoice->wind_sum -= ivoice->window[ivoice->wind_ptr  ];
-                    ivoice->wind_sum += ivoice->window[ivoice->wind_ptr++] = s;
-                    if (ivoice->wind_ptr >= ivoice->wind) ivoice->wind_ptr = 0;
-
-                    ws = ivoice->wind_sum / ivoice->wind;
-                }
-
-                /* -------------------------------------------------------- */
-                /*  Store out the current sample.                           */
-                /* -------------------------------------------------------- */
-                ivoice->cur_buf[ivoice->cur_len++] = ws;
-
-                /* -------------------------------------------------------- */
-                /*  Commit the buffer when it's full.                       */
-                /* -------------------------------------------------------- */
-                if (ivoice->cur_len >= ivoiceBufferSize)
-                {
-                    ivoice->cur_len = 0;
-                }
-            }
-        }
-
         /* ---------------------------------------------------------------- */
         /*  Calculate the number of samples required at ~10kHz.             */
         /*  (Actually, on NTSC this is 3579545 / 358, or 9998.73 Hz).       */
@@ -1447,8 +1632,15 @@ uint32_t ivoice_tk(uint32_t len)
             /*  Do as many samples as we can.                               */
             /* ------------------------------------------------------------ */
             do_samp = samples - did_samp;
+            if (do_samp > SCBUF_SIZE)
+                do_samp = SCBUF_SIZE;
+
+            /* ------------------------------------------------------------ */
+            /*  If the mixer has fallen a whole ring behind, drop its       */
+            /*  oldest samples rather than stall the sound engine.          */
+            /* ------------------------------------------------------------ */
             if (ivoice->sc_head + do_samp - ivoice->sc_tail > SCBUF_SIZE)
-                do_samp = ivoice->sc_tail + SCBUF_SIZE - ivoice->sc_head;
+                ivoice->sc_tail = ivoice->sc_head + do_samp - SCBUF_SIZE;
 
             if (do_samp == 0) break;
 
@@ -1482,12 +1674,76 @@ uint32_t ivoice_tk(uint32_t len)
 
 
 /* ======================================================================== */
-/*  IVOICE_RD    -- Handle reads from the Intellivoice.                     */
+/*  IVOICE_CATCHUP -- While dormant, account for the samples an idle chip   */
+/*                    would have produced up to now.  They're all silent,   */
+/*                    so only the count is kept.  Rounds up exactly as      */
+/*                    ivoice_tk does.                                       */
+/* ======================================================================== */
+static void ivoice_catchup(ivoice_t *ivoice)
+{
+    uint64_t until = ivoice->now * 4;
+    int clock_per_samp = ivoice->pal_mode ? 400 : 358;
+    int samples;
+
+    if (until <= ivoice->sound_current)
+        return;
+
+    samples = (int)((until - ivoice->sound_current + clock_per_samp - 1)
+                    / clock_per_samp);
+    ivoice->sound_current += (uint64_t)samples * clock_per_samp;
+    ivoice->silent_len    += samples;
+    ivoice->idle          += samples;
+}
+
+/* ======================================================================== */
+/*  IVOICE_WAKE  -- Leave dormant mode.  An idle chip isn't quite static:   */
+/*                  the halted microsequencer keeps re-arming a one-period  */
+/*                  noise burst, which clocks the LFSR once per sample and  */
+/*                  once more per burst.  Replay that so the first words    */
+/*                  come out exactly as if we'd been running all along.     */
 /* ======================================================================== */
-uint32_t ivoice_rd(uint32_t addr)
+static void ivoice_wake(ivoice_t *ivoice)
 {
-    ivoice_t *ivoice = &intellivoice;
+    uint64_t bursts;
+    uint32_t steps, bit;
+    int      rem;
+
+    ivoice_catchup(ivoice);
+
+    if (ivoice->idle > 0)
+    {
+        bursts = (ivoice->idle - 1) / PER_NOISE;
+        rem    = (int)(ivoice->idle - bursts * PER_NOISE);
+        steps  = (uint32_t)((bursts * (PER_NOISE + 1) + rem) % 32767);
+
+        while (steps--)     /* The LFSR repeats every 32767 steps.          */
+        {
+            bit = ivoice->filt.rng & 1;
+            ivoice->filt.rng = (ivoice->filt.rng >> 1) ^ (bit ? 0x4001 : 0);
+        }
+        ivoice->filt.rpt = 0;
+        ivoice->filt.cnt = PER_NOISE - rem + 1;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*  This frame's samples so far are silence.                            */
+    /* -------------------------------------------------------------------- */
+    if (ivoice->silent_len > SCBUF_SIZE)
+        ivoice->silent_len = SCBUF_SIZE;
+    while (ivoice->silent_len > 0)
+    {
+        ivoice->scratch[ivoice->sc_head++ & SCBUF_MASK] = 0;
+        ivoice->silent_len--;
+    }
+
+    ivoice->dormant = 0;
+}
 
+/* ======================================================================== */
+/*  IVOICE_RD    -- Handle reads from the Intellivoice.                     */
+/* ======================================================================== */
+uint32_t ivoice_rd(ivoice_t *ivoice, uint32_t addr)
+{
     /* -------------------------------------------------------------------- */
     /*  Address 0x80 returns the SP0256 LRQ status on bit 15.               */
     /* -------------------------------------------------------------------- */
@@ -1513,15 +1769,32 @@ uint32_t ivoice_rd(uint32_t addr)
 /* ======================================================================== */
 /*  IVOICE_WR    -- Handle writes to the Intellivoice.                      */
 /* ======================================================================== */
-void ivoice_wr(uint32_t addr, uint32_t data)
+void ivoice_wr(ivoice_t *ivoice, uint32_t addr, uint32_t data)
 {
-    ivoice_t *ivoice = &intellivoice;
-
     /* -------------------------------------------------------------------- */
     /*  Ignore writes outside 0x80, 0x81.                                   */
     /* -------------------------------------------------------------------- */
     if (addr > 1) return;
 
+    /* -------------------------------------------------------------------- */
+    /*  The first real command wakes us up.  A reset of a dormant chip     */
+    /*  only restarts its idle state, so it can stay asleep.                */
+    /* -------------------------------------------------------------------- */
+    if (ivoice->dormant)
+    {
+        if (addr == 1 && (data & 0x400))
+        {
+            ivoice_catchup(ivoice);
+            ivoice->idle = 0;
+            ivoice->filt.rng = 1;
+            ivoice->filt.rpt = -1;
+            ivoice->filt.cnt = 0;
+            return;
+        }
+
+        ivoice_wake(ivoice);
+    }
+
     /* -------------------------------------------------------------------- */
     /*  Address 0x80 is for Address Loads (essentially speech commands).    */
     /* -------------------------------------------------------------------- */
@@ -1598,36 +1871,47 @@ void ivoice_wr(uint32_t addr, uint32_t data)
 /* ======================================================================== */
 /*  IVOICE_RESET -- Resets the Intellivoice                                 */
 /* ======================================================================== */
-void ivoice_reset(void)
+void ivoice_reset(ivoice_t *ivoice)
 {
     /* -------------------------------------------------------------------- */
     /*  Do a software-style reset of the Intellivoice.                      */
     /* -------------------------------------------------------------------- */
-    ivoice_wr(1, 0x400);
+    ivoice_wr(ivoice, 1, 0x400);
 }
 
 /* ======================================================================== */
-/*  IVOICE_DTOR  -- Destroy an Intellivoice                                 */
+/*  IVOICE_DTOR  -- Destroy an Intellivoice.  The output ring lives in the  */
+/*                  ivoice_t itself, so there is nothing to free.           */
 /* ======================================================================== */
-void ivoice_dtor(void)
+void ivoice_dtor(ivoice_t *ivoice)
 {
-    ivoice_t *ivoice = &intellivoice;
-
-    CONDFREE(ivoice->window);
-    CONDFREE(ivoice->scratch);
+    (void)ivoice;
 }
 
-void ivoice_frame(void)
+/* ======================================================================== */
+/*  IVOICE_FRAME -- Hands this frame's samples to the mixer.  Our output    */
+/*                  is the scratch ring itself:  the mixer reads            */
+/*                  ring[(tail + i) & SCBUF_MASK] for i < len, and that     */
+/*                  span is then released.  A dormant Intellivoice shares   */
+/*                  one buffer of silence, sized to the time that passed.   */
+/* ======================================================================== */
+const int16_t *ivoice_frame(ivoice_t *ivoice, uint32_t *tail, int *len)
 {
-    ivoice_t *ivoice = &intellivoice;
-    int c;
-    
-    c = ivoice->cur_len - AUDIO_FREQUENCY / 60;
-    if (c > 0)
-        memmove(ivoiceBuffer, ivoiceBuffer + AUDIO_FREQUENCY / 60, c * sizeof(int16_t));
-    else
-        c = 0;
-    ivoice->cur_len = c;
+    if (ivoice->dormant)
+    {
+        ivoice_catchup(ivoice);
+
+        *tail = 0;
+        *len  = ivoice->silent_len < IVOICE_SILENCE_SIZE ?
+                ivoice->silent_len : IVOICE_SILENCE_SIZE;
+        ivoice->silent_len = 0;
+        return ivoiceSilence;
+    }
+
+    *tail = ivoice->sc_tail;
+    *len  = (int)(ivoice->sc_head - ivoice->sc_tail);
+    ivoice->sc_tail = ivoice->sc_head;
+    return ivoice->scratch;
 }
 
 /* ======================================================================== */
@@ -1635,73 +1919,27 @@ void ivoice_frame(void)
 /* ======================================================================== */
 int ivoice_init
 (
-    int             pal_mode,   /*  PAL vs. NTSC                            */
-    double          time_scale  /*  For --macho                             */
+    ivoice_t        *ivoice,
+    int             pal_mode    /*  PAL vs. NTSC                            */
 )
 {
-    ivoice_t *ivoice = &intellivoice;
-    int rate;
-    int wind;
-    
-    ivoiceBufferSize = AUDIO_FREQUENCY / 60 * 2;
-    rate = AUDIO_FREQUENCY;   /* Sampling rate */
-    wind = -1;  /* Sliding window size */
-    
     /* -------------------------------------------------------------------- */
     /*  First, lets zero out the structure to be safe.                      */
     /* -------------------------------------------------------------------- */
     memset(ivoice, 0, sizeof(ivoice_t));
 
-    /* -------------------------------------------------------------------- */
-    /*  Sanity checks.                                                      */
-    /* -------------------------------------------------------------------- */
-    if (rate < 10000 || rate > 96000)
-    {
-        fprintf(stderr, "ivoice:  Sampling rate of %d is invalid.  Must be "
-                        "between 10000 and 96000.\n", rate);
-        return -1;
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*  If wind == -1, calculate a window size based on the ratio of our    */
-    /*  sample rate to the device's native rate.                            */
-    /* -------------------------------------------------------------------- */
-    if (wind == -1)
-    {
-        if (rate > 10000)   wind = rate / 5000 + 3;
-        else                wind = 20000 / rate + 1;
-
-        if (wind < 1) wind = 1;
-
-//        jzp_printf("ivoice:  Automatic sliding-window setting: %d\n", wind);
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*  Set up the peripheral.                                              */
-    /* -------------------------------------------------------------------- */
-//    ivoice->periph.dtor      = ivoice_dtor;
-
     /* -------------------------------------------------------------------- */
     /*  Configure our internal variables.                                   */
     /* -------------------------------------------------------------------- */
     ivoice->rom[1]     = mask;
-    ivoice->rate       = rate;
     ivoice->filt.rng   = 1;
-    ivoice->wind       = wind;
-    ivoice->wind_sum   = 0;
     ivoice->pal_mode   = pal_mode;
-    ivoice->time_scale = time_scale;
-
-    /* -------------------------------------------------------------------- */
-    /*  Set up our initial working buffer.                                  */
-    /* -------------------------------------------------------------------- */
-    ivoice->cur_buf = ivoiceBuffer;
-    ivoice->cur_len = 0;
 
     /* -------------------------------------------------------------------- */
-    /*  Allocate a scratch buffer for generating 10kHz samples.             */
+    /*  Empty the output ring.                                              */
     /* -------------------------------------------------------------------- */
     ivoice->sc_head = ivoice->sc_tail = 0;
+    ivoice->silent_len = 0;
 
     /* -------------------------------------------------------------------- */
     /*  Set up the microsequencer's initial state.                          */
@@ -1711,6 +1949,7 @@ int ivoice_init
     ivoice->lrq      = 0x8000;
     ivoice->page     = 0x1000 << 3;
     ivoice->silent   = 1;
+    ivoice->dormant  = 1;
 
     return 0;
 }
@@ -12,6 +12,8 @@
 #define SCBUF_SIZE   (4096)             /* Must be power of 2               */
 #define SCBUF_MASK   (SCBUF_SIZE - 1)
 
+#define IVOICE_SILENCE_SIZE (512)       /* ~3 frames of native-rate samples */
+
 typedef struct lpc12_t
 {
     int     rpt, cnt;       /* Repeat counter, Period down-counter.         */
@@ -30,20 +32,15 @@ typedef struct ivoice_t
     uint64_t    now;
 
     int         silent;     /* Flag:  Intellivoice is silent.               */
+    int         dormant;    /* Flag:  Never written to, only keeping time.  */
 
-    int16_t     scratch[SCBUF_SIZE];    /* Scratch buffer for audio.        */
-    uint32_t    sc_head;    /* Head/Tail pointer into scratch circular buf  */
-    uint32_t    sc_tail;    /* Head/Tail pointer into scratch circular buf  */
+    int16_t     scratch[SCBUF_SIZE];    /* Output ring, ~10kHz samples.     */
+    uint32_t    sc_head;    /* Write cursor (sound engine)                  */
+    uint32_t    sc_tail;    /* Read cursor (mixer, via ivoice_frame)        */
     uint64_t    sound_current;
-    int         sample_frc, sample_int;
+    uint64_t    idle;       /* Samples idled through while dormant.         */
 
-    int         window[24]; /* Sliding Window. Enough for 96khz.            */
-    int         wind_sum;   /* Window sum.                                  */
-    int         wind_ptr;   /* Window pointer.                              */
-    int         rate, wind; /* Sample rate, Window size.                    */
     int         pal_mode;   /* PAL vs. NTSC                                 */
-    double      time_scale; /* For --macho                                  */
-    double      skipping;   /* part of time-scale                           */
 
     lpc12_t     filt;       /* 12-pole filter                               */
     int         lrq;        /* Load ReQuest.  == 0 if we can accept a load  */
@@ -60,39 +57,35 @@ typedef struct ivoice_t
     uint32_t    fifo_bitp;  /* FIFO bit-pointer (for partial decles).       */
     uint16_t    fifo[64];   /* The 64-decle FIFO.                           */
 
-    int         cur_len;    /* Fullness of current sound buffer.            */
-    int16_t    *cur_buf;    /* Current sound buffer.                        */
+    int         silent_len; /* Silent samples owed this frame while dormant */
     const uint8_t *rom[16]; /* 4K ROM pages.                                */
 } ivoice_t;
 
-struct ivoiceSerialized {
-    ivoice_t main;
-    int ivoiceBufferSize;
-    int16_t ivoiceBuffer[AUDIO_FREQUENCY / 60 * 2];
-};
+struct StateBuffer;
+
+void ivoiceSerialize(ivoice_t *, struct StateBuffer *);  /* "IVOC" chunk  */
+void ivoiceUnserialize(ivoice_t *, struct StateBuffer *);
 
-void ivoiceSerialize(struct ivoiceSerialized *);
-void ivoiceUnserialize(const struct ivoiceSerialized *);
+uint32_t ivoice_tk(ivoice_t *, uint32_t);
+uint32_t ivoice_rd(ivoice_t *, uint32_t);
+void ivoice_wr(ivoice_t *, uint32_t, uint32_t);
+void ivoice_reset(ivoice_t *);
+void ivoice_dtor(ivoice_t *);
+const int16_t *ivoice_frame(ivoice_t *, uint32_t *tail, int *len);
 
-uint32_t ivoice_tk(uint32_t);
-uint32_t ivoice_rd(uint32_t);
-void ivoice_wr(uint32_t, uint32_t);
-void ivoice_reset(void);
-void ivoice_dtor(void);
-void ivoice_frame(void);
+#ifdef FREEINTV_PERF
+int ivoice_lpc12_update(lpc12_t *, int num_samp, int16_t *out, uint32_t *optr);
+#endif
 
 /* ======================================================================== */
 /*  IVOICE_INIT  -- Makes a new Intellivoice                                */
 /* ======================================================================== */
 int ivoice_init
 (
-    int             pal_mode,
-    double          time_scale
+    ivoice_t        *ivoice,
+    int             pal_mode
 );
 
-extern int ivoiceBufferSize;
-extern int16_t ivoiceBuffer[];
-
 #endif
 /* ======================================================================== */
 /*  This program is free software; you can redistribute it and/or modify    */
@@ -32,16 +32,23 @@
 #include "stic.h"
 #include "psg.h"
 #include "ivoice.h"
+#include "mixer.h"
+#include "blit.h"
+#include "state.h"
+#include "cartdb.h"
+#include "rewind.h"
+#include "runahead.h"
 #include "controller.h"
 #include "osd.h"
+#include "perf.h"
+#include "timeline.h"
 
 // Include stb_image header (implementation in stb_image_impl.c)
 #include "stb_image.h"
 
-// Include embedded image assets (converted from PNG files)
-#include "banner.h"
-#include "keypad_frame_graphic.h"
-#include "default_keypad_image.h"
+// Embedded images, generated from Assets/ by "make assets"
+#include "asset.h"
+#include "asset_data.h"
 
 #define DefaultFPS 60
 #define MaxWidth 352
@@ -82,17 +89,26 @@ typedef struct {
 
 overlay_hotspot_t overlay_hotspots[OVERLAY_HOTSPOT_COUNT];
 
+static struct Machine *machine; // the console being shown
+
 // Display system variables
 static int multi_screen_enabled = 0;  // Default to disabled - enable via core option
 static void* multi_screen_buffer = NULL;
+static unsigned int* multi_screen_background = NULL;  // Static layers, composited once
+static int multi_screen_dirty = 1;  // Background must be recomposited
+static int multi_screen_assets = 0; // Images for this game are loaded
+static int background_swap = -1;    // display_swap the background was composited for
 static const int GAME_WIDTH = 352;
 static const int GAME_HEIGHT = 224;
 static int display_swap = 0;  // 0 = game left/keypad right, 1 = game right/keypad left
 
 // Hotspot input tracking
 static int hotspot_pressed[OVERLAY_HOTSPOT_COUNT] = {0};  // Track which hotspots are currently pressed
+static int hotspot_drawn[OVERLAY_HOTSPOT_COUNT] = {0};    // Highlights currently in multi_screen_buffer
 
 // PNG overlay system
+char *SystemPath;
+static char game_path[512] = {0};   // Loaded game, to find its overlay
 static char current_rom_path[512] = {0};
 static unsigned int* overlay_buffer = NULL;
 static int overlay_loaded = 0;
@@ -163,85 +179,35 @@ static void init_overlay_hotspots(void)
 // Forward declaration for build_overlay_path (ROM-specific overlay)
 static void build_overlay_path(const char* rom_path, char* overlay_path, size_t overlay_path_size, const char* system_dir);
 
-// Load controller base PNG from embedded data
+// Load controller base from embedded data
 static void load_controller_base(void)
 {
-    int width, height, channels, y, x;
-    unsigned char* img_data;
-    unsigned char* pixel;
-    unsigned int alpha, r, g, b;
-    
     if (controller_base_loaded) {
         return;
     }
     
-    img_data = stbi_load_from_memory(keypad_frame_graphic, keypad_frame_graphic_len, &width, &height, &channels, 4);
-    
-    if (img_data) {
-        controller_base_width = width;
-        controller_base_height = height;
-        
-        if (!controller_base) {
-            controller_base = (unsigned int*)malloc(width * height * sizeof(unsigned int));
-        }
-        
-        if (controller_base) {
-            int y, x;
-            for (y = 0; y < height; y++) {
-                for (x = 0; x < width; x++) {
-                    unsigned char* pixel = img_data + (y * width + x) * 4;
-                    unsigned int alpha = pixel[3];
-                    unsigned int r = pixel[0];
-                    unsigned int g = pixel[1];
-                    unsigned int b = pixel[2];
-                    controller_base[y * width + x] = (alpha << 24) | (r << 16) | (g << 8) | b;
-                }
-            }
-            controller_base_loaded = 1;
-        }
-    } else {
+    controller_base = AssetDecode(&keypad_frame_asset);
+    if (controller_base) {
+        controller_base_width = keypad_frame_asset.width;
+        controller_base_height = keypad_frame_asset.height;
+        controller_base_loaded = 1;
+        multi_screen_dirty = 1;
     }
 }
 
-// Load banner PNG from embedded data
+// Load banner from embedded data
 static void load_banner(void)
 {
-    int width, height, channels, y, x;
-    unsigned char* img_data;
-    unsigned char* pixel;
-    unsigned int alpha, r, g, b;
-    
     if (banner_loaded) {
         return;
     }
     
-    img_data = stbi_load_from_memory(banner, banner_len, &width, &height, &channels, 4);
-    
-    if (!img_data) {
-        return;
-    }
-    
-    banner_width = width;
-    banner_height = height;
-    
-    if (!banner_buffer) {
-        banner_buffer = (unsigned int*)malloc(width * height * sizeof(unsigned int));
-    }
-    
+    banner_buffer = AssetDecode(&banner_asset);
     if (banner_buffer) {
-        int y, x;
-        for (y = 0; y < height; y++) {
-            for (x = 0; x < width; x++) {
-                unsigned char* pixel = img_data + (y * width + x) * 4;
-                unsigned int alpha = pixel[3];
-                unsigned int r = pixel[0];
-                unsigned int g = pixel[1];
-                unsigned int b = pixel[2];
-                banner_buffer[y * width + x] = (alpha << 24) | (r << 16) | (g << 8) | b;
-            }
-        }
+        banner_width = banner_asset.width;
+        banner_height = banner_asset.height;
         banner_loaded = 1;
-        stbi_image_free(img_data);
+        multi_screen_dirty = 1;
     }
 }
 
@@ -283,7 +249,7 @@ static void build_overlay_path(const char* rom_path, char* overlay_path, size_t
 static void load_overlay_for_rom(const char* rom_path, const char* system_dir)
 {
     char overlay_path[1024], jpg_path[1024];
-    int width, height, channels, y, x, from_file;
+    int width, height, channels, y, x;
     unsigned char* img_data;
     unsigned char* pixel;
     unsigned int alpha, r, g, b;
@@ -303,7 +269,6 @@ static void load_overlay_for_rom(const char* rom_path, const char* system_dir)
     }
     
     img_data = stbi_load(overlay_path, &width, &height, &channels, 4);
-    from_file = 1;
     
     if (!img_data) {
         // Try JPG format
@@ -312,14 +277,17 @@ static void load_overlay_for_rom(const char* rom_path, const char* system_dir)
         if (ext) {
             strcpy(ext, ".jpg");
             img_data = stbi_load(jpg_path, &width, &height, &channels, 4);
-            from_file = 1;
         }
     }
     
     // Fall back to embedded default image
     if (!img_data) {
-        img_data = stbi_load_from_memory(default_keypad_image, default_keypad_image_len, &width, &height, &channels, 4);
-        from_file = 0;
+        overlay_buffer = AssetDecode(&default_keypad_asset);
+        if (overlay_buffer) {
+            overlay_width = default_keypad_asset.width;
+            overlay_height = default_keypad_asset.height;
+            init_overlay_hotspots();
+        }
     }
     
     if (img_data) {
@@ -341,11 +309,8 @@ static void load_overlay_for_rom(const char* rom_path, const char* system_dir)
             }
             init_overlay_hotspots();
         }
-        // Only free if it came from a file, not if it's embedded
-        if (from_file) {
-            stbi_image_free(img_data);
-        }
-    } else {
+        stbi_image_free(img_data);
+    } else if (!overlay_buffer) {
         overlay_width = 370;
         overlay_height = 600;
         overlay_buffer = (unsigned int*)malloc(overlay_width * overlay_height * sizeof(unsigned int));
@@ -367,28 +332,27 @@ static void load_overlay_for_rom(const char* rom_path, const char* system_dir)
     }
     
     overlay_loaded = 1;
+    multi_screen_dirty = 1;
     strncpy(current_rom_path, rom_path, sizeof(current_rom_path) - 1);
 }
 
 
-// Render display with game screen LEFT and keypad RIGHT
-static void render_multi_screen(void)
+// Composite the layers that don't change from frame to frame: utility
+// background, banner, borders and the keypad with its overlay.  The game
+// area is left black, render_multi_screen() fills it every frame.
+static void compose_multi_screen_background(unsigned int* multi_buffer)
 {
     int i, y, x;
-    unsigned int* multi_buffer;
-    extern unsigned int frame[352 * 224];
+    unsigned int* row;
     int game_x_offset, keypad_x_offset;
     int util_bg_x1, util_bg_x2, util_bg_y1, util_bg_y2;
-    int src_y, src_x, workspace_x, workspace_y;
+    int workspace_x, workspace_y;
     unsigned int bg_color;
     int overlay_x, overlay_y, overlay_workspace_x, overlay_workspace_y;
     unsigned int overlay_pixel, overlay_pixel_val;
     int banner_start_x, banner_start_y;
-    int banner_x, banner_y;
+    int banner_y;
     int banner_workspace_x, banner_workspace_y;
-    unsigned int banner_pixel;
-    unsigned int existing;
-    int blended_r, blended_g, blended_b;
     float alpha;
     int button_idx, btn_y, btn_x;
     int color;
@@ -397,24 +361,9 @@ static void render_multi_screen(void)
     unsigned int border_colors[7];
     int util_border_x1, util_border_x2, util_border_y1, util_border_y2;
     unsigned int pixel, base_pixel;
-    unsigned int inv_alpha;
-    unsigned int base_r, base_g, base_b;
-    unsigned int bg_r, bg_g, bg_b;
     int ctrl_base_x_offset, overlay_x_offset, ctrl_x;
     unsigned int utility_bg_color;
     unsigned int r, g, b;
-    unsigned int existing_r, existing_g, existing_b;
-    int hotspot_x_adjust;
-    unsigned int highlight_color;
-    
-    if (!multi_screen_enabled) return;
-    
-    if (!multi_screen_buffer) {
-        multi_screen_buffer = malloc(WORKSPACE_WIDTH * WORKSPACE_HEIGHT * sizeof(unsigned int));
-    }
-    if (!multi_screen_buffer) return;
-    
-    multi_buffer = (unsigned int*)multi_screen_buffer;
     
     /* Clear entire workspace with black */
     for (i = 0; i < WORKSPACE_WIDTH * WORKSPACE_HEIGHT; i++) {
@@ -444,23 +393,6 @@ static void render_multi_screen(void)
         }
     }
     
-    // === GAME SCREEN ===
-    for (y = 0; y < GAME_SCREEN_HEIGHT; ++y) {
-        src_y = y / 2;
-        for (x = 0; x < GAME_SCREEN_WIDTH; ++x) {
-            src_x = x / 2;
-            workspace_x = game_x_offset + x;
-            
-            if (workspace_x >= WORKSPACE_WIDTH) continue;
-            
-            if (src_y < GAME_HEIGHT && src_x < GAME_WIDTH) {
-                multi_buffer[y * WORKSPACE_WIDTH + workspace_x] = frame[src_y * GAME_WIDTH + src_x];
-            } else {
-                multi_buffer[y * WORKSPACE_WIDTH + workspace_x] = 0xFF000000;
-            }
-        }
-    }
-    
     /* === KEYPAD === */
     /* Background for keypad area */
     bg_color = 0xFF1a1a1a;
@@ -509,81 +441,30 @@ static void render_multi_screen(void)
                 }
             }
             
-            // Layer controller base on top (with overlay showing through transparent areas)
-            if (overlay_loaded && controller_base_loaded && controller_base && y < controller_base_height) {
-                ctrl_x = x - ctrl_base_x_offset;
-                if (ctrl_x >= 0 && ctrl_x < controller_base_width) {
-                    base_pixel = controller_base[y * controller_base_width + ctrl_x];
-                    alpha = (base_pixel >> 24) & 0xFF;
-                    if (alpha > 0) {
-                        if (alpha == 255) {
-                            // Fully opaque: use controller base
-                            pixel = base_pixel;
-                        } else {
-                            // Semi-transparent: blend controller base over overlay
-                            inv_alpha = 255 - alpha;
-                            base_r = (base_pixel >> 16) & 0xFF;
-                            base_g = (base_pixel >> 8) & 0xFF;
-                            base_b = base_pixel & 0xFF;
-                            
-                            bg_r = (pixel >> 16) & 0xFF;
-                            bg_g = (pixel >> 8) & 0xFF;
-                            bg_b = pixel & 0xFF;
-                            
-                            blended_r = (base_r * alpha + bg_r * inv_alpha) / 255;
-                            blended_g = (base_g * alpha + bg_g * inv_alpha) / 255;
-                            blended_b = (base_b * alpha + bg_b * inv_alpha) / 255;
-                            
-                            pixel = 0xFF000000 | (blended_r << 16) | (blended_g << 8) | blended_b;
-                        }
-                    }
-                    // If alpha == 0 (transparent), pixel stays as overlay
-                }
-            }
-            
             multi_buffer[workspace_y * WORKSPACE_WIDTH + workspace_x] = pixel;
         }
+        
+        // Layer controller base on top (with overlay showing through transparent areas)
+        if (overlay_loaded && controller_base_loaded && controller_base && y < controller_base_height) {
+            x = ctrl_base_x_offset > 0 ? ctrl_base_x_offset : 0;
+            i = ctrl_base_x_offset + controller_base_width;
+            if (i > KEYPAD_WIDTH) i = KEYPAD_WIDTH;
+            if (keypad_x_offset + i > WORKSPACE_WIDTH) i = WORKSPACE_WIDTH - keypad_x_offset;
+            if (i > x) {
+                row = multi_buffer + y * WORKSPACE_WIDTH + keypad_x_offset + x;
+                BlitBlendRow(row, row, controller_base + y * controller_base_width + x - ctrl_base_x_offset, i - x);
+            }
+        }
     }
     
-
-    
     /* === RENDER BANNER IN UTILITY WORKSPACE === */
     if (banner_loaded && banner_buffer) {
         /* Blit banner to utility area at position (game_x_offset, 448) */
-        for (banner_y = 0; banner_y < banner_height; banner_y++) {
-            for (banner_x = 0; banner_x < banner_width; banner_x++) {
-                workspace_x = game_x_offset + banner_x;
-                workspace_y = 448 + banner_y;                if (workspace_x >= WORKSPACE_WIDTH || workspace_y >= WORKSPACE_HEIGHT) continue;
-                if (workspace_x < 0) continue;
-                
-                banner_pixel = banner_buffer[banner_y * banner_width + banner_x];
-                alpha = (banner_pixel >> 24) & 0xFF;
-                
-                if (alpha > 0) {
-                    // Blend with alpha
-                    if (alpha == 255) {
-                        multi_buffer[workspace_y * WORKSPACE_WIDTH + workspace_x] = banner_pixel;
-                    } else {
-                        // Alpha blend
-                        existing = multi_buffer[workspace_y * WORKSPACE_WIDTH + workspace_x];
-                        inv_alpha = 255 - alpha;
-                        
-                        r = ((banner_pixel >> 16) & 0xFF);
-                        g = ((banner_pixel >> 8) & 0xFF);
-                        b = (banner_pixel & 0xFF);
-                        
-                        existing_r = ((existing >> 16) & 0xFF);
-                        existing_g = ((existing >> 8) & 0xFF);
-                        existing_b = (existing & 0xFF);
-                        
-                        blended_r = (r * alpha + existing_r * inv_alpha) / 255;
-                        blended_g = (g * alpha + existing_g * inv_alpha) / 255;
-                        blended_b = (b * alpha + existing_b * inv_alpha) / 255;
-                        
-                        multi_buffer[workspace_y * WORKSPACE_WIDTH + workspace_x] = 0xFF000000 | (blended_r << 16) | (blended_g << 8) | blended_b;
-                    }
-                }
-            }
+        i = banner_width;
+        if (game_x_offset + i > WORKSPACE_WIDTH) i = WORKSPACE_WIDTH - game_x_offset;
+        for (banner_y = 0; banner_y < banner_height && 448 + banner_y < WORKSPACE_HEIGHT; banner_y++) {
+            row = multi_buffer + (448 + banner_y) * WORKSPACE_WIDTH + game_x_offset;
+            BlitBlendRow(row, row, banner_buffer + banner_y * banner_width, i);
         }
     } else {
         /* Fallback: Draw dark background if banner not loaded */
@@ -688,47 +569,89 @@ static void render_multi_screen(void)
             }
         }
     }
+}
+
+// Render display with game screen LEFT and keypad RIGHT
+static void render_multi_screen(void)
+{
+    int i, y;
+    unsigned int* multi_buffer;
+    int game_x_offset;
+    int hotspot_x_adjust;
+    unsigned int highlight_color = 0xAA00FF00;  /* Green highlight for touch-pressed */
+    unsigned int highlight_row[OVERLAY_HOTSPOT_SIZE];
+    unsigned int *src_row, *dst_row;
+    
+    if (!multi_screen_enabled) return;
+    
+    /* Decode the images on the first multi-screen frame, not at load */
+    if (!multi_screen_assets) {
+        load_controller_base();
+        load_banner();
+        load_overlay_for_rom(game_path[0] ? game_path : NULL, SystemPath);
+        multi_screen_assets = 1;
+    }
+    
+    if (!multi_screen_buffer) {
+        multi_screen_buffer = malloc(WORKSPACE_WIDTH * WORKSPACE_HEIGHT * sizeof(unsigned int));
+    }
+    if (!multi_screen_background) {
+        multi_screen_background = (unsigned int*)malloc(WORKSPACE_WIDTH * WORKSPACE_HEIGHT * sizeof(unsigned int));
+        multi_screen_dirty = 1;
+    }
+    if (!multi_screen_buffer || !multi_screen_background) return;
+    
+    multi_buffer = (unsigned int*)multi_screen_buffer;
+    
+    /* Recomposite the static layers only when an asset or the layout changed */
+    if (multi_screen_dirty || background_swap != display_swap) {
+        compose_multi_screen_background(multi_screen_background);
+        memcpy(multi_buffer, multi_screen_background, WORKSPACE_WIDTH * WORKSPACE_HEIGHT * sizeof(unsigned int));
+        memset(hotspot_drawn, 0, sizeof(hotspot_drawn));
+        background_swap = display_swap;
+        multi_screen_dirty = 0;
+    }
+    
+    /* Determine screen positions based on display_swap setting */
+    game_x_offset = display_swap ? KEYPAD_WIDTH : 0;
+    
+    // === GAME SCREEN ===
+    BlitScale2x(multi_buffer + game_x_offset, WORKSPACE_WIDTH, machine->stic.frame, GAME_WIDTH, GAME_HEIGHT);
     
     /* === HOTSPOT HIGHLIGHTING - Show which buttons are pressed by touch === */
-    /* Highlight all pressed hotspots (from touch input detection) */
+    /* Only hotspots whose state changed are redrawn: released ones are */
+    /* restored from the background, pressed ones blended over it.      */
     /* When display_swap is true, hotspots translate from right side to left side */
     hotspot_x_adjust = display_swap ? (-GAME_SCREEN_WIDTH) : 0;
+    for (i = 0; i < OVERLAY_HOTSPOT_SIZE; i++) {
+        highlight_row[i] = highlight_color;
+    }
     
     for (i = 0; i < OVERLAY_HOTSPOT_COUNT; i++) {
-        if (hotspot_pressed[i]) {
-            overlay_hotspot_t *h = &overlay_hotspots[i];
-            unsigned int highlight_color = 0xAA00FF00;  /* Green highlight for touch-pressed */
-            
-            for (y = h->y; y < h->y + h->height; ++y) {
-                if (y >= WORKSPACE_HEIGHT) continue;
-                for (x = h->x + hotspot_x_adjust; x < h->x + h->width + hotspot_x_adjust; ++x) {
-                    if (x < 0 || x >= WORKSPACE_WIDTH) continue;
-                    
-                    existing = multi_buffer[y * WORKSPACE_WIDTH + x];
-                    alpha = (highlight_color >> 24) & 0xFF;
-                    inv_alpha = 255 - alpha;
-                    
-                    r = ((highlight_color >> 16) & 0xFF);
-                    g = ((highlight_color >> 8) & 0xFF);
-                    b = (highlight_color & 0xFF);
-                    
-                    existing_r = ((existing >> 16) & 0xFF);
-                    existing_g = ((existing >> 8) & 0xFF);
-                    existing_b = (existing & 0xFF);
-                    
-                    blended_r = (r * alpha + existing_r * inv_alpha) / 255;
-                    blended_g = (g * alpha + existing_g * inv_alpha) / 255;
-                    blended_b = (b * alpha + existing_b * inv_alpha) / 255;
-                    
-                    multi_buffer[y * WORKSPACE_WIDTH + x] = 0xFF000000 | (blended_r << 16) | (blended_g << 8) | blended_b;
-                }
+        overlay_hotspot_t *h = &overlay_hotspots[i];
+        int x1 = h->x + hotspot_x_adjust;
+        int x2 = x1 + h->width;
+        
+        if (hotspot_pressed[i] == hotspot_drawn[i]) continue;
+        hotspot_drawn[i] = hotspot_pressed[i];
+        
+        if (x1 < 0) x1 = 0;
+        if (x2 > WORKSPACE_WIDTH) x2 = WORKSPACE_WIDTH;
+        if (x2 - x1 > OVERLAY_HOTSPOT_SIZE) x2 = x1 + OVERLAY_HOTSPOT_SIZE;
+        if (x2 <= x1) continue;
+        
+        for (y = h->y; y < h->y + h->height && y < WORKSPACE_HEIGHT; ++y) {
+            src_row = multi_screen_background + y * WORKSPACE_WIDTH + x1;
+            dst_row = multi_buffer + y * WORKSPACE_WIDTH + x1;
+            if (hotspot_pressed[i]) {
+                BlitBlendRow(dst_row, src_row, highlight_row, x2 - x1);
+            } else {
+                memcpy(dst_row, src_row, (x2 - x1) * sizeof(unsigned int));
             }
         }
     }
 }
 
-char *SystemPath;
-
 retro_environment_t Environ;
 retro_video_refresh_t Video;
 retro_audio_sample_t Audio;
@@ -911,7 +834,7 @@ static void process_hotspot_input(void)
     // Send hotspot input directly to controller 0 (player 1)
     if (hotspot_input)
     {
-        setControllerInput(0, hotspot_input);
+        setControllerInput(machine, 0, hotspot_input);
     }
 }
 
@@ -931,16 +854,111 @@ bool keyboardChange = false;
 bool keyboardDown = false;
 int  keyboardState = 0;
 
-// at 44.1khz, read 735 samples (44100/60) 
-// at 48khz, read 800 samples (48000/60)
-// e.g. audioInc = 3733.5 / 735
-int audioSamples = AUDIO_FREQUENCY / 60;
+// interleaved stereo output for one frame, handed to AudioBatch in one call
+int16_t audioOutput[MIXER_MAX_SAMPLES * 2];
+
+// Frame budget counters, see perf.h.  They run only when the frontend
+// has a perf interface and freeintv_perf_counters asks for them.
+static struct retro_perf_callback perf_cb;
+static struct retro_perf_counter perfCounters[PERF_PHASES];
+static int perfMode = 0; // 0 off, 1 counting, 2 counting and drawn on screen
+
+static uint64_t perfTicks(void) { return perf_cb.get_perf_counter(); }
+static int64_t perfUsec(void) { return perf_cb.get_time_usec(); }
+
+static void perfSetMode(int mode)
+{
+	if (perf_cb.get_perf_counter == NULL || perf_cb.get_time_usec == NULL)
+		mode = 0;
+	if ((mode != 0) != (perfMode != 0))
+		PerfInit(mode ? perfTicks : NULL, perfUsec);
+	perfMode = mode;
+}
+
+// Rolling averages in the top left corner, in ms of the 16.7 ms frame
+static void perfDrawOverlay(void)
+{
+	char line[40];
+	double total = 0;
+	int i, j;
 
-double audioBufferPos = 0.0;
-double audioInc;
+	OSD_drawTextBG(1, 1, "PHASE       MS/FRAME ");
+	for (i = 0; i < PERF_PHASES; i++)
+	{
+		double us = PerfAverage(i);
+
+		snprintf(line, sizeof(line), "%-10s %9.3f ", PerfPhaseNames[i], us / 1000.0);
+		for (j = 0; line[j]; j++)
+			if (line[j] >= 'a' && line[j] <= 'z')
+				line[j] -= 'a' - 'A';
+		OSD_drawTextBG(1, 2 + i, line);
+		total += us;
+	}
+	snprintf(line, sizeof(line), "TOTAL      %9.3f ", total / 1000.0);
+	OSD_drawTextBG(1, 2 + PERF_PHASES, line);
+}
+
+static void perfFrameEnd(void)
+{
+	int i;
 
-double ivoiceBufferPos = 0.0;
-double ivoiceInc;
+	if (!perfMode)
+		return;
+	PerfFrameEnd();
+	for (i = 0; i < PERF_PHASES; i++)
+	{
+		perfCounters[i].total = PerfTotal[i];
+		perfCounters[i].call_cnt = PerfCalls[i];
+	}
+}
+
+// Where this title's frames went, for the log when it's closed
+static void perfReport(void)
+{
+	int i;
+
+	if (!perfMode)
+		return;
+	printf("[INFO] [FREEINTV] Average frame time per phase (ms):");
+	for (i = 0; i < PERF_PHASES; i++)
+		printf(" %s %.3f", PerfPhaseNames[i], PerfOverall(i) / 1000.0);
+	printf("\n");
+	PerfInit(perfTicks, perfUsec); // the next title starts from zero
+}
+
+// Frame timeline, see timeline.h.  It uses the same perf interface, and
+// the frames recorded are written to the save directory when
+// freeintv_timeline is switched off or the game is closed.
+static void timelineWrite(void)
+{
+	char path[PATH_MAX_LENGTH];
+	const char *dir = NULL;
+
+	if (!TimelineRecording)
+		return;
+	if (!Environ(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &dir) || dir == NULL)
+		dir = SystemPath;
+	fill_pathname_join(path, dir ? dir : ".", "freeintv_timeline.json", sizeof(path));
+	if (TimelineWrite(path))
+		printf("[INFO] [FREEINTV] Frame timeline written to %s\n", path);
+	else
+		printf("[ERROR] [FREEINTV] Could not write the frame timeline to %s\n", path);
+}
+
+static void timelineSetMode(int on)
+{
+	if (on == TimelineRecording)
+		return;
+	if (on && perf_cb.get_perf_counter && perf_cb.get_time_usec)
+	{
+		TimelineStart(perfTicks, perfUsec);
+	}
+	else if (!on)
+	{
+		timelineWrite();
+		TimelineStop();
+	}
+}
 
 unsigned int frameWidth = MaxWidth;
 unsigned int frameHeight = MaxHeight;
@@ -948,8 +966,8 @@ unsigned int frameSize =  MaxWidth * MaxHeight; //78848
 
 void quit(int state)
 {
-	Reset();
-	MemoryInit();
+	Reset(machine);
+	MemoryInit(machine);
 }
 
 static void Keyboard(bool down, unsigned keycode,
@@ -1088,7 +1106,53 @@ static void check_variables(bool first_run)
 			if (strcmp(var.value, "enabled") == 0)
 				multi_screen_enabled = 1;
 		}
+
+		// Audio output rate, the mixer resamples PSG and Intellivoice to it
+		var.key   = "freeintv_audio_rate";
+		var.value = NULL;
+
+		if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+			MixerInit(atoi(var.value));
+		else
+			MixerInit(MIXER_DEFAULT_RATE);
+		MixerReset(&machine->mixer);
 	}
+
+	// Rewind buffer and snapshot interval, these apply right away
+	{
+		int megabytes = 0;
+		int interval = 1;
+
+		var.key   = "freeintv_rewind_buffer";
+		var.value = NULL;
+		if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+			megabytes = atoi(var.value); // "disabled" reads as 0
+
+		var.key   = "freeintv_rewind_interval";
+		var.value = NULL;
+		if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+			interval = atoi(var.value);
+
+		RewindInit(machine, megabytes, interval);
+	}
+
+	var.key   = "freeintv_perf_counters";
+	var.value = NULL;
+	if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		perfSetMode(strcmp(var.value, "overlay") == 0 ? 2 : strcmp(var.value, "enabled") == 0);
+	else
+		perfSetMode(0);
+
+	var.key   = "freeintv_timeline";
+	var.value = NULL;
+	timelineSetMode(Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value && strcmp(var.value, "enabled") == 0);
+
+	var.key   = "freeintv_run_ahead";
+	var.value = NULL;
+	if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		RunAheadInit(machine, atoi(var.value)); // "disabled" reads as 0
+	else
+		RunAheadInit(machine, 0);
 }
 
 void retro_set_environment(retro_environment_t fn)
@@ -1104,6 +1168,7 @@ void retro_init(void)
 {
 	char execPath[PATH_MAX_LENGTH];
 	char gromPath[PATH_MAX_LENGTH];
+	char cartDBPath[PATH_MAX_LENGTH];
 	struct retro_keyboard_callback kb = { Keyboard };
 
 	// controller descriptors
@@ -1150,53 +1215,77 @@ void retro_init(void)
 	};
 
 	// init buffers, structs
-	memset(frame, 0, frameSize);
-	OSD_setDisplay(frame, MaxWidth, MaxHeight);
+	machine = MachineCreate();
+	memset(machine->stic.frame, 0, frameSize);
+	OSD_setDisplay(machine->stic.frame, MaxWidth, MaxHeight);
 
 	Environ(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, desc);
 
 	if (Environ(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL))
 		libretro_supports_bitmasks = true;
 
-	// reset console
-	Init();
-	Reset();
-
 	// get paths
 	Environ(RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY, &SystemPath);
 
 	// load exec
 	fill_pathname_join(execPath, SystemPath, "exec.bin", PATH_MAX_LENGTH);
-	loadExec(execPath);
+	loadExec(machine, execPath);
 
 	// load grom
 	fill_pathname_join(gromPath, SystemPath, "grom.bin", PATH_MAX_LENGTH);
-	loadGrom(gromPath);
+	loadGrom(machine, gromPath);
+
+	// extra cartridge database entries, optional
+	fill_pathname_join(cartDBPath, SystemPath, CARTDB_FILE, PATH_MAX_LENGTH);
+	if (CartDBLoad(cartDBPath) >= 0)
+		printf("[INFO] [FREEINTV] Loaded cartridge database from: %s\n", cartDBPath);
 
 	// Setup keyboard input
 	Environ(RETRO_ENVIRONMENT_SET_KEYBOARD_CALLBACK, &kb);
+
+	// frame budget counters, also listed in the frontend's perf log
+	memset(&perf_cb, 0, sizeof(perf_cb));
+	if (Environ(RETRO_ENVIRONMENT_GET_PERF_INTERFACE, &perf_cb) && perf_cb.perf_register)
+	{
+		int i;
+
+		for (i = 0; i < PERF_PHASES; i++)
+		{
+			memset(&perfCounters[i], 0, sizeof(perfCounters[i]));
+			perfCounters[i].ident = PerfPhaseNames[i];
+			perf_cb.perf_register(&perfCounters[i]);
+		}
+	}
 }
 
 	bool retro_load_game(const struct retro_game_info *info)
 	{
 		check_variables(true);
-		LoadGame(info->path);
+		// the frontend has read the file, unless it only gave us a path
+		if (info->data && info->size)
+			LoadGameData(machine, info->data, info->size);
+		else
+			LoadGame(machine, info->path);
+		RewindReset(machine);
 		
-		// Load embedded asset images (controller base, banner, overlay)
-		load_controller_base();
-		load_banner();
-		load_overlay_for_rom(info->path, SystemPath);
+		// The keypad images are decoded by render_multi_screen() once
+		// multi-screen is on, which may be never
+		game_path[0] = '\0';
+		if (info->path)
+			snprintf(game_path, sizeof(game_path), "%s", info->path);
+		multi_screen_assets = 0;
 		init_overlay_hotspots();	return true;
 }
 
 void retro_unload_game(void)
 {
+	perfReport();
+	timelineSetMode(0); // check_variables() starts it again for the next game
 	quit(0);
 }
 
 void retro_run(void)
 {
-	int c, i, j, k, l;
 	int showKeypad0;
 	int showKeypad1;
 	bool options_updated;
@@ -1214,6 +1303,9 @@ void retro_run(void)
 	if (Environ(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &options_updated) && options_updated)
 		check_variables(false);
 
+	PerfFrameBegin();
+	TIMELINE_BEGIN(TIMELINE_FRAME);
+
 	update_input();
 
 	// Pause
@@ -1241,13 +1333,27 @@ void retro_run(void)
 			OSD_drawTextBG(3, 10, " X      - LAST SELECTED KEYPAD BUTTON ");
 			OSD_drawTextBG(3, 11, " L/R    - SHOW KEYPAD                 ");
 			OSD_drawTextBG(3, 12, " LT/RT  - KEYPAD CLEAR/ENTER          ");
-			OSD_drawTextBG(3, 13, "                                      ");
+			OSD_drawTextBG(3, 13, " LEFT   - REWIND (IF ENABLED)         ");
 			OSD_drawTextBG(3, 14, " START  - PAUSE GAME                  ");
 			OSD_drawTextBG(3, 15, " SELECT - SWAP LEFT/RIGHT CONTROLLERS ");
 			OSD_drawTextBG(3, 16, "                                      ");
 			OSD_drawTextBG(3, 17, " freeintv 1.2          LICENSE GPL V2+");
 			OSD_drawTextBG(3, 18, "                                      ");
 		}
+
+		// rewind, one snapshot per frame while left is held
+		if(joypad0[2]==1 || joypad1[2]==1)
+		{
+			if(RewindStep(machine))
+			{
+				OSD_drawPaused();
+				OSD_drawTextCenterBG(21, "REWIND");
+			}
+			else
+			{
+				OSD_drawTextCenterBG(21, "REWIND - NO MORE HISTORY");
+			}
+		}
 	}
 	else
 	{
@@ -1258,24 +1364,24 @@ void retro_run(void)
 			if(joypad0[10] | joypad0[11]) // left/right shoulder down
 			{
 				showKeypad0 = true;
-				setControllerInput(0, getKeypadState(0, joypad0, joypre0));
+				setControllerInput(machine, 0, getKeypadState(0, joypad0, joypre0));
 			}
 			else
 			{
 				showKeypad0 = false;
-				setControllerInput(0, getControllerState(joypad0, 0));
+				setControllerInput(machine, 0, getControllerState(joypad0, 0));
 			}
 
 			// Player 2: L/R button shows keypad overlay
 			if(joypad1[10] | joypad1[11]) // left/right shoulder down
 			{
 				showKeypad1 = true;
-				setControllerInput(1, getKeypadState(1, joypad1, joypre1));
+				setControllerInput(machine, 1, getKeypadState(1, joypad1, joypre1));
 			}
 			else
 			{
 				showKeypad1 = false;
-				setControllerInput(1, getControllerState(joypad1, 1));
+				setControllerInput(machine, 1, getControllerState(joypad1, 1));
 			}
 		}
 		// MULTI-SCREEN MODE: Use overlay hotspot system
@@ -1302,72 +1408,49 @@ void retro_run(void)
 			// If no hotspots pressed, handle regular controller input
 			if (!any_hotspot_pressed)
 			{
-				setControllerInput(0, getControllerState(joypad0, 0));
+				setControllerInput(machine, 0, getControllerState(joypad0, 0));
 			}
 
 			// Player 2 controller input (unchanged - no hotspot overlay for player 2)
 			if(joypad1[10] | joypad1[11]) // left shoulder down
 			{
 				showKeypad1 = true;
-				setControllerInput(1, getKeypadState(1, joypad1, joypre1));
+				setControllerInput(machine, 1, getKeypadState(1, joypad1, joypre1));
 			}
 			else
 			{
 				showKeypad1 = false;
-				setControllerInput(1, getControllerState(joypad1, 1));
+				setControllerInput(machine, 1, getControllerState(joypad1, 1));
 			}
 		}
 
 		if(keyboardDown || keyboardChange)
 		{
-			setControllerInput(0, keyboardState);
+			setControllerInput(machine, 0, keyboardState);
 			keyboardChange = false;
 		}
 
 		// grab frame
-		Run();
+		RunAheadBegin(machine);
+		Run(machine);
 
-		// draw overlays
-		if(showKeypad0) { drawMiniKeypad(0, frame); }
-		if(showKeypad1) { drawMiniKeypad(1, frame); }
+		// resample PSG and Intellivoice to the output rate
+		PERF_PHASE(PERF_MIXER);
+		TIMELINE_BEGIN(TIMELINE_MIX);
+		MixerFrame(machine, audioOutput);
+		AudioBatch(audioOutput, MixerSamples);
+		PSGFrame(machine);
+		TIMELINE_END(TIMELINE_MIX);
+		PERF_PHASE(PERF_OTHER);
 
-		// sample audio from buffer
-		audioInc = 3733.5 / audioSamples;
-		ivoiceInc = 1.0;
+		RewindFrame(machine);
 
-		j = 0;
-		for(i=0; i<audioSamples; i++)
-		{
-			// Sound interpolator:
-			//   The PSG module generates audio at 224010 hz (3733.5 samples per frame)
-			//   Very high frequencies like 0x0001 would generate chirps on output
-			//   (For example, Lock&Chase) so this code interpolates audio, making
-			//   these silent as in real hardware.
-			audioBufferPos += audioInc;
-			k = audioBufferPos;
-			l = k - j;
-
-			c = 0;
-			while (j < k)
-				c += PSGBuffer[j++];
-			c = c / l;
-			// Finally it adds the Intellivoice output (properly generated at the
-			// same frequency as output)
-			c = (c + ivoiceBuffer[(int) ivoiceBufferPos]) / 2;
-
-			Audio(c, c); // Audio(left, right)
-
-			ivoiceBufferPos += ivoiceInc;
-
-			if (ivoiceBufferPos >= ivoiceBufferSize)
-				ivoiceBufferPos = 0.0;
-
-			audioBufferPos = audioBufferPos * (audioBufferPos<(PSGBufferSize-1));
-		}
-		audioBufferPos = 0.0;
-		PSGFrame();
-		ivoiceBufferPos = 0.0;
-		ivoice_frame();
+		// with run-ahead, show a frame further on and roll back
+		RunAheadEnd(machine);
+
+		// draw overlays
+		if(showKeypad0) { drawMiniKeypad(0, machine->stic.frame); }
+		if(showKeypad1) { drawMiniKeypad(1, machine->stic.frame); }
 	}
 
 	// Swap Left/Right Controller
@@ -1387,18 +1470,29 @@ void retro_run(void)
 		}
 	}
 
-	if (intv_halt)
+	if (machine->halt)
 		OSD_drawTextBG(3, 5, "INTELLIVISION HALTED");
 	
+	if (perfMode == 2)
+		perfDrawOverlay();
+
 	// Render multi-screen display (game + keypad)
+	PERF_PHASE(PERF_COMPOSITOR);
+	TIMELINE_BEGIN(TIMELINE_COMPOSITOR);
 	render_multi_screen();
+	TIMELINE_END(TIMELINE_COMPOSITOR);
+	PERF_PHASE(PERF_OTHER);
+	perfFrameEnd();
 	
 	// Send frame to libretro
+	TIMELINE_BEGIN(TIMELINE_VIDEO);
 	if (multi_screen_enabled && multi_screen_buffer) {
 		Video(multi_screen_buffer, WORKSPACE_WIDTH, WORKSPACE_HEIGHT, sizeof(unsigned int) * WORKSPACE_WIDTH);
 	} else {
-		Video(frame, frameWidth, frameHeight, sizeof(unsigned int) * frameWidth);
+		Video(machine->stic.frame, frameWidth, frameHeight, sizeof(unsigned int) * frameWidth);
 	}
+	TIMELINE_END(TIMELINE_VIDEO);
+	TIMELINE_END(TIMELINE_FRAME);
 
 }
 
@@ -1416,7 +1510,7 @@ void retro_get_system_info(struct retro_system_info *info)
 #endif
 	info->library_version = "1.2 " GIT_VERSION;
 	info->valid_extensions = "int|bin|rom";
-	info->need_fullpath = true;
+	info->need_fullpath = false;
 }
 
 void retro_get_system_av_info(struct retro_system_av_info *info)
@@ -1441,7 +1535,7 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
 	}
 
 	info->timing.fps = DefaultFPS;
-	info->timing.sample_rate = AUDIO_FREQUENCY;
+	info->timing.sample_rate = MixerRate;
 
 	Environ(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &pixelformat);
 }
@@ -1451,20 +1545,29 @@ void retro_deinit(void)
 {
 	libretro_supports_bitmasks = false;
 	libretro_supports_option_categories = false;
+	RewindDeinit();
+	if (perfMode && perf_cb.perf_log)
+		perf_cb.perf_log();
+	perfSetMode(0);
+	timelineSetMode(0);
 	quit(0);
+	CartDBFree();
+	MachineDestroy(machine);
+	machine = NULL;
 }
 
 void retro_reset(void)
 {
 	// Reset (from intv.c) //
-	Reset();
+	Reset(machine);
+	RewindReset(machine);
 }
 
 RETRO_API void *retro_get_memory_data(unsigned id)
 {
 	if(id==RETRO_MEMORY_SYSTEM_RAM)
 	{
-		return Memory;
+		return machine->MemoryFlat;
 	}
 	return 0;
 }
@@ -1478,56 +1581,37 @@ RETRO_API size_t retro_get_memory_size(unsigned id)
 	return 0;
 }
 
-#define SERIALIZED_VERSION 0x4f544702
-
-struct serialized {
-	int version;
-	struct CP1610serialized CP1610;
-	struct STICserialized STIC;
-	struct PSGserialized PSG;
-	struct ivoiceSerialized ivoice;
-	unsigned int Memory[0x10000];   // Should be equal to Memory.c
-	// Extra variables from intv.c
-	int SR1;
-	int intv_halt;
-};
-
 size_t retro_serialize_size(void)
 {
-	return sizeof(struct serialized);
+	static size_t size = 0;
+	struct StateBuffer state;
+
+	// the layout is fixed, so measure it once
+	if (size == 0)
+	{
+		StateWriteBegin(&state, NULL, 0);
+		SerializeMachine(machine, &state, 1);
+		size = state.pos;
+	}
+	return size;
 }
 
 bool retro_serialize(void *data, size_t size)
 {
-	struct serialized *all;
-
-	all = (struct serialized *) data;
-	all->version = SERIALIZED_VERSION;
-	CP1610Serialize(&all->CP1610);
-	STICSerialize(&all->STIC);
-	PSGSerialize(&all->PSG);
-	ivoiceSerialize(&all->ivoice);
-	memcpy(all->Memory, Memory, sizeof(Memory));
-	all->SR1 = SR1;
-	all->intv_halt = intv_halt;
-	return true;
+	struct StateBuffer state;
+
+	StateWriteBegin(&state, data, size);
+	SerializeMachine(machine, &state, 1);
+	return !state.error;
 }
 
 bool retro_unserialize(const void *data, size_t size)
 {
-	const struct serialized *all;
+	struct StateBuffer state;
 
-	all = (const struct serialized *) data;
-	if (all->version != SERIALIZED_VERSION)
+	if (!StateReadBegin(&state, data, size))
 		return false;
-	CP1610Unserialize(&all->CP1610);
-	STICUnserialize(&all->STIC);
-	PSGUnserialize(&all->PSG);
-	ivoiceUnserialize(&all->ivoice);
-	memcpy(Memory, all->Memory, sizeof(Memory));
-	SR1 = all->SR1;
-	intv_halt = all->intv_halt;
-	return true;
+	return UnserializeMachine(machine, &state, 1) != 0;
 }
 
 /* Stubs */
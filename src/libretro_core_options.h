@@ -60,6 +60,16 @@ struct retro_core_option_v2_category option_cats_us[] = {
       "Display",
       "Change display settings."
    },
+   {
+      "audio",
+      "Audio",
+      "Change audio settings."
+   },
+   {
+      "rewind",
+      "Rewind",
+      "Change core-side rewind settings."
+   },
    { NULL, NULL, NULL },
 };
 
@@ -78,6 +88,21 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "right"
    },
+   {
+      "freeintv_run_ahead",
+      "Run-Ahead Frames",
+      NULL,
+      "Emulate this many frames ahead each frame, show the last one and roll back, so the picture answers input sooner. Costs one extra frame of emulation per frame run ahead. Don't combine with the frontend's own run-ahead.",
+      NULL,
+      "input",
+      {
+         { "disabled", "Disabled" },
+         { "1",        "1 frame"  },
+         { "2",        "2 frames" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "freeintv_multiscreen_overlay",
       "Onscreen Interactive Keypad Overlays (Restart and Touchscreen/Mouse Required)",
@@ -92,6 +117,81 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "freeintv_perf_counters",
+      "Performance Counters",
+      NULL,
+      "Time the CPU, STIC, PSG, Intellivoice, mixer and compositor each frame using the frontend's performance counters. 'Overlay' also shows 60-frame averages on screen. The averages for the game are logged when it is closed. The PSG and Intellivoice are timed on one instruction in 16 and scaled up.",
+      NULL,
+      "display",
+      {
+         { "disabled", "Disabled" },
+         { "enabled",  "Enabled"  },
+         { "overlay",  "Overlay"  },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "freeintv_timeline",
+      "Frame Timeline",
+      NULL,
+      "Record when each part of the last 12 seconds or so of frames ran: STIC phases, the VBLANK interrupt, rendering, sound, the compositor and the video callback. Switching this off or closing the game writes freeintv_timeline.json to the save directory, to open in chrome://tracing or Perfetto. Needs the frontend's performance counters.",
+      NULL,
+      "display",
+      {
+         { "disabled", "Disabled" },
+         { "enabled",  "Enabled"  },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "freeintv_audio_rate",
+      "Audio Output Rate (Restart)",
+      NULL,
+      "Sample rate of the mixed PSG and Intellivoice output. Pick the rate of your audio device to avoid a second resampling pass in the frontend.",
+      NULL,
+      "audio",
+      {
+         { "44100", "44100 Hz" },
+         { "48000", "48000 Hz" },
+         { "96000", "96000 Hz" },
+         { NULL, NULL },
+      },
+      "44100"
+   },
+   {
+      "freeintv_rewind_buffer",
+      "Rewind Buffer Size",
+      NULL,
+      "Memory set aside for rewinding. While paused, hold Left to step back through recent play and press Start to carry on from there. Snapshots are stored as compressed differences, so a few megabytes reach back several minutes.",
+      NULL,
+      "rewind",
+      {
+         { "disabled", "Disabled" },
+         { "4",        "4 MB"     },
+         { "16",       "16 MB"    },
+         { "64",       "64 MB"    },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "freeintv_rewind_interval",
+      "Rewind Granularity",
+      NULL,
+      "Frames between rewind snapshots. Larger steps reach further back in the same buffer.",
+      NULL,
+      "rewind",
+      {
+         { "1", "1 frame"  },
+         { "2", "2 frames" },
+         { "4", "4 frames" },
+         { NULL, NULL },
+      },
+      "1"
+   },
    { NULL, NULL, NULL, NULL, NULL, NULL, {{0}}, NULL },
 };
 
@@ -16,16 +16,16 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "intv.h"
 #include "memory.h"
 #include "stic.h"
 #include "psg.h"
 #include "ivoice.h"
-
-unsigned int Memory[0x10000];
-
-int d000_ram = 0; /* 1 = $D000-$D3FF is 8-bit RAM (e.g. USCF Chess) */
+#include "state.h"
+#include "heatmap.h"
 
 int stic_and[64] = {
     0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
@@ -49,10 +49,57 @@ int stic_or[64] = {
     0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff,
 };
 
-void writeMem(int adr, int val) // Write (should handle hooks/alias)
+// Ranges writeMem can change, 16-bit words each.  Everything else is ROM
+// reloaded with the cart, aliases, or unmapped, and isn't saved.
+static const int writable[][2] = {
+    { 0x0000, 0x0FFF }, // STIC, Intellivoice, scratch RAM, PSG, system RAM
+    { 0x2000, 0x2FFF },
+    { 0x3800, 0x39FF }, // GRAM
+    { 0x4000, 0x4FFF },
+    { 0x7000, 0x77FF },
+    { 0x8000, 0x9FFF },
+    { 0xC000, 0xCFFF },
+    { 0xD000, 0xD3FF }, // RAM 8 on some carts
+};
+
+void MemorySerialize(struct Machine *m, struct StateBuffer *state)
+{
+    size_t mark = StateChunkBegin(state, "MEM ");
+    int i, a;
+
+    // the ranges are whole pages
+    for (i = 0; i < (int)(sizeof(writable) / sizeof(writable[0])); i++)
+        for (a = writable[i][0]; a <= writable[i][1]; a += MEMORY_PAGE_SIZE)
+            StatePutWords(state, &MemoryPeek(m, a), MEMORY_PAGE_SIZE);
+    StateChunkEnd(state, mark);
+}
+
+void MemoryUnserialize(struct Machine *m, struct StateBuffer *state)
+{
+    unsigned int page[MEMORY_PAGE_SIZE];
+    int i, a;
+
+    if (!StateChunkOpen(state, "MEM "))
+        return;
+    for (i = 0; i < (int)(sizeof(writable) / sizeof(writable[0])); i++)
+    {
+        for (a = writable[i][0]; a <= writable[i][1]; a += MEMORY_PAGE_SIZE)
+        {
+            StateGetWords(state, page, MEMORY_PAGE_SIZE);
+            // leave pages still matching the image shared
+            if (memcmp(&MemoryPeek(m, a), page, sizeof(page)) != 0)
+                memcpy(&MemoryPoke(m, a), page, sizeof(page));
+        }
+    }
+    MemoryTouchAll(m);
+}
+
+void writeMem(struct Machine *m, int adr, int val) // Write (should handle hooks/alias)
 {
+    MemoryLogWrite(m, adr, val);
     val &= 0xFFFF;
     adr &= 0xFFFF;
+    HEATMAP_ACCESS(m, HEATMAP_WRITES, adr, val);
     
     // Ignore writes to protected ROM spaces
     // Note: B17 Bomber manages to write on EXEC ROM (it will crash if unprotected)
@@ -68,8 +115,9 @@ void writeMem(int adr, int val) // Write (should handle hooks/alias)
         case 0x15:  /* A800-AFFF */
         case 0x16:  /* B000-B7FF */
         case 0x1a:  /* D000-D7FF */
-            if (d000_ram && adr <= 0xD3FF) {
-                Memory[adr] = val & 0xFF; /* RAM 8 */
+            if (m->d000_ram && adr <= 0xD3FF) {
+                MemoryPoke(m, adr) = val & 0xFF; /* RAM 8 */
+                MemoryTouch(m, adr);
             }
             return;
         case 0x1b:  /* D800-DFFF */
@@ -81,50 +129,68 @@ void writeMem(int adr, int val) // Write (should handle hooks/alias)
         case 0x0f:  /* GRAM 7800-7fff */
         case 0x17:  /* GRAM B800-BFFF */
         case 0x1f:  /* GRAM F800-FFFF */
-            if (stic_gram != 0) {
+            if (m->stic.gram != 0) {
                 // GRAM is 8-bit memory
                 // Note: Without the AND 0xff, Tower of Doom fails as it builds
                 // map from GRAM.
-                Memory[adr & 0x39FF] = val & 0xff;
+                MemoryPoke(m, adr & 0x39FF) = val & 0xff;
+                MemoryTouch(m, adr & 0x39FF);
             }
             return;
     }
     if (adr == 0x80 || adr == 0x81) {
-        ivoice_wr(adr & 1, val);
+        ivoice_wr(&m->ivoice, adr & 1, val);
         return;
     }
     if(adr>=0x100 && adr<=0x1FF)
     {
         val = val & 0xFF;
-        Memory[adr] = val;
+        MemoryPoke(m, adr) = val;
+        MemoryTouch(m, adr);
         //PSG Registers
         if(adr>=0x01F0 && adr<=0x1FD)
         {
-            PSGNotify(adr, val);
+            PSGNotify(m, adr, val);
         }
         return;
     }
     
     // STIC access
     if ((adr & 0x3fc0) == 0x0000) {
-        if (stic_reg != 0) {
+        if (m->stic.reg != 0) {
             adr &= 0x3f;
             // STIC Display Enable
             if (adr == 0x20)
-                DisplayEnabled = 1;
+                m->stic.DisplayEnabled = 1;
             // STIC Mode Select
             if (adr == 0x21)
-                STICMode = 0;   // Foreground/Background mode
-            Memory[adr] = (val & stic_and[adr]) | stic_or[adr];
+                m->stic.Mode = 0;   // Foreground/Background mode
+            MemoryPoke(m, adr) = (val & stic_and[adr]) | stic_or[adr];
+            MemoryTouch(m, adr);
         }
         return;
     }
     
-    Memory[adr] = val;
-    
+    MemoryPoke(m, adr) = val;
+    MemoryTouch(m, adr);
 }
 
-int readMem(int adr) // Read (should handle hooks/alias)
+#ifdef FREEINTV_HEATMAP
+// Counted on the way out, readBus() does the reading
+static int readBus(struct Machine *m, int adr);
+
+int readMem(struct Machine *m, int adr)
+{
+    int val = readBus(m, adr);
+
+    HEATMAP_ACCESS(m, HEATMAP_READS, adr & 0xffff, val);
+    return val;
+}
+#else
+#define readBus readMem
+#endif
+
+int readBus(struct Machine *m, int adr) // Read (should handle hooks/alias)
 {
 	// It's safe to map ROM over GRAM aliases
 
@@ -132,27 +198,27 @@ int readMem(int adr) // Read (should handle hooks/alias)
     
     adr &= 0xffff;
     if (adr == 0x80 || adr == 0x81)
-        return ivoice_rd(adr & 1);
+        return ivoice_rd(&m->ivoice, adr & 1);
     // STIC access
     if ((adr & 0x3fc0) == 0x0000) {
-        if (stic_reg != 0 && (adr & 0x3f) == 0x21)
-            STICMode = 1;   // Color Stack mode
+        if (m->stic.reg != 0 && (adr & 0x3f) == 0x21)
+            m->stic.Mode = 1;   // Color Stack mode
         if (adr >= 0x4000)
             return 0xffff;
-        if (stic_reg == 0)  // Return trash
+        if (m->stic.reg == 0)  // Return trash
             return adr & 0x0e;
         adr &= 0x3f;
-        val = (Memory[adr] & stic_and[adr]) | stic_or[adr];
+        val = (MemoryPeek(m, adr) & stic_and[adr]) | stic_or[adr];
         return val;
 	}
-    val = Memory[adr];
+    val = MemoryPeek(m, adr);
 
 	if(adr>=0x100 && adr<=0x1FF)
 	{
 		val = val & 0xFF;
 	}
 
-	if(d000_ram && adr>=0xD000 && adr<=0xD3FF)
+	if(m->d000_ram && adr>=0xD000 && adr<=0xD3FF)
 	{
 		val = val & 0xFF; /* RAM 8 */
 	}
@@ -160,29 +226,170 @@ int readMem(int adr) // Read (should handle hooks/alias)
 	return val;
 }
 
-void MemoryInit()
+void MemoryInit(struct Machine *m)
 {
 	int i;
-	d000_ram = 0; /* reset per-cart flags before loading new cart */
-	for(i=0x0000; i<=0x0007; i++) { Memory[i] = 0x3800; } /* STIC Registers */
-	for(i=0x0008; i<=0x000F; i++) { Memory[i] = 0x3000; }
-	for(i=0x0010; i<=0x0017; i++) { Memory[i] = 0x0000; }
-	for(i=0x0018; i<=0x001F; i++) { Memory[i] = 0x3C00; }
-	for(i=0x0020; i<=0x003F; i++) { Memory[i] = 0x3FFF; }
-	for(i=0x0028; i<=0x002C; i++) { Memory[i] = 0x3FF0; }
-	Memory[0x30] = 0x3FF8;
-	Memory[0x31] = 0x3FF8;
-	Memory[0x32] = 0x3FFC;
-	for(i=0x0040; i<=0x007F; i++) { Memory[i] = 0x0000; }
-	for(i=0x0080; i<=0x00FF; i++) { Memory[i] = 0xFFFF; }
-	for(i=0x0100; i<=0x035F; i++) { Memory[i] = 0x0000; } // Scratch, PSG (1F0-1FF), System Ram
-	for(i=0x0360; i<=0x0FFF; i++) { Memory[i] = 0xFFFF; }
-	for(i=0x1000; i<=0x1FFF; i++) { Memory[i] = 0x0000; } // EXEC ROM
-	for(i=0x2000; i<=0x2FFF; i++) { Memory[i] = 0xFFFF; }
-	for(i=0x3000; i<=0x3FFF; i++) { Memory[i] = 0x0000; } // GROM, GRAM
-	for(i=0x4000; i<=0x4FFF; i++) { Memory[i] = 0xFFFF; }
-	for(i=0x5000; i<=0x5FFF; i++) { Memory[i] = 0x0000; }
-	for(i=0x6000; i<=0xFFFF; i++) { Memory[i] = 0xFFFF; }
-	Memory[0x1FE] = 0xFF; /* Controller R */
-	Memory[0x1FF] = 0xFF; /* Controller L */
+	m->d000_ram = 0; /* reset per-cart flags before loading new cart */
+	for(i=0x0000; i<=0x0007; i++) { MemoryPoke(m, i) = 0x3800; } /* STIC Registers */
+	for(i=0x0008; i<=0x000F; i++) { MemoryPoke(m, i) = 0x3000; }
+	for(i=0x0010; i<=0x0017; i++) { MemoryPoke(m, i) = 0x0000; }
+	for(i=0x0018; i<=0x001F; i++) { MemoryPoke(m, i) = 0x3C00; }
+	for(i=0x0020; i<=0x003F; i++) { MemoryPoke(m, i) = 0x3FFF; }
+	for(i=0x0028; i<=0x002C; i++) { MemoryPoke(m, i) = 0x3FF0; }
+	MemoryPoke(m, 0x30) = 0x3FF8;
+	MemoryPoke(m, 0x31) = 0x3FF8;
+	MemoryPoke(m, 0x32) = 0x3FFC;
+	for(i=0x0040; i<=0x007F; i++) { MemoryPoke(m, i) = 0x0000; }
+	for(i=0x0080; i<=0x00FF; i++) { MemoryPoke(m, i) = 0xFFFF; }
+	for(i=0x0100; i<=0x035F; i++) { MemoryPoke(m, i) = 0x0000; } // Scratch, PSG (1F0-1FF), System Ram
+	for(i=0x0360; i<=0x0FFF; i++) { MemoryPoke(m, i) = 0xFFFF; }
+	for(i=0x1000; i<=0x1FFF; i++) { MemoryPoke(m, i) = 0x0000; } // EXEC ROM
+	for(i=0x2000; i<=0x2FFF; i++) { MemoryPoke(m, i) = 0xFFFF; }
+	for(i=0x3000; i<=0x3FFF; i++) { MemoryPoke(m, i) = 0x0000; } // GROM, GRAM
+	for(i=0x4000; i<=0x4FFF; i++) { MemoryPoke(m, i) = 0xFFFF; }
+	for(i=0x5000; i<=0x5FFF; i++) { MemoryPoke(m, i) = 0x0000; }
+	for(i=0x6000; i<=0xFFFF; i++) { MemoryPoke(m, i) = 0xFFFF; }
+	MemoryPoke(m, 0x1FE) = 0xFF; /* Controller R */
+	MemoryPoke(m, 0x1FF) = 0xFF; /* Controller L */
+	MemoryTouchAll(m);
+}
+
+void MemoryLoadWords(struct Machine *m, int adr, const unsigned char *bytes, int count)
+{
+	unsigned int *words;
+	int n, i;
+
+	// a page at a time, the words within one are contiguous
+	while (count > 0)
+	{
+		n = MEMORY_PAGE_SIZE - (adr & (MEMORY_PAGE_SIZE - 1));
+		if (n > count)
+			n = count;
+		words = &MemoryPoke(m, adr);
+		for (i = 0; i < n; i++)
+			words[i] = (bytes[2 * i] << 8) | bytes[2 * i + 1];
+		adr += n;
+		bytes += 2 * n;
+		count -= n;
+	}
+}
+
+void MemoryLoadBytes(struct Machine *m, int adr, const unsigned char *bytes, int count)
+{
+	unsigned int *words;
+	int n, i;
+
+	while (count > 0)
+	{
+		n = MEMORY_PAGE_SIZE - (adr & (MEMORY_PAGE_SIZE - 1));
+		if (n > count)
+			n = count;
+		words = &MemoryPoke(m, adr);
+		for (i = 0; i < n; i++)
+			words[i] = bytes[i];
+		adr += n;
+		bytes += n;
+		count -= n;
+	}
+}
+
+void MemoryTouchAll(struct Machine *m)
+{
+	memset(m->MemoryDirty, 0xFF, sizeof(m->MemoryDirty));
+}
+
+int MemoryAlloc(struct Machine *m)
+{
+	int p;
+
+	m->MemoryFlat = (unsigned int *)calloc(0x10000, sizeof(unsigned int));
+	if (m->MemoryFlat == NULL)
+		return 0;
+	for (p = 0; p < MEMORY_PAGES; p++)
+		m->MemoryPage[p] = m->MemoryOwned[p] = m->MemoryFlat + (p << MEMORY_PAGE_SHIFT);
+	return 1;
+}
+
+int MemoryShare(struct Machine *m)
+{
+	struct MemoryImage *image;
+	int p;
+
+	if (m->MemoryFlat == NULL)
+		return m->MemoryShared != NULL;
+	image = (struct MemoryImage *)malloc(sizeof(struct MemoryImage));
+	if (image == NULL)
+		return 0;
+	image->refs = 1;
+	image->words = m->MemoryFlat;
+	m->MemoryFlat = NULL;
+	m->MemoryShared = image;
+	for (p = 0; p < MEMORY_PAGES; p++)
+		m->MemoryOwned[p] = NULL;
+	return 1;
+}
+
+int MemoryClone(struct Machine *dst, const struct Machine *src)
+{
+	int p;
+
+	// dst came from a memcpy of src, none of its pointers are its own yet
+	dst->MemoryFlat = NULL;
+	dst->MemoryShared = src->MemoryShared;
+	if (dst->MemoryShared)
+		dst->MemoryShared->refs++;
+	for (p = 0; p < MEMORY_PAGES; p++)
+	{
+		dst->MemoryOwned[p] = NULL;
+		if (dst->MemoryShared)
+			dst->MemoryPage[p] = dst->MemoryShared->words + (p << MEMORY_PAGE_SHIFT);
+	}
+	if (src->MemoryFlat && !MemoryAlloc(dst))
+		return 0;
+	for (p = 0; p < MEMORY_PAGES; p++)
+	{
+		if (!src->MemoryOwned[p])
+			continue;
+		if (!dst->MemoryOwned[p] && !MemoryOwn(dst, p))
+			return 0;
+		memcpy(dst->MemoryOwned[p], src->MemoryOwned[p], MEMORY_PAGE_SIZE * sizeof(unsigned int));
+	}
+	return 1;
+}
+
+unsigned int *MemoryOwn(struct Machine *m, int page)
+{
+	// writes made when out of memory land here and the machine stops
+	static unsigned int lost[MEMORY_PAGE_SIZE];
+	unsigned int *words = (unsigned int *)malloc(MEMORY_PAGE_SIZE * sizeof(unsigned int));
+
+	if (words == NULL)
+	{
+		m->halt = 1;
+		return lost;
+	}
+	memcpy(words, m->MemoryPage[page], MEMORY_PAGE_SIZE * sizeof(unsigned int));
+	m->MemoryPage[page] = m->MemoryOwned[page] = words;
+	return words;
+}
+
+void MemoryFree(struct Machine *m)
+{
+	int p;
+
+	if (m->MemoryFlat == NULL)
+	{
+		for (p = 0; p < MEMORY_PAGES; p++)
+			free(m->MemoryOwned[p]);
+	}
+	free(m->MemoryFlat);
+	if (m->MemoryShared && --m->MemoryShared->refs == 0)
+	{
+		free(m->MemoryShared->words);
+		free(m->MemoryShared);
+	}
+	for (p = 0; p < MEMORY_PAGES; p++)
+		m->MemoryPage[p] = m->MemoryOwned[p] = NULL;
+	m->MemoryFlat = NULL;
+	m->MemoryShared = NULL;
 }
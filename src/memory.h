@@ -18,14 +18,84 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-extern unsigned int Memory[0x10000];
+struct Machine;
 
-extern int d000_ram; /* 1 = $D000-$D3FF is 8-bit RAM (e.g. USCF Chess) */
+// Write tracking: one byte per 64-word block.  Every store to Memory[]
+// sets all its bits and each user clears its own bit once caught up, so
+// snapshots only need to look at blocks that changed.
+#define MEMORY_BLOCK_SHIFT 6
+#define MEMORY_BLOCK_SIZE (1 << MEMORY_BLOCK_SHIFT)
+#define MEMORY_BLOCKS (0x10000 >> MEMORY_BLOCK_SHIFT)
+#define MEMORY_DIRTY_REWIND   0x01
+#define MEMORY_DIRTY_RUNAHEAD 0x02
+#define MemoryTouch(m, adr) ((m)->MemoryDirty[(adr) >> MEMORY_BLOCK_SHIFT] = 0xFF)
+void MemoryTouchAll(struct Machine *m);
 
-void MemoryInit(void);
+// Memory is reached through a table of 256-word pages.  A new machine owns
+// a flat copy of the whole address space.  MemoryShare() hands that copy
+// over to a reference-counted image other machines can be cloned from;
+// from then on a page is copied out of the image the first time it's
+// written, so machines running the same cart only keep the pages they
+// changed (RAM, GRAM, the STIC and PSG registers).  Images are counted
+// without locking, create and destroy machines sharing one from a single
+// thread.
+#define MEMORY_PAGE_SHIFT 8
+#define MEMORY_PAGE_SIZE (1 << MEMORY_PAGE_SHIFT)
+#define MEMORY_PAGES (0x10000 >> MEMORY_PAGE_SHIFT)
 
-int readMem(int adr);
+struct MemoryImage {
+	int refs;
+	unsigned int *words; // 0x10000 words
+};
 
-void writeMem(int adr, int val);
+// MemoryPeek() reads a word, MemoryPoke() is the same word to write to
+#define MemoryPeek(m, adr) ((m)->MemoryPage[(adr) >> MEMORY_PAGE_SHIFT][(adr) & (MEMORY_PAGE_SIZE - 1)])
+#define MemoryPoke(m, adr) (((m)->MemoryOwned[(adr) >> MEMORY_PAGE_SHIFT] ? \
+	(m)->MemoryOwned[(adr) >> MEMORY_PAGE_SHIFT] : MemoryOwn((m), (adr) >> MEMORY_PAGE_SHIFT))[(adr) & (MEMORY_PAGE_SIZE - 1)])
+unsigned int *MemoryOwn(struct Machine *m, int page); // copies a shared page out of the image
+
+int MemoryAlloc(struct Machine *m); // the flat copy, 0 if out of memory
+int MemoryShare(struct Machine *m); // turns the flat copy into an image, 0 if out of memory
+int MemoryClone(struct Machine *dst, const struct Machine *src); // dst is a struct copy of src
+void MemoryFree(struct Machine *m);
+
+void MemoryInit(struct Machine *m);
+
+// Copy count words from a ROM file's bytes into memory from adr on, as
+// big-endian 16-bit words or one byte per 8-bit word.  Nothing is touched.
+void MemoryLoadWords(struct Machine *m, int adr, const unsigned char *bytes, int count);
+void MemoryLoadBytes(struct Machine *m, int adr, const unsigned char *bytes, int count);
+
+struct StateBuffer;
+
+void MemorySerialize(struct Machine *m, struct StateBuffer *); // writes the "MEM " chunk
+void MemoryUnserialize(struct Machine *m, struct StateBuffer *);
+
+// Built with FREEINTV_TRACE, writeMem() also keeps a log of the stores it
+// is asked to make, before any masking or ROM protection, so tools can
+// compare write streams.  Whoever reads it clears MemoryWriteCount first;
+// only the first MEMORY_WRITE_LOG writes after that are kept.
+#define MEMORY_WRITE_LOG 8
+
+struct MemoryWrite {
+	int adr;
+	int val;
+};
+
+#ifdef FREEINTV_TRACE
+#define MemoryLogWrite(m, a, v) do { \
+		if ((m)->MemoryWriteCount < MEMORY_WRITE_LOG) { \
+			(m)->MemoryWrites[(m)->MemoryWriteCount].adr = (a); \
+			(m)->MemoryWrites[(m)->MemoryWriteCount].val = (v); \
+		} \
+		(m)->MemoryWriteCount++; \
+	} while (0)
+#else
+#define MemoryLogWrite(m, a, v) ((void)0)
+#endif
+
+int readMem(struct Machine *m, int adr);
+
+void writeMem(struct Machine *m, int adr, int val);
 
 #endif
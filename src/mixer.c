@@ -0,0 +1,192 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <math.h>
+#include <string.h>
+#include "intv.h"
+#include "mixer.h"
+#include "psg.h"
+#include "ivoice.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Both sources are clocked from the CPU, so their nominal rates are
+// expressed per frame of 14934 cpu cycles (see exec() in intv.c):
+//   PSG          one sample every 4 cpu cycles   (3733.5 samples/frame)
+//   Intellivoice one sample every 358 clocks, 4 clocks per cpu cycle
+//                                                (~166.9 samples/frame)
+// The nominal rates only shape the filters.  Each frame, whatever a source
+// actually produced is spread exactly over that frame's output samples, so
+// the read position can never drift from the emulated machine.
+#define CYCLES_PER_FRAME 14934
+#define PSG_CYCLES       4
+#define IVOICE_CLOCKS    358
+
+#define MIXER_PHASES     64   // filter phases per source sample
+#define MIXER_MAX_TAPS   48   // enough for the PSG at 44.1khz
+#define MIXER_ZEROS      4    // sinc zero crossings each side of the kernel
+
+struct MixerSource {
+	int taps; // filter length
+	int16_t coef[MIXER_PHASES][MIXER_MAX_TAPS]; // Q14 windowed sinc, one row per phase
+};
+
+int MixerRate = MIXER_DEFAULT_RATE;
+int MixerSamples = MIXER_DEFAULT_RATE / 60;
+
+static struct MixerSource psgSource;
+static struct MixerSource ivoiceSource;
+
+// Builds a Blackman-windowed sinc low-pass for a source running at
+// 'ratio' times the output rate.  The cutoff sits just under the lower
+// of the two Nyquist frequencies, so PSG tones above the output band
+// (e.g. period 0x0001 in Lock & Chase) are filtered out instead of aliasing.
+static void buildFilter(struct MixerSource *src, double ratio)
+{
+	double fc = 0.45; // cutoff, cycles per source sample
+	double h[MIXER_MAX_TAPS];
+	double sum, t, x, w;
+	int p, k, half, acc;
+
+	if (ratio > 1.0)
+		fc = fc / ratio;
+
+	t = ceil(MIXER_ZEROS / fc);
+	src->taps = ((int)t + 1) & ~1;
+	if (src->taps > MIXER_MAX_TAPS)
+		src->taps = MIXER_MAX_TAPS;
+	half = src->taps / 2;
+
+	for (p = 0; p < MIXER_PHASES; p++)
+	{
+		sum = 0.0;
+		for (k = 0; k < src->taps; k++)
+		{
+			t = k - (half - 1) - (double)p / MIXER_PHASES; // distance from kernel center
+			x = 2.0 * fc * t;
+			w = t / half;
+			h[k] = 0.0;
+			if (w > -1.0 && w < 1.0)
+			{
+				h[k] = 0.42 + 0.5 * cos(M_PI * w) + 0.08 * cos(2.0 * M_PI * w);
+				if (x != 0.0)
+					h[k] *= sin(M_PI * x) / (M_PI * x);
+			}
+			sum += h[k];
+		}
+		// normalize each phase to unity gain so DC doesn't ripple between phases
+		acc = 0;
+		for (k = 0; k < src->taps; k++)
+		{
+			w = floor(h[k] / sum * 16384.0 + 0.5);
+			src->coef[p][k] = (int16_t)w;
+			acc += src->coef[p][k];
+		}
+		src->coef[p][half - 1] += 16384 - acc;
+	}
+}
+
+// Resamples one frame of source output, given as up to two spans so a
+// ring buffer can be read across its wrap.  The previous frame's last 'taps'
+// samples lead the fifo, so the kernel never needs to look ahead and the
+// latency is a fixed half kernel.
+static void resampleSource(const struct MixerSource *src, int16_t *fifo, const int16_t *in, int count, const int16_t *in2, int count2, int32_t *out)
+{
+	const int16_t *x;
+	const int16_t *h;
+	int32_t acc;
+	int i, k, pos, frac;
+
+	if (count > MIXER_FIFO_SIZE - src->taps)
+		count = MIXER_FIFO_SIZE - src->taps;
+	if (count2 > MIXER_FIFO_SIZE - src->taps - count)
+		count2 = MIXER_FIFO_SIZE - src->taps - count;
+	memcpy(fifo + src->taps, in, count * sizeof(int16_t));
+	if (count2 > 0)
+		memcpy(fifo + src->taps + count, in2, count2 * sizeof(int16_t));
+	count += count2;
+
+	// output i sits at source position i * count / MixerSamples
+	pos = 0;
+	frac = 0;
+	for (i = 0; i < MixerSamples; i++)
+	{
+		x = fifo + pos;
+		h = src->coef[frac * MIXER_PHASES / MixerSamples];
+		acc = 0;
+		for (k = 0; k < src->taps; k++)
+			acc += x[k] * h[k];
+		out[i] = acc >> 14;
+
+		frac += count;
+		while (frac >= MixerSamples)
+		{
+			frac -= MixerSamples;
+			pos++;
+		}
+	}
+
+	// keep the newest samples as history for the next frame
+	memmove(fifo, fifo + count, src->taps * sizeof(int16_t));
+}
+
+void MixerInit(int rate)
+{
+	if (rate < 8000 || rate > MIXER_MAX_RATE || rate % 60 != 0)
+		rate = MIXER_DEFAULT_RATE;
+
+	MixerRate = rate;
+	MixerSamples = rate / 60;
+
+	buildFilter(&psgSource, (double)CYCLES_PER_FRAME / PSG_CYCLES / MixerSamples);
+	buildFilter(&ivoiceSource, (double)CYCLES_PER_FRAME * 4 / IVOICE_CLOCKS / MixerSamples);
+}
+
+void MixerReset(struct Mixer *mixer)
+{
+	memset(mixer->psgFifo, 0, sizeof(mixer->psgFifo));
+	memset(mixer->ivoiceFifo, 0, sizeof(mixer->ivoiceFifo));
+}
+
+void MixerFrame(struct Machine *m, int16_t *out)
+{
+	struct Mixer *mixer = &m->mixer;
+	const int16_t *voice;
+	uint32_t tail;
+	int i, c, first;
+
+	resampleSource(&psgSource, mixer->psgFifo, m->psg.Buffer, m->psg.BufferPos, NULL, 0, mixer->psgOut);
+
+	// the Intellivoice hands over its output ring; read it in place
+	voice = ivoice_frame(&m->ivoice, &tail, &c);
+	tail &= SCBUF_MASK;
+	first = SCBUF_SIZE - (int)tail;
+	if (first > c)
+		first = c;
+	resampleSource(&ivoiceSource, mixer->ivoiceFifo, voice + tail, first, voice, c - first, mixer->ivoiceOut);
+
+	for (i = 0; i < MixerSamples; i++)
+	{
+		c = (mixer->psgOut[i] + mixer->ivoiceOut[i]) >> 1;
+		if (c > 32767) c = 32767;
+		if (c < -32768) c = -32768;
+		out[i * 2] = c;     // left
+		out[i * 2 + 1] = c; // right
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef MIXER_H
+#define MIXER_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdint.h>
+
+#define MIXER_DEFAULT_RATE  44100
+#define MIXER_MAX_RATE      96000
+#define MIXER_MAX_SAMPLES   (MIXER_MAX_RATE / 60) // output samples per frame at the highest rate
+#define MIXER_FIFO_SIZE     8192 // history plus a frame of PSG samples
+
+// Per machine resampler history.  The filters depend only on the rate and
+// are shared.
+struct Mixer {
+	int16_t psgFifo[MIXER_FIFO_SIZE]; // last frame's tail (taps samples), then this frame
+	int16_t ivoiceFifo[MIXER_FIFO_SIZE];
+	int32_t psgOut[MIXER_MAX_SAMPLES];
+	int32_t ivoiceOut[MIXER_MAX_SAMPLES];
+};
+
+struct Machine;
+
+extern int MixerRate; // output sample rate
+extern int MixerSamples; // output samples per frame (MixerRate / 60)
+
+void MixerInit(int rate); // builds the resampling filters for an output rate
+void MixerReset(struct Mixer *mixer); // clears resampler history
+void MixerFrame(struct Machine *m, int16_t *out); // mixes one frame of PSG and Intellivoice output into MixerSamples interleaved stereo samples
+
+#endif
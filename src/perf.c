@@ -0,0 +1,175 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <string.h>
+#include "perf.h"
+
+#ifdef FREEINTV_PERF
+volatile int PerfPhase;
+#endif
+
+const char *PerfPhaseNames[PERF_PHASES] = {
+	"other", "cpu", "stic", "psg", "ivoice", "mixer", "compositor"
+};
+
+int PerfCounting;
+uint64_t (*PerfNow)(void);
+uint64_t PerfTotal[PERF_PHASES];
+uint64_t PerfCalls[PERF_PHASES];
+
+static int64_t (*usecNow)(void);
+static int current = PERF_PHASES; // PERF_PHASES between frames
+static uint64_t mark;
+
+// PerfSample() estimates this frame, the phase they were taken from, and
+// the ticks of an empty PerfNow() interval to take off each sample
+static uint64_t sampled[PERF_PHASES];
+static int sampledFrom[PERF_PHASES];
+static uint64_t overhead;
+
+// Per frame ticks for the last PERF_WINDOW frames, and their sums
+static uint64_t history[PERF_WINDOW][PERF_PHASES];
+static uint64_t windowTotal[PERF_PHASES];
+static uint64_t frameStart[PERF_PHASES];
+static unsigned long frames;
+
+// Ticks per microsecond, measured over the first window and then each one
+static double ticksPerUsec;
+static uint64_t calibrateTicks;
+static int64_t calibrateUsec;
+
+void PerfInit(uint64_t (*now)(void), int64_t (*usec)(void))
+{
+	PerfCounting = now != NULL && usec != NULL;
+	PerfNow = now;
+	usecNow = usec;
+	current = PERF_PHASES;
+	memset(PerfTotal, 0, sizeof(PerfTotal));
+	memset(PerfCalls, 0, sizeof(PerfCalls));
+	memset(history, 0, sizeof(history));
+	memset(windowTotal, 0, sizeof(windowTotal));
+	memset(frameStart, 0, sizeof(frameStart));
+	memset(sampled, 0, sizeof(sampled));
+	frames = 0;
+	ticksPerUsec = 0;
+	if (PerfCounting)
+	{
+		int i;
+		uint64_t a, b;
+
+		overhead = ~(uint64_t)0;
+		for (i = 0; i < 16; i++)
+		{
+			a = PerfNow();
+			b = PerfNow();
+			if (b - a < overhead)
+				overhead = b - a;
+		}
+		calibrateTicks = PerfNow();
+		calibrateUsec = usecNow();
+	}
+}
+
+void PerfSwitch(int phase)
+{
+	uint64_t now;
+
+	if (current == PERF_PHASES)
+		return; // between frames
+	now = PerfNow();
+	PerfTotal[current] += now - mark;
+	mark = now;
+	current = phase;
+	PerfCalls[phase]++;
+}
+
+void PerfSample(int phase, uint64_t ticks)
+{
+	if (current == PERF_PHASES)
+		return;
+	sampled[phase] += (ticks > overhead ? ticks - overhead : 0) * PERF_SAMPLE_EVERY;
+	sampledFrom[phase] = current;
+	PerfCalls[phase] += PERF_SAMPLE_EVERY;
+}
+
+void PerfFrameBegin(void)
+{
+	if (!PerfCounting)
+		return;
+	mark = PerfNow();
+	current = PERF_OTHER;
+	PerfCalls[PERF_OTHER]++;
+}
+
+void PerfFrameEnd(void)
+{
+	uint64_t *slot;
+	int i;
+
+	if (!PerfCounting || current == PERF_PHASES)
+		return;
+	PerfSwitch(PERF_OTHER);
+	current = PERF_PHASES;
+
+	// an estimate can't take more than its phase spent this frame
+	for (i = 0; i < PERF_PHASES; i++)
+	{
+		uint64_t spent = PerfTotal[sampledFrom[i]] - frameStart[sampledFrom[i]];
+		uint64_t ticks = sampled[i] < spent ? sampled[i] : spent;
+
+		PerfTotal[sampledFrom[i]] -= ticks;
+		PerfTotal[i] += ticks;
+		sampled[i] = 0;
+	}
+
+	slot = history[frames % PERF_WINDOW];
+	for (i = 0; i < PERF_PHASES; i++)
+	{
+		windowTotal[i] -= slot[i];
+		slot[i] = PerfTotal[i] - frameStart[i];
+		windowTotal[i] += slot[i];
+		frameStart[i] = PerfTotal[i];
+	}
+	frames++;
+
+	if (frames % PERF_WINDOW == 0)
+	{
+		uint64_t ticks = PerfNow();
+		int64_t usec = usecNow();
+
+		if (usec > calibrateUsec)
+			ticksPerUsec = (double)(ticks - calibrateTicks) / (double)(usec - calibrateUsec);
+		calibrateTicks = ticks;
+		calibrateUsec = usec;
+	}
+}
+
+double PerfAverage(int phase)
+{
+	unsigned long n = frames < PERF_WINDOW ? frames : PERF_WINDOW;
+
+	if (n == 0 || ticksPerUsec <= 0)
+		return 0;
+	return windowTotal[phase] / ticksPerUsec / n;
+}
+
+double PerfOverall(int phase)
+{
+	if (frames == 0 || ticksPerUsec <= 0)
+		return 0;
+	return PerfTotal[phase] / ticksPerUsec / frames;
+}
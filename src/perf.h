@@ -0,0 +1,79 @@
+#ifndef PERF_H
+#define PERF_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Where the host time goes.  The core marks which part of a frame it is
+// in with PERF_PHASE().  Built with FREEINTV_PERF, the benchmark runner
+// samples that from a profiling timer.
+//
+// The frame budget counters work in every build.  While PerfCounting is
+// set, each PERF_PHASE() charges the ticks since the last one to the phase
+// being left, read from PerfNow (the frontend's perf counter).  Off, it
+// costs a test of PerfCounting.  Switching around the PSG and
+// Intellivoice ticks after every instruction would read the clock
+// millions of times a second, so the markers there are PERF_MARK(), a
+// single store that only exists for the sampler.  The counters time one
+// of those calls in PERF_SAMPLE_EVERY instead and PerfSample() scales it
+// up.
+#include <stdint.h>
+
+enum PerfPhase {
+	PERF_OTHER, // frontend glue, input, overlays
+	PERF_CPU, // CP1610Tick and the exec() loop around it
+	PERF_STIC, // STICDrawFrame
+	PERF_PSG, // PSGTick
+	PERF_IVOICE, // ivoice_tk
+	PERF_MIXER, // MixerFrame and PSGFrame
+	PERF_COMPOSITOR, // render_multi_screen
+	PERF_PHASES
+};
+
+#define PERF_WINDOW 60 // frames PerfAverage() looks back over
+#define PERF_SAMPLE_EVERY 16 // calls per one timed for PerfSample()
+
+extern const char *PerfPhaseNames[PERF_PHASES];
+
+extern int PerfCounting;
+extern uint64_t (*PerfNow)(void);
+extern uint64_t PerfTotal[PERF_PHASES]; // ticks since PerfInit()
+extern uint64_t PerfCalls[PERF_PHASES]; // times each phase was entered
+
+// Starts counting with a tick source and a microsecond clock to scale it
+// by, or stops it if now is NULL
+void PerfInit(uint64_t (*now)(void), int64_t (*usec)(void));
+void PerfSwitch(int phase);
+// Ticks one timed call took, out of PERF_SAMPLE_EVERY made from the
+// current phase.  At the end of the frame the estimate for all of them is
+// moved from that phase to this one.
+void PerfSample(int phase, uint64_t ticks);
+void PerfFrameBegin(void); // the frame starts in PERF_OTHER
+void PerfFrameEnd(void); // time up to the next PerfFrameBegin() isn't counted
+double PerfAverage(int phase); // microseconds per frame over the last PERF_WINDOW frames
+double PerfOverall(int phase); // microseconds per frame since PerfInit()
+
+#ifdef FREEINTV_PERF
+extern volatile int PerfPhase;
+#define PERF_PHASE(p) ((PerfPhase = (p)), PerfCounting ? PerfSwitch(p) : (void)0)
+#define PERF_MARK(p) (PerfPhase = (p))
+#else
+#define PERF_PHASE(p) (PerfCounting ? PerfSwitch(p) : (void)0)
+#define PERF_MARK(p) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,382 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "intv.h"
+#include "memory.h"
+#include "cp1610.h"
+#include "profile.h"
+
+#define PROFILE_DEPTH 64
+#define PROFILE_ROOT 0x10000 // node entries outside the address space
+#define PROFILE_IRQ  0x10001
+
+// Call tree, one node per routine per distinct caller chain
+struct ProfileNode {
+	unsigned int entry;
+	int parent;
+	int child; // first callee, -1 if none
+	int sibling;
+	uint64_t cycles; // spent in the routine itself
+};
+
+struct ProfileFrame {
+	unsigned int ret; // return address, the frame pops when the PC gets there
+	int caller; // node to go back to
+};
+
+struct Profile {
+	uint64_t opCount[0x400];
+	uint64_t opCycles[0x400];
+	uint64_t pcCount[0x10000];
+	uint64_t pcCycles[0x10000];
+	unsigned short pcInstruction[0x10000]; // last opcode run at each address
+	uint64_t taken[0x10000];
+	uint64_t notTaken[0x10000];
+
+	struct ProfileNode *nodes;
+	int nodeCount;
+	int nodeSize;
+	int current;
+	struct ProfileFrame stack[PROFILE_DEPTH];
+	int depth;
+	uint64_t overflows; // calls too deep to track, charged to the caller
+};
+
+// Rows for the report tables
+struct ProfileRow {
+	const char *name;
+	unsigned int key;
+	uint64_t count;
+	uint64_t cycles;
+};
+
+struct Profile *ProfileCreate(void)
+{
+	struct Profile *p = (struct Profile *)calloc(1, sizeof(struct Profile));
+
+	if (p == NULL)
+		return NULL;
+	p->nodeSize = 1024;
+	p->nodes = (struct ProfileNode *)malloc(p->nodeSize * sizeof(struct ProfileNode));
+	if (p->nodes == NULL)
+	{
+		free(p);
+		return NULL;
+	}
+	p->nodes[0].entry = PROFILE_ROOT;
+	p->nodes[0].parent = -1;
+	p->nodes[0].child = -1;
+	p->nodes[0].sibling = -1;
+	p->nodes[0].cycles = 0;
+	p->nodeCount = 1;
+	return p;
+}
+
+void ProfileDestroy(struct Profile *p)
+{
+	if (p == NULL)
+		return;
+	free(p->nodes);
+	free(p);
+}
+
+// The node for entry called from parent, made on first use
+static int callee(struct Profile *p, int parent, unsigned int entry)
+{
+	struct ProfileNode *n;
+	int i;
+
+	for (i = p->nodes[parent].child; i >= 0; i = p->nodes[i].sibling)
+		if (p->nodes[i].entry == entry)
+			return i;
+
+	if (p->nodeCount == p->nodeSize)
+	{
+		struct ProfileNode *grown = (struct ProfileNode *)realloc(p->nodes, 2 * p->nodeSize * sizeof(struct ProfileNode));
+
+		if (grown == NULL)
+			return parent;
+		p->nodes = grown;
+		p->nodeSize *= 2;
+	}
+	i = p->nodeCount++;
+	n = &p->nodes[i];
+	n->entry = entry;
+	n->parent = parent;
+	n->child = -1;
+	n->sibling = p->nodes[parent].child;
+	n->cycles = 0;
+	p->nodes[parent].child = i;
+	return i;
+}
+
+static void call(struct Profile *p, unsigned int ret, unsigned int entry)
+{
+	if (p->depth == PROFILE_DEPTH)
+	{
+		p->overflows++;
+		return;
+	}
+	p->stack[p->depth].ret = ret;
+	p->stack[p->depth].caller = p->current;
+	p->depth++;
+	p->current = callee(p, p->current, entry);
+}
+
+void ProfileInstruction(struct Profile *p, struct Machine *m, unsigned int pc, unsigned int instruction, int ticks)
+{
+	unsigned int next = m->cpu.R[7] & 0xFFFF;
+	int i;
+
+	pc &= 0xFFFF;
+	instruction &= 0x3FF;
+	p->opCount[instruction]++;
+	p->opCycles[instruction] += ticks;
+	p->pcCount[pc]++;
+	p->pcCycles[pc] += ticks;
+	p->pcInstruction[pc] = (unsigned short)instruction;
+	p->nodes[p->current].cycles += ticks;
+
+	if (instruction >= 0x200 && instruction <= 0x23F) // Branch, opcode and offset
+	{
+		if (next != ((pc + 2) & 0xFFFF))
+			p->taken[pc]++;
+		else
+			p->notTaken[pc]++;
+		return;
+	}
+	if (instruction == 0x004 && ((MemoryPeek(m, (pc + 1) & 0xFFFF) >> 8) & 3) != 3) // JSR, JSRE, JSRD
+	{
+		call(p, (pc + 3) & 0xFFFF, next);
+		return;
+	}
+	// anything else that moves the PC may be a return, by MOVR, PULR, JR...
+	if (((next - pc) & 0xFFFF) > 3)
+	{
+		for (i = p->depth - 1; i >= 0; i--)
+		{
+			if (p->stack[i].ret == next)
+			{
+				p->current = p->stack[i].caller;
+				p->depth = i;
+				break;
+			}
+		}
+	}
+}
+
+void ProfileInterrupt(struct Profile *p, unsigned int ret, int ticks)
+{
+	call(p, ret & 0xFFFF, PROFILE_IRQ);
+	p->nodes[p->current].cycles += ticks;
+}
+
+static int byCycles(const void *a, const void *b)
+{
+	const struct ProfileRow *x = (const struct ProfileRow *)a;
+	const struct ProfileRow *y = (const struct ProfileRow *)b;
+
+	if (x->cycles != y->cycles)
+		return x->cycles < y->cycles ? 1 : -1;
+	return x->key < y->key ? -1 : x->key > y->key;
+}
+
+static int byCount(const void *a, const void *b)
+{
+	const struct ProfileRow *x = (const struct ProfileRow *)a;
+	const struct ProfileRow *y = (const struct ProfileRow *)b;
+
+	if (x->count != y->count)
+		return x->count < y->count ? 1 : -1;
+	return x->key < y->key ? -1 : x->key > y->key;
+}
+
+static const char *mnemonic(unsigned int instruction)
+{
+	return Nmemonic[instruction & 0x3FF] ? Nmemonic[instruction & 0x3FF] : "???";
+}
+
+static const char *routineName(unsigned int entry, char *buf, size_t size)
+{
+	if (entry == PROFILE_ROOT)
+		return "intv";
+	if (entry == PROFILE_IRQ)
+		return "irq";
+	snprintf(buf, size, "$%04X", entry);
+	return buf;
+}
+
+void ProfileReport(struct Profile *p, FILE *fp, int top)
+{
+	struct ProfileRow *rows = (struct ProfileRow *)malloc(0x10002 * sizeof(struct ProfileRow));
+	uint64_t total = 0, instructions = 0;
+	char name[16];
+	int i, j, n;
+
+	if (rows == NULL)
+		return;
+	for (i = 0; i < 0x400; i++)
+	{
+		total += p->opCycles[i];
+		instructions += p->opCount[i];
+	}
+	if (total == 0)
+	{
+		fprintf(fp, "no instructions profiled\n");
+		free(rows);
+		return;
+	}
+	fprintf(fp, "%llu instructions, %llu cycles\n", (unsigned long long)instructions, (unsigned long long)total);
+
+	// opcode classes, one row per Nmemonic[] name
+	n = 0;
+	for (i = 0; i < 0x400; i++)
+	{
+		if (p->opCount[i] == 0)
+			continue;
+		for (j = 0; j < n; j++)
+			if (strcmp(rows[j].name, mnemonic(i)) == 0)
+				break;
+		if (j == n)
+		{
+			rows[n].name = mnemonic(i);
+			rows[n].key = i;
+			rows[n].count = 0;
+			rows[n].cycles = 0;
+			n++;
+		}
+		rows[j].count += p->opCount[i];
+		rows[j].cycles += p->opCycles[i];
+	}
+	qsort(rows, n, sizeof(rows[0]), byCycles);
+	fprintf(fp, "\n%-8s %12s %14s %7s\n", "opcode", "count", "cycles", "share");
+	for (i = 0; i < n && i < top; i++)
+		fprintf(fp, "%-8s %12llu %14llu %6.2f%%\n", rows[i].name, (unsigned long long)rows[i].count,
+			(unsigned long long)rows[i].cycles, 100.0 * rows[i].cycles / total);
+
+	// hot addresses
+	n = 0;
+	for (i = 0; i < 0x10000; i++)
+	{
+		if (p->pcCount[i] == 0)
+			continue;
+		rows[n].name = mnemonic(p->pcInstruction[i]);
+		rows[n].key = i;
+		rows[n].count = p->pcCount[i];
+		rows[n].cycles = p->pcCycles[i];
+		n++;
+	}
+	qsort(rows, n, sizeof(rows[0]), byCycles);
+	fprintf(fp, "\n%-6s %-8s %12s %14s %7s\n", "pc", "opcode", "count", "cycles", "share");
+	for (i = 0; i < n && i < top; i++)
+		fprintf(fp, "$%04X  %-8s %12llu %14llu %6.2f%%\n", rows[i].key, rows[i].name, (unsigned long long)rows[i].count,
+			(unsigned long long)rows[i].cycles, 100.0 * rows[i].cycles / total);
+
+	// routines, self cycles over every caller chain
+	n = 0;
+	for (i = 0; i < p->nodeCount; i++)
+	{
+		for (j = 0; j < n; j++)
+			if (rows[j].key == p->nodes[i].entry)
+				break;
+		if (j == n)
+		{
+			rows[n].name = NULL;
+			rows[n].key = p->nodes[i].entry;
+			rows[n].count = 0;
+			rows[n].cycles = 0;
+			n++;
+		}
+		rows[j].cycles += p->nodes[i].cycles;
+	}
+	qsort(rows, n, sizeof(rows[0]), byCycles);
+	fprintf(fp, "\n%-8s %14s %7s\n", "routine", "self cycles", "share");
+	for (i = 0; i < n && i < top; i++)
+		fprintf(fp, "%-8s %14llu %6.2f%%\n", routineName(rows[i].key, name, sizeof(name)),
+			(unsigned long long)rows[i].cycles, 100.0 * rows[i].cycles / total);
+	if (p->overflows)
+		fprintf(fp, "%llu calls deeper than %d frames were charged to their caller\n",
+			(unsigned long long)p->overflows, PROFILE_DEPTH);
+
+	// branches
+	n = 0;
+	for (i = 0; i < 0x10000; i++)
+	{
+		if (p->taken[i] + p->notTaken[i] == 0)
+			continue;
+		rows[n].name = NULL;
+		rows[n].key = i;
+		rows[n].count = p->taken[i] + p->notTaken[i];
+		rows[n].cycles = p->taken[i];
+		n++;
+	}
+	qsort(rows, n, sizeof(rows[0]), byCount);
+	fprintf(fp, "\n%-6s %12s %7s\n", "branch", "count", "taken");
+	for (i = 0; i < n && i < top; i++)
+		fprintf(fp, "$%04X  %12llu %6.2f%%\n", rows[i].key, (unsigned long long)rows[i].count,
+			100.0 * rows[i].cycles / rows[i].count);
+
+	free(rows);
+}
+
+int ProfileWriteFlat(struct Profile *p, const char *path)
+{
+	FILE *fp = fopen(path, "w");
+	int i;
+
+	if (fp == NULL)
+		return 0;
+	for (i = 0; i < 0x10000; i++)
+	{
+		const char *name = mnemonic(p->pcInstruction[i]);
+
+		if (p->pcCount[i] == 0)
+			continue;
+		fprintf(fp, "%04X %llu %llu %.*s", i, (unsigned long long)p->pcCount[i],
+			(unsigned long long)p->pcCycles[i], (int)strcspn(name, " "), name);
+		if (p->taken[i] + p->notTaken[i])
+			fprintf(fp, " taken %llu not %llu", (unsigned long long)p->taken[i], (unsigned long long)p->notTaken[i]);
+		fprintf(fp, "\n");
+	}
+	return fclose(fp) == 0;
+}
+
+int ProfileWriteFolded(struct Profile *p, const char *path)
+{
+	FILE *fp = fopen(path, "w");
+	int chain[PROFILE_DEPTH + 1];
+	char name[16];
+	int i, j, n;
+
+	if (fp == NULL)
+		return 0;
+	for (i = 0; i < p->nodeCount; i++)
+	{
+		if (p->nodes[i].cycles == 0)
+			continue;
+		n = 0;
+		for (j = i; j >= 0 && n <= PROFILE_DEPTH; j = p->nodes[j].parent)
+			chain[n++] = j;
+		while (n--)
+			fprintf(fp, "%s%c", routineName(p->nodes[chain[n]].entry, name, sizeof(name)), n ? ';' : ' ');
+		fprintf(fp, "%llu\n", (unsigned long long)p->nodes[i].cycles);
+	}
+	return fclose(fp) == 0;
+}
@@ -0,0 +1,59 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdio.h>
+
+// Guest CPU profiler: executions and cycles per opcode class and per PC,
+// taken/not taken counts per branch, and cycles per guest call stack.
+// Calls are JSRs and interrupts; a frame is popped when the PC lands on
+// its return address, however the routine got there.
+//
+// Built with FREEINTV_PROFILE, CP1610Tick reports every instruction to
+// the machine's profile, if it has one.  Without it the hooks compile to
+// nothing.
+
+struct Machine;
+struct Profile;
+
+struct Profile *ProfileCreate(void); // NULL if out of memory
+void ProfileDestroy(struct Profile *p);
+
+// pc and instruction as fetched, ticks used, after the instruction ran
+void ProfileInstruction(struct Profile *p, struct Machine *m, unsigned int pc, unsigned int instruction, int ticks);
+void ProfileInterrupt(struct Profile *p, unsigned int ret, int ticks); // ret is the address pushed
+
+void ProfileReport(struct Profile *p, FILE *fp, int top); // summary tables, top rows of each
+int ProfileWriteFlat(struct Profile *p, const char *path); // "pc count cycles mnemonic" lines, 0 on error
+int ProfileWriteFolded(struct Profile *p, const char *path); // folded stacks for flamegraph.pl, 0 on error
+
+#ifdef FREEINTV_PROFILE
+#define PROFILE_INSTRUCTION(m, pc, instruction, ticks) do { \
+		if ((m)->profile) \
+			ProfileInstruction((m)->profile, (m), (pc), (instruction), (ticks)); \
+	} while (0)
+#define PROFILE_INTERRUPT(m, ret, ticks) do { \
+		if ((m)->profile) \
+			ProfileInterrupt((m)->profile, (ret), (ticks)); \
+	} while (0)
+#else
+#define PROFILE_INSTRUCTION(m, pc, instruction, ticks) ((void)0)
+#define PROFILE_INTERRUPT(m, ret, ticks) ((void)0)
+#endif
+
+#endif
@@ -19,174 +19,142 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include "intv.h"
 #include "psg.h"
 #include "memory.h"
+#include "state.h"
 
 int Volume[16] = { 0, 92, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192, 10922 };
 
 int Envelope_Shift[4] = {8, 2, 1, 0};
 
 // Volume levels assigned to each channel from PSG registers
-#define VolA    (Memory[0x01FB] & 0x0F)
-#define VolB    (Memory[0x01FC] & 0x0F)
-#define VolC    (Memory[0x01FD] & 0x0F)
+#define VolA    (MemoryPeek(m, 0x01FB) & 0x0F)
+#define VolB    (MemoryPeek(m, 0x01FC) & 0x0F)
+#define VolC    (MemoryPeek(m, 0x01FD) & 0x0F)
 
 // Envelope shifts for channels (6-bit variations only)
-#define EnvA    ((Memory[0x01FB] >> 4) & 0x03)
-#define EnvB    ((Memory[0x01FC] >> 4) & 0x03)
-#define EnvC    ((Memory[0x01FD] >> 4) & 0x03)
-
-int NoiseP; // Noise Period
+#define EnvA    ((MemoryPeek(m, 0x01FB) >> 4) & 0x03)
+#define EnvB    ((MemoryPeek(m, 0x01FC) >> 4) & 0x03)
+#define EnvC    ((MemoryPeek(m, 0x01FD) >> 4) & 0x03)
 
 // Detect Tone enabled for this channel (0- enabled, 1- disabled)
-#define ToneA   ((Memory[0x01F8] & 0x01) != 0)
-#define ToneB   ((Memory[0x01F8] & 0x02) != 0)
-#define ToneC   ((Memory[0x01F8] & 0x04) != 0)
+#define ToneA   ((MemoryPeek(m, 0x01F8) & 0x01) != 0)
+#define ToneB   ((MemoryPeek(m, 0x01F8) & 0x02) != 0)
+#define ToneC   ((MemoryPeek(m, 0x01F8) & 0x04) != 0)
            
 // Detect Noise enabled for this channel (0- enabled, 1- disabled)
-#define NoiseA  ((Memory[0x01F8] & 0x08) != 0)
-#define NoiseB  ((Memory[0x01F8] & 0x10) != 0)
-#define NoiseC  ((Memory[0x01F8] & 0x20) != 0)
+#define NoiseA  ((MemoryPeek(m, 0x01F8) & 0x08) != 0)
+#define NoiseB  ((MemoryPeek(m, 0x01F8) & 0x10) != 0)
+#define NoiseC  ((MemoryPeek(m, 0x01F8) & 0x20) != 0)
 
 // Envelope type
-#define EnvFlags    (Memory[0x01FA] & 0x0F)
-
-int PSGBufferSize;
-int16_t PSGBuffer[7467];
-int PSGBufferPos;
-
-int Ticks; // CPU cycles not yet processed
-
-int CountA; // countdowns for tone generators
-int CountB; // used to modulate square-wave
-int CountC; // according to Channel Period
-int CountN; // countdown for noise generator
-int CountE; // countdown for envelope generator
-
-int OutA; // outputs for each tone generator
-int OutB;
-int OutC;
-int OutN;  // Noise generator output
-int OutE;  // Envelope generator output
-
-int ChA; // Channel Period from PSG Registers
-int ChB;
-int ChC;
+#define EnvFlags    (MemoryPeek(m, 0x01FA) & 0x0F)
 
-int EnvP;    // Envelope Period
-int StepE; // 1, 0, -1 -- Direction to Step Envelope at end of countdown
-
-int EnvContinue; // Flags from Envelope Type
-int EnvAttack;
-int EnvAlternate;
-int EnvHold;
-
-void PSGSerialize(struct PSGserialized *all)
+void PSGSerialize(struct Machine *m, struct StateBuffer *state)
 {
-    all->PSGBufferSize = PSGBufferSize;
-    memcpy(all->PSGBuffer, PSGBuffer, sizeof(PSGBuffer));
-    all->PSGBufferPos = PSGBufferPos;
-    all->Ticks = Ticks;
-    all->CountA = CountA;
-    all->CountB = CountB;
-    all->CountC = CountC;
-    all->CountN = CountN;
-    all->CountE = CountE;
-    all->OutA = OutA;
-    all->OutB = OutB;
-    all->OutC = OutC;
-    all->OutN = OutN;
-    all->OutE = OutE;
-    all->ChA = ChA;
-    all->ChB = ChB;
-    all->ChC = ChC;
-    all->NoiseP = NoiseP;
-    all->EnvP = EnvP;
-    all->StepE = StepE;
-    all->EnvContinue = EnvContinue;
-    all->EnvAttack = EnvAttack;
-    all->EnvAlternate = EnvAlternate;
-    all->EnvHold = EnvHold;
+    size_t mark = StateChunkBegin(state, "PSG ");
+
+    StatePutInt(state, m->psg.Ticks);
+    StatePutInt(state, m->psg.CountA);
+    StatePutInt(state, m->psg.CountB);
+    StatePutInt(state, m->psg.CountC);
+    StatePutInt(state, m->psg.CountN);
+    StatePutInt(state, m->psg.CountE);
+    StatePutInt(state, m->psg.OutA);
+    StatePutInt(state, m->psg.OutB);
+    StatePutInt(state, m->psg.OutC);
+    StatePutInt(state, m->psg.OutN);
+    StatePutInt(state, m->psg.OutE);
+    StatePutInt(state, m->psg.ChA);
+    StatePutInt(state, m->psg.ChB);
+    StatePutInt(state, m->psg.ChC);
+    StatePutInt(state, m->psg.NoiseP);
+    StatePutInt(state, m->psg.EnvP);
+    StatePutInt(state, m->psg.StepE);
+    StatePutInt(state, m->psg.EnvContinue);
+    StatePutInt(state, m->psg.EnvAttack);
+    StatePutInt(state, m->psg.EnvAlternate);
+    StatePutInt(state, m->psg.EnvHold);
+    StateChunkEnd(state, mark);
 }
 
-void PSGUnserialize(const struct PSGserialized *all)
+void PSGUnserialize(struct Machine *m, struct StateBuffer *state)
 {
-    PSGBufferSize = all->PSGBufferSize;
-    memcpy(PSGBuffer, all->PSGBuffer, sizeof(PSGBuffer));
-    PSGBufferPos = all->PSGBufferPos;
-    Ticks = all->Ticks;
-    CountA = all->CountA;
-    CountB = all->CountB;
-    CountC = all->CountC;
-    CountN = all->CountN;
-    CountE = all->CountE;
-    OutA = all->OutA;
-    OutB = all->OutB;
-    OutC = all->OutC;
-    OutN = all->OutN;
-    OutE = all->OutE;
-    ChA = all->ChA;
-    ChB = all->ChB;
-    ChC = all->ChC;
-    NoiseP = all->NoiseP;
-    EnvP = all->EnvP;
-    StepE = all->StepE;
-    EnvContinue = all->EnvContinue;
-    EnvAttack = all->EnvAttack;
-    EnvAlternate = all->EnvAlternate;
-    EnvHold = all->EnvHold;
+    if (!StateChunkOpen(state, "PSG "))
+        return;
+    m->psg.BufferPos = 0;
+    m->psg.Ticks = StateGetInt(state);
+    m->psg.CountA = StateGetInt(state);
+    m->psg.CountB = StateGetInt(state);
+    m->psg.CountC = StateGetInt(state);
+    m->psg.CountN = StateGetInt(state);
+    m->psg.CountE = StateGetInt(state);
+    m->psg.OutA = StateGetInt(state);
+    m->psg.OutB = StateGetInt(state);
+    m->psg.OutC = StateGetInt(state);
+    m->psg.OutN = StateGetInt(state);
+    m->psg.OutE = StateGetInt(state);
+    m->psg.ChA = StateGetInt(state);
+    m->psg.ChB = StateGetInt(state);
+    m->psg.ChC = StateGetInt(state);
+    m->psg.NoiseP = StateGetInt(state);
+    m->psg.EnvP = StateGetInt(state);
+    m->psg.StepE = StateGetInt(state);
+    m->psg.EnvContinue = StateGetInt(state);
+    m->psg.EnvAttack = StateGetInt(state);
+    m->psg.EnvAlternate = StateGetInt(state);
+    m->psg.EnvHold = StateGetInt(state);
 }
 
-void readRegisters(void)
+void readRegisters(struct Machine *m)
 {
-	ChA = (Memory[0x01F0] & 0xFF) | ((Memory[0x1F4] & 0x0F)<<8);
-	ChB = (Memory[0x01F1] & 0xFF) | ((Memory[0x1F5] & 0x0F)<<8);
-	ChC = (Memory[0x01F2] & 0xFF) | ((Memory[0x1F6] & 0x0F)<<8);
+	m->psg.ChA = (MemoryPeek(m, 0x01F0) & 0xFF) | ((MemoryPeek(m, 0x1F4) & 0x0F)<<8);
+	m->psg.ChB = (MemoryPeek(m, 0x01F1) & 0xFF) | ((MemoryPeek(m, 0x1F5) & 0x0F)<<8);
+	m->psg.ChC = (MemoryPeek(m, 0x01F2) & 0xFF) | ((MemoryPeek(m, 0x1F6) & 0x0F)<<8);
  
-    ChA = ChA + (0x1000 * (ChA==0)); // a Channel Period value of 0
-    ChB = ChB + (0x1000 * (ChB==0)); // indicates a value of 0x1000
-    ChC = ChC + (0x1000 * (ChC==0));
+    m->psg.ChA = m->psg.ChA + (0x1000 * (m->psg.ChA==0)); // a Channel Period value of 0
+    m->psg.ChB = m->psg.ChB + (0x1000 * (m->psg.ChB==0)); // indicates a value of 0x1000
+    m->psg.ChC = m->psg.ChC + (0x1000 * (m->psg.ChC==0));
 
-    NoiseP = (Memory[0x01F9] & 0x1F)<<1;
+    m->psg.NoiseP = (MemoryPeek(m, 0x01F9) & 0x1F)<<1;
 
     // a Noise Period of 0 indicates a period of 0x40
-    NoiseP = NoiseP + (0x40 * (NoiseP==0));
+    m->psg.NoiseP = m->psg.NoiseP + (0x40 * (m->psg.NoiseP==0));
 
-    EnvP = ((Memory[0x01F3] & 0xFF) | ((Memory[0x1F7] & 0xFF)<<8))<<1;
+    m->psg.EnvP = ((MemoryPeek(m, 0x01F3) & 0xFF) | ((MemoryPeek(m, 0x1F7) & 0xFF)<<8))<<1;
 
     // an Envelope Period of 0 indicates a period of 0x20000
-    EnvP = EnvP + (0x20000 * (EnvP==0));
+    m->psg.EnvP = m->psg.EnvP + (0x20000 * (m->psg.EnvP==0));
 
 	// Envelope Flags
-	EnvContinue = (EnvFlags>>3) & 0x01;
-	EnvAttack = (EnvFlags>>2) & 0x01;
-	EnvAlternate = (EnvFlags>>1) & 0x01;
-	EnvHold = EnvFlags & 0x01;
+	m->psg.EnvContinue = (EnvFlags>>3) & 0x01;
+	m->psg.EnvAttack = (EnvFlags>>2) & 0x01;
+	m->psg.EnvAlternate = (EnvFlags>>1) & 0x01;
+	m->psg.EnvHold = EnvFlags & 0x01;
 }
 
-void PSGInit()
+void PSGInit(struct Machine *m)
 {
-	PSGBufferSize = 7467; // set in psg.h
-
-	OutA = 0; // tone generator outputs
-	OutB = 0;
-	OutC = 0;
-	OutN = 0x10004; // noise output
-	OutE = 0; // envelope output
-	CountA = 0; // tone generator countdowns
-	CountB = 0;
-	CountC = 0;
-	CountN = 0; // noise generator countdown
-	CountE = 0; // envelope countdown
-	readRegisters();
+	m->psg.OutA = 0; // tone generator outputs
+	m->psg.OutB = 0;
+	m->psg.OutC = 0;
+	m->psg.OutN = 0x10004; // noise output
+	m->psg.OutE = 0; // envelope output
+	m->psg.CountA = 0; // tone generator countdowns
+	m->psg.CountB = 0;
+	m->psg.CountC = 0;
+	m->psg.CountN = 0; // noise generator countdown
+	m->psg.CountE = 0; // envelope countdown
+	readRegisters(m);
 }
 
-void PSGFrame()
+void PSGFrame(struct Machine *m)
 {
-	PSGBufferPos = 0;
+	m->psg.BufferPos = 0;
  #if 0  // Debugging
     {
-        fprintf(stderr, "%04x %04x %04x %02x %02x %02x\n", ChA, ChB, ChC, VolA, VolB, VolC);
+        fprintf(stderr, "%04x %04x %04x %02x %02x %02x\n", m->psg.ChA, m->psg.ChB, m->psg.ChC, VolA, VolB, VolC);
     }
  #endif
 }
@@ -198,92 +166,92 @@ int psg_masks[16] = {
     0x3f, 0x3f, 0xff, 0xff,
 };
 
-void PSGNotify(int adr, int val) // PSG Registers Modified 0x01F0-0x1FD (called from writeMem)
+void PSGNotify(struct Machine *m, int adr, int val) // PSG Registers Modified 0x01F0-0x1FD (called from writeMem)
 {
-    Memory[adr] &= psg_masks[adr - 0x1f0];
-	readRegisters();
+    MemoryPoke(m, adr) &= psg_masks[adr - 0x1f0];
+	readRegisters(m);
     // Note: updating frequencies doesn't reset counters in real chip
     //       (otherwise sound glitch happens in games)
 
 	// Envelope properties Trigger (write only register)
 	if (adr==0x1FA)  
 	{ 
-		CountE = EnvP;
-		StepE = 0;
+		m->psg.CountE = m->psg.EnvP;
+		m->psg.StepE = 0;
 
-		if (EnvAttack) // attack __/|/|/|___
+		if (m->psg.EnvAttack) // attack __/|/|/|___
 		{
-			OutE = 0;
-			StepE = 1;
+			m->psg.OutE = 0;
+			m->psg.StepE = 1;
 		}
 		else
 		{
-			OutE = 15;
-			StepE = -1;
+			m->psg.OutE = 15;
+			m->psg.StepE = -1;
 		}
 	}
 }
 
-void PSGTick(int ticks) // adds 1 sound sample per 4 cpu cycles to the buffer
+void PSGTick(struct Machine *m, int ticks) // adds 1 sound sample per 4 cpu cycles to the buffer
 {
 	int16_t sample;
 	int a, b, c;
 
-	Ticks = Ticks + ticks;
+	m->psg.Ticks = m->psg.Ticks + ticks;
 
-	while(Ticks >= 4)
+	while(m->psg.Ticks >= 4)
 	{
-		Ticks -= 4;
+		m->psg.Ticks -= 4;
 
-		CountA--;
-		CountB--;
-		CountC--;
-		CountN--;
-		CountE--;
+		m->psg.CountA--;
+		m->psg.CountB--;
+		m->psg.CountC--;
+		m->psg.CountN--;
+		m->psg.CountE--;
 
 		/* ************** Generate Sample ************** */
 
-		OutA = OutA ^ (CountA<=0); // Tone Generators
-		OutB = OutB ^ (CountB<=0); 
-		OutC = OutC ^ (CountC<=0); 
+		m->psg.OutA = m->psg.OutA ^ (m->psg.CountA<=0); // Tone Generators
+		m->psg.OutB = m->psg.OutB ^ (m->psg.CountB<=0); 
+		m->psg.OutC = m->psg.OutC ^ (m->psg.CountC<=0); 
 
 		// http://spatula-city.org/~im14u2c/intv/jzintv-1.0-beta3/doc/programming/psg.txt
-		if(CountE==0) // Envelope Generator 
+		if(m->psg.CountE==0) // Envelope Generator 
 		{
-			CountE = EnvP; // reset countdown
-			OutE = OutE + StepE; // step up, step down, or hold
+			m->psg.CountE = m->psg.EnvP; // reset countdown
+			m->psg.OutE = m->psg.OutE + m->psg.StepE; // step up, step down, or hold
 
-			if(StepE != 0 && (OutE>15 || OutE<0)) // we've reached the top or bottom
+			if(m->psg.StepE != 0 && (m->psg.OutE>15 || m->psg.OutE<0)) // we've reached the top or bottom
 			{
-				if(EnvHold)
+				if(m->psg.EnvHold)
 				{ 
-					StepE = 0; // stop changing (hold volume)
-					if(EnvAlternate) // alternate & hold  1011 1111
+					m->psg.StepE = 0; // stop changing (hold volume)
+					if(m->psg.EnvAlternate) // alternate & hold  1011 1111
 					{
-						OutE = 15 * (EnvAttack==0);
+						m->psg.OutE = 15 * (m->psg.EnvAttack==0);
 					}
 					else // hold at 0 (1001) or 15 (1101) 
 					{
-						OutE = 15 * (EnvAttack==1);
+						m->psg.OutE = 15 * (m->psg.EnvAttack==1);
 					}
 				}
 				else
 				{
-					if(EnvAlternate) // triange waves__/\/\/\__ 1010  \/\/\/\___ 1110
+					if(m->psg.EnvAlternate) // triange waves__/\/\/\__ 1010  \/\/\/\___ 1110
 					{
-						StepE = StepE * -1;    // Swap step direction
-						OutE = (OutE + StepE) & 0x0F;
+						m->psg.StepE = m->psg.StepE * -1;    // Swap step direction
+						m->psg.OutE = (m->psg.OutE + m->psg.StepE) & 0x0F;
 					}
 					else // saw-tooth waves __|\|\|\__ 1000 ___/|/|/|___ 1100
 					{
-						OutE = 15 * (EnvAttack==0);
+						m->psg.OutE = 15 * (m->psg.EnvAttack==0);
 					}
 				}
 				// Anything without continue flag set holds at 0
-				if(EnvContinue==0)
+				if(m->psg.EnvContinue==0)
 				{
-					OutE = 0;
-					StepE = 0;
+					m->psg.OutE = 0;
+					m->psg.StepE = 0;
 				}
 			}
 		}
@@ -292,34 +260,37 @@ void PSGTick(int ticks) // adds 1 sound sample per 4 cpu cycles to the buffer
 		// noise = (noise >> 1) ^ ((noise & 1) ? 0x14000 : 0);
         // The wiki is wrong as MAME says the LFSR noise is
         // bit 0 + bit 3 so the correct mask is 0x10004
-		if(CountN<=0)
+		if(m->psg.CountN<=0)
 		{
-			CountN = NoiseP;
-			OutN = (OutN >> 1) ^ ((OutN & 1) * 0x10004); // Noise Generator
+			m->psg.CountN = m->psg.NoiseP;
+			m->psg.OutN = (m->psg.OutN >> 1) ^ ((m->psg.OutN & 1) * 0x10004); // Noise Generator
 		}
 
+		m->psg.CountA += m->psg.ChA * (m->psg.CountA<=0); // reset countdowns when they reach 0 
+		m->psg.CountB += m->psg.ChB * (m->psg.CountB<=0);
+		m->psg.CountC += m->psg.ChC * (m->psg.CountC<=0);
+
+		if (m->psg.Hidden)
+			continue;
+
 		// http://wiki.intellivision.us/index.php?title=PSG
 		// channel_output = (noise_enable OR noise_generator_output) AND (tone_enable OR tone_generator_output)
-		a = (NoiseA | (OutN & 1)) & (ToneA | OutA); // Generate Sample for each channel
-		b = (NoiseB | (OutN & 1)) & (ToneB | OutB);
-		c = (NoiseC | (OutN & 1)) & (ToneC | OutC);
+		a = (NoiseA | (m->psg.OutN & 1)) & (ToneA | m->psg.OutA); // Generate Sample for each channel
+		b = (NoiseB | (m->psg.OutN & 1)) & (ToneB | m->psg.OutB);
+		c = (NoiseC | (m->psg.OutN & 1)) & (ToneC | m->psg.OutC);
 
 		// Adjust amplitude (Volume / Envelope)
-		a = a * ( (Volume[VolA] * (EnvA==0)) | (Volume[OutE >> Envelope_Shift[EnvA]]) );
-		b = b * ( (Volume[VolB] * (EnvB==0)) | (Volume[OutE >> Envelope_Shift[EnvB]]) );
-		c = c * ( (Volume[VolC] * (EnvC==0)) | (Volume[OutE >> Envelope_Shift[EnvC]]) );
+		a = a * ( (Volume[VolA] * (EnvA==0)) | (Volume[m->psg.OutE >> Envelope_Shift[EnvA]]) );
+		b = b * ( (Volume[VolB] * (EnvB==0)) | (Volume[m->psg.OutE >> Envelope_Shift[EnvB]]) );
+		c = c * ( (Volume[VolC] * (EnvC==0)) | (Volume[m->psg.OutE >> Envelope_Shift[EnvC]]) );
 
 		sample = a + b + c;
 
 		/* ********************************************* */
 
-		CountA += ChA * (CountA<=0); // reset countdowns when they reach 0 
-		CountB += ChB * (CountB<=0);
-		CountC += ChC * (CountC<=0);
-
-		PSGBuffer[PSGBufferPos] = sample; // write sample to buffer
+		m->psg.Buffer[m->psg.BufferPos] = sample; // write sample to buffer
 		
-		PSGBufferPos++;
-		PSGBufferPos = PSGBufferPos * (PSGBufferPos < 7467); // wrap to beginning
+		m->psg.BufferPos++;
+		m->psg.BufferPos = m->psg.BufferPos * (m->psg.BufferPos < 7467); // wrap to beginning
 	}
 }
@@ -19,52 +19,52 @@
 */
 #include <stdint.h>
 
-// Circular Buffer holds up to two frames:
-extern int16_t PSGBuffer[7467]; // 14934 cpu cycles/frame ; 3733.5 psg cycles/frame
-extern int PSGBufferPos; // points to next location in output buffer
-extern int PSGBufferSize;
+struct PSG {
+	int Ticks; // CPU cycles not yet processed
 
-struct PSGserialized {
-    int PSGBufferSize;
-    int16_t PSGBuffer[7467];
-    int PSGBufferPos;
-    
-    int Ticks; // CPU cycles not yet processed
-    
-    int CountA; // countdowns for tone generators
-    int CountB; // used to modulate square-wave
-    int CountC; // according to Channel Period
-    int CountN; // countdown for noise generator
-    int CountE; // countdown for envelope generator
-    
-    int OutA; // outputs for each tone generator
-    int OutB;
-    int OutC;
-    int OutN;  // Noise generator output
-    int OutE;  // Envelope generator output
-    
-    int ChA; // Channel Period from PSG Registers
-    int ChB;
-    int ChC;
-    
-    int NoiseP; // Noise Period
-    
-    int EnvP;    // Envelope Period
-    int StepE; // 1, 0, -1 -- Direction to Step Envelope at end of countdown
-    
-    int EnvContinue; // Flags from Envelope Type
-    int EnvAttack;
-    int EnvAlternate;
-    int EnvHold;
+	int CountA; // countdowns for tone generators
+	int CountB; // used to modulate square-wave
+	int CountC; // according to Channel Period
+	int CountN; // countdown for noise generator
+	int CountE; // countdown for envelope generator
+
+	int OutA; // outputs for each tone generator
+	int OutB;
+	int OutC;
+	int OutN;  // Noise generator output
+	int OutE;  // Envelope generator output
+
+	int ChA; // Channel Period from PSG Registers
+	int ChB;
+	int ChC;
+
+	int NoiseP; // Noise Period
+	int EnvP;    // Envelope Period
+	int StepE; // 1, 0, -1 -- Direction to Step Envelope at end of countdown
+
+	int EnvContinue; // Flags from Envelope Type
+	int EnvAttack;
+	int EnvAlternate;
+	int EnvHold;
+
+	// Circular Buffer holds up to two frames:
+	int16_t Buffer[7467]; // 14934 cpu cycles/frame ; 3733.5 psg cycles/frame
+	int BufferPos; // points to next location in output buffer
+	int Hidden; // frame won't be heard, advance the generators but write no samples
 };
 
-void PSGSerialize(struct PSGserialized *);
-void PSGUnserialize(const struct PSGserialized *);
+struct StateBuffer;
+struct Machine;
+
+// Writes the "PSG " chunk.  States are taken between frames, after the
+// mixer has drained the buffer, so the buffer itself isn't saved.
+void PSGSerialize(struct Machine *m, struct StateBuffer *);
+void PSGUnserialize(struct Machine *m, struct StateBuffer *);
 
-void PSGInit(void); 
-void PSGFrame(void); // Notify New Frame
-void PSGTick(int ticks); // ticks PSG some number of cpu cycles 
-void PSGNotify(int adr, int val); // updates PSG on register change
+void PSGInit(struct Machine *m); 
+void PSGFrame(struct Machine *m); // Notify New Frame
+void PSGTick(struct Machine *m, int ticks); // ticks PSG some number of cpu cycles 
+void PSGNotify(struct Machine *m, int adr, int val); // updates PSG on register change
 
 
 #endif
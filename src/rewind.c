@@ -0,0 +1,338 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "rewind.h"
+#include "intv.h"
+#include "memory.h"
+#include "stic.h"
+#include "state.h"
+
+// The newest snapshot is kept whole: the machine chunks in machine[] and
+// the address space in shadow[].  The ring holds one record per snapshot, the XOR
+// of it with the snapshot before, so stepping back XORs the newest record
+// out and the oldest records can be dropped whenever the budget runs out.
+// Only memory blocks flagged MEMORY_DIRTY_REWIND are compared.
+//
+// A record, deltas run-length coded by encodeDelta():
+//   u32  record size
+//   u8   flags
+//   ...  machine delta (every chunk but "MEM ")
+//   u16  changed block count, then per block: u16 block number, delta
+//   u32  record size, so the newest record can be found from the head
+
+#define MACHINE_MAX 2048
+#define BLOCK_BYTES (MEMORY_BLOCK_SIZE * 2)
+#define RECORD_MAX (16 + MACHINE_MAX + 8 + MEMORY_BLOCKS * (2 + BLOCK_BYTES + 8))
+
+#define REWIND_BASE 0x01 // delta against nothing, can't step back past it
+
+static uint8_t *ring;
+static size_t ringSize; // power of two
+static size_t ringHead; // byte counters, head - tail bytes in use
+static size_t ringTail;
+static int records;
+
+static int interval = 1;
+static int frames; // frames run since the newest snapshot
+static int started; // there is a newest snapshot
+
+static uint8_t machine[MACHINE_MAX];
+static size_t machineSize;
+static uint16_t shadow[0x10000];
+static uint8_t *record; // assembles a record before it goes in the ring
+
+static void put16(uint8_t *p, size_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, size_t v)
+{
+	put16(p, v);
+	put16(p + 2, v >> 16);
+}
+
+static size_t get16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static size_t get32(const uint8_t *p)
+{
+	return get16(p) | (get16(p + 2) << 16);
+}
+
+// Codes x as (u16 zero count, u16 literal count, literals) pairs.  A
+// literal only ends at four or more zeros, so the output never grows by
+// more than the first pair.
+static size_t encodeDelta(uint8_t *out, const uint8_t *x, size_t len)
+{
+	size_t i = 0, o = 0, zero, lit, j, k;
+
+	while (i < len)
+	{
+		zero = 0;
+		while (i + zero < len && x[i + zero] == 0 && zero < 0xFFFF)
+			zero++;
+		lit = 0;
+		while (i + zero + lit < len && lit < 0xFFFF)
+		{
+			j = i + zero + lit;
+			for (k = 0; k < 4 && j + k < len && x[j + k] == 0; k++) { }
+			if (k == 4 || (k > 0 && j + k == len))
+				break;
+			lit++;
+		}
+		put16(out + o, zero);
+		put16(out + o + 2, lit);
+		memcpy(out + o + 4, x + i + zero, lit);
+		o += 4 + lit;
+		i += zero + lit;
+	}
+	return o;
+}
+
+// XORs a coded delta into x, returns the bytes read
+static size_t decodeDelta(const uint8_t *in, uint8_t *x, size_t len)
+{
+	size_t i = 0, o = 0, lit, k;
+
+	while (i < len)
+	{
+		i += get16(in + o);
+		lit = get16(in + o + 2);
+		o += 4;
+		for (k = 0; k < lit && i < len; k++)
+			x[i++] ^= in[o + k];
+		o += lit;
+	}
+	return o;
+}
+
+static void ringWrite(size_t at, const uint8_t *src, size_t len)
+{
+	size_t pos = at & (ringSize - 1);
+	size_t first = ringSize - pos < len ? ringSize - pos : len;
+
+	memcpy(ring + pos, src, first);
+	memcpy(ring, src + first, len - first);
+}
+
+static void ringRead(size_t at, uint8_t *dst, size_t len)
+{
+	size_t pos = at & (ringSize - 1);
+	size_t first = ringSize - pos < len ? ringSize - pos : len;
+
+	memcpy(dst, ring + pos, first);
+	memcpy(dst + first, ring, len - first);
+}
+
+static void takeSnapshot(struct Machine *m)
+{
+	struct StateBuffer state;
+	uint8_t next[MACHINE_MAX];
+	uint8_t block[BLOCK_BYTES];
+	size_t i, o, count, len;
+	int b, w, a, n, v;
+
+	StateWriteBegin(&state, next, sizeof(next));
+	SerializeMachine(m, &state, 0);
+	if (state.error)
+		return;
+	machineSize = state.pos;
+
+	for (i = 0; i < machineSize; i++)
+	{
+		next[i] ^= machine[i];
+		machine[i] ^= next[i];
+	}
+	o = 4;
+	record[o++] = started ? 0 : REWIND_BASE;
+	o += encodeDelta(record + o, next, machineSize);
+
+	count = o;
+	o += 2;
+	n = 0;
+	for (b = 0; b < MEMORY_BLOCKS; b++)
+	{
+		if (!(m->MemoryDirty[b] & MEMORY_DIRTY_REWIND))
+			continue;
+		m->MemoryDirty[b] &= ~MEMORY_DIRTY_REWIND;
+		v = 0;
+		for (w = 0; w < MEMORY_BLOCK_SIZE; w++)
+		{
+			a = (b << MEMORY_BLOCK_SHIFT) + w;
+			v |= block[w * 2] = (uint8_t)(MemoryPeek(m, a) ^ shadow[a]);
+			v |= block[w * 2 + 1] = (uint8_t)((MemoryPeek(m, a) ^ shadow[a]) >> 8);
+			shadow[a] = (uint16_t)MemoryPeek(m, a);
+		}
+		if (v == 0)
+			continue;
+		put16(record + o, b);
+		o += 2 + encodeDelta(record + o + 2, block, BLOCK_BYTES);
+		n++;
+	}
+	put16(record + count, n);
+	len = o + 4;
+	put32(record, len);
+	put32(record + o, len);
+
+	while (ringHead - ringTail + len > ringSize && records > 0)
+	{
+		ringRead(ringTail, block, 4);
+		ringTail += get32(block);
+		records--;
+	}
+	ringWrite(ringHead, record, len);
+	ringHead += len;
+	records++;
+	started = 1;
+}
+
+// Puts the machine back to the newest snapshot and redraws its frame
+static void restore(struct Machine *m)
+{
+	struct StateBuffer state;
+	int i, b;
+
+	StateReadBegin(&state, machine, machineSize);
+	UnserializeMachine(m, &state, 0);
+	for (i = 0; i < 0x10000; i++)
+	{
+		if (MemoryPeek(m, i) != shadow[i])
+			MemoryPoke(m, i) = shadow[i];
+	}
+
+	// drawing latches collisions and STIC timing, so reload those after
+	STICDrawFrame(m, m->stic.vid_enable);
+	StateReadBegin(&state, machine, machineSize);
+	UnserializeMachine(m, &state, 0);
+	for (i = 0x18; i <= 0x1F; i++)
+		MemoryPoke(m, i) = shadow[i];
+	MemoryTouchAll(m);
+	for (b = 0; b < MEMORY_BLOCKS; b++)
+		m->MemoryDirty[b] &= ~MEMORY_DIRTY_REWIND;
+}
+
+void RewindInit(struct Machine *m, int megabytes, int frameInterval)
+{
+	size_t size = (size_t)megabytes << 20;
+	int every = frameInterval > 0 ? frameInterval : 1;
+
+	// called on every options update, keep the history unless these change
+	if (size == ringSize && every == interval)
+		return;
+	interval = every;
+	if (size != ringSize)
+	{
+		RewindDeinit();
+		if (size > 0)
+		{
+			ring = (uint8_t *)malloc(size);
+			record = (uint8_t *)malloc(RECORD_MAX);
+			if (ring && record)
+				ringSize = size;
+			else
+				RewindDeinit();
+		}
+	}
+	RewindReset(m);
+}
+
+void RewindReset(struct Machine *m)
+{
+	ringHead = ringTail = 0;
+	records = 0;
+	frames = 0;
+	started = 0;
+	memset(machine, 0, sizeof(machine));
+	memset(shadow, 0, sizeof(shadow));
+	MemoryTouchAll(m);
+}
+
+void RewindFrame(struct Machine *m)
+{
+	if (!ring)
+		return;
+	if (++frames < interval && started)
+		return;
+	frames = 0;
+	takeSnapshot(m);
+}
+
+int RewindStep(struct Machine *m)
+{
+	uint8_t size[4];
+	size_t len, o;
+	int n, b, w, a;
+	uint8_t block[BLOCK_BYTES];
+
+	if (!ring || !started)
+		return 0;
+
+	// first go back to the newest snapshot itself
+	if (frames > 0)
+	{
+		frames = 0;
+		restore(m);
+		return 1;
+	}
+	if (records == 0)
+		return 0;
+
+	ringRead(ringHead - 4, size, 4);
+	len = get32(size);
+	ringRead(ringHead - len, record, len);
+	if (record[4] & REWIND_BASE)
+		return 0;
+	ringHead -= len;
+	records--;
+
+	o = 5;
+	o += decodeDelta(record + o, machine, machineSize);
+	n = (int)get16(record + o);
+	o += 2;
+	while (n-- > 0)
+	{
+		b = (int)get16(record + o);
+		memset(block, 0, sizeof(block));
+		o += 2 + decodeDelta(record + o + 2, block, BLOCK_BYTES);
+		for (w = 0; w < MEMORY_BLOCK_SIZE; w++)
+		{
+			a = (b << MEMORY_BLOCK_SHIFT) + w;
+			shadow[a] ^= (uint16_t)(block[w * 2] | (block[w * 2 + 1] << 8));
+		}
+	}
+	restore(m);
+	return 1;
+}
+
+void RewindDeinit(void)
+{
+	free(ring);
+	free(record);
+	ring = NULL;
+	record = NULL;
+	ringSize = 0;
+	ringHead = ringTail = 0;
+	records = 0;
+	started = 0;
+}
@@ -0,0 +1,30 @@
+#ifndef REWIND_H
+#define REWIND_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+struct Machine;
+
+// One history, for the machine the frontend shows
+void RewindInit(struct Machine *m, int megabytes, int interval); // 0 megabytes disables rewind, same settings keep the history
+void RewindReset(struct Machine *m); // drops the history, e.g. after loading a game
+void RewindFrame(struct Machine *m); // call once per emulated frame, snapshots every interval frames
+int RewindStep(struct Machine *m); // steps back one snapshot and redraws frame[], 0 when out of history
+void RewindDeinit(void);
+
+#endif
@@ -0,0 +1,100 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <string.h>
+#include <stdint.h>
+#include "runahead.h"
+#include "intv.h"
+#include "memory.h"
+#include "stic.h"
+#include "psg.h"
+#include "state.h"
+
+// The snapshot is the machine chunks without "MEM ", plus aheadMemory[],
+// a copy of the address space kept in step block by block: blocks flagged
+// MEMORY_DIRTY_RUNAHEAD are copied in before running ahead and copied
+// back out afterwards, every other block already matches.  The PSG and
+// Intellivoice output buffers are left out, the frames run ahead are
+// never heard.
+
+#define MACHINE_MAX 2048
+
+static int frames;
+
+static uint8_t machine[MACHINE_MAX];
+static size_t machineSize;
+static unsigned int aheadMemory[0x10000];
+
+// Copies dirty blocks to aheadMemory[], or back from it if restore is set.
+// A block never spans two pages.
+static void syncMemory(struct Machine *m, int restore)
+{
+	int b, a;
+
+	for (b = 0; b < MEMORY_BLOCKS; b++)
+	{
+		if (!(m->MemoryDirty[b] & MEMORY_DIRTY_RUNAHEAD))
+			continue;
+		m->MemoryDirty[b] &= ~MEMORY_DIRTY_RUNAHEAD;
+		a = b << MEMORY_BLOCK_SHIFT;
+		if (!restore)
+			memcpy(&aheadMemory[a], &MemoryPeek(m, a), MEMORY_BLOCK_SIZE * sizeof(unsigned int));
+		else if (memcmp(&MemoryPeek(m, a), &aheadMemory[a], MEMORY_BLOCK_SIZE * sizeof(unsigned int)) != 0)
+			memcpy(&MemoryPoke(m, a), &aheadMemory[a], MEMORY_BLOCK_SIZE * sizeof(unsigned int));
+	}
+}
+
+void RunAheadInit(struct Machine *m, int count)
+{
+	frames = count > 0 ? count : 0;
+	MemoryTouchAll(m); // aheadMemory[] may be stale
+}
+
+void RunAheadBegin(struct Machine *m)
+{
+	m->stic.hidden = frames > 0;
+}
+
+void RunAheadEnd(struct Machine *m)
+{
+	struct StateBuffer state;
+	int i;
+
+	m->stic.hidden = 0;
+	if (frames == 0 || m->halt)
+		return;
+
+	StateWriteBegin(&state, machine, sizeof(machine));
+	SerializeMachine(m, &state, 0);
+	if (state.error)
+		return;
+	machineSize = state.pos;
+	syncMemory(m, 0);
+
+	m->psg.Hidden = 1;
+	for (i = 0; i < frames; i++)
+	{
+		m->stic.hidden = i < frames - 1;
+		Run(m);
+	}
+	m->stic.hidden = 0;
+	m->psg.Hidden = 0;
+
+	syncMemory(m, 1);
+	StateReadBegin(&state, machine, machineSize);
+	UnserializeMachine(m, &state, 0);
+}
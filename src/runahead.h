@@ -0,0 +1,30 @@
+#ifndef RUNAHEAD_H
+#define RUNAHEAD_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+struct Machine;
+
+// Run-ahead: after each real frame the machine is snapshotted, run a few
+// frames further on the same input with only the last one drawn, then
+// rolled back.  The frame shown reacts to input that many frames sooner.
+void RunAheadInit(struct Machine *m, int frames); // 0 disables run-ahead
+void RunAheadBegin(struct Machine *m); // before the real frame, hides its video when running ahead
+void RunAheadEnd(struct Machine *m); // after the real frame's audio is out, runs ahead and rolls back
+
+#endif
@@ -0,0 +1,223 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <string.h>
+#include "state.h"
+
+#define STATE_HEADER_SIZE 8
+
+static void putBytes(struct StateBuffer *state, const uint8_t *bytes, size_t count)
+{
+	if (state->pos + count > state->size)
+	{
+		state->error = 1;
+		return;
+	}
+	if (state->data)
+		memcpy(state->data + state->pos, bytes, count);
+	state->pos += count;
+}
+
+static const uint8_t *getBytes(struct StateBuffer *state, size_t count)
+{
+	const uint8_t *bytes;
+
+	if (state->pos + count > state->end)
+	{
+		state->error = 1;
+		state->pos = state->end;
+		return NULL;
+	}
+	bytes = state->data + state->pos;
+	state->pos += count;
+	return bytes;
+}
+
+void StateWriteBegin(struct StateBuffer *state, void *data, size_t size)
+{
+	state->data = (uint8_t *)data;
+	state->size = data ? size : (size_t)-1;
+	state->pos = 0;
+	state->end = 0;
+	state->error = 0;
+	putBytes(state, (const uint8_t *)"FINT", 4);
+	StatePut32(state, STATE_VERSION);
+}
+
+int StateReadBegin(struct StateBuffer *state, const void *data, size_t size)
+{
+	const uint8_t *magic;
+
+	state->data = (uint8_t *)data;
+	state->size = size;
+	state->pos = 0;
+	state->end = size;
+	state->error = 0;
+	magic = getBytes(state, 4);
+	if (!magic || memcmp(magic, "FINT", 4) != 0 || StateGet32(state) != STATE_VERSION)
+		state->error = 1;
+	return !state->error;
+}
+
+size_t StateChunkBegin(struct StateBuffer *state, const char *tag)
+{
+	size_t mark;
+
+	putBytes(state, (const uint8_t *)tag, 4);
+	mark = state->pos;
+	StatePut32(state, 0); // patched by StateChunkEnd
+	return mark;
+}
+
+void StateChunkEnd(struct StateBuffer *state, size_t mark)
+{
+	size_t pos = state->pos;
+
+	if (state->error)
+		return;
+	state->pos = mark;
+	StatePut32(state, (uint32_t)(pos - mark - 4));
+	state->pos = pos;
+}
+
+int StateChunkOpen(struct StateBuffer *state, const char *tag)
+{
+	size_t pos = STATE_HEADER_SIZE;
+	size_t len;
+	const uint8_t *p;
+
+	while (pos + 8 <= state->size)
+	{
+		p = state->data + pos;
+		len = p[4] | (p[5] << 8) | (p[6] << 16) | ((size_t)p[7] << 24);
+		if (len > state->size - pos - 8)
+			break;
+		if (memcmp(p, tag, 4) == 0)
+		{
+			state->pos = pos + 8;
+			state->end = pos + 8 + len;
+			return 1;
+		}
+		pos += 8 + len;
+	}
+	state->error = 1;
+	return 0;
+}
+
+void StatePut8(struct StateBuffer *state, uint32_t val)
+{
+	uint8_t b = (uint8_t)val;
+
+	putBytes(state, &b, 1);
+}
+
+void StatePut16(struct StateBuffer *state, uint32_t val)
+{
+	uint8_t b[2];
+
+	b[0] = (uint8_t)val;
+	b[1] = (uint8_t)(val >> 8);
+	putBytes(state, b, 2);
+}
+
+void StatePut32(struct StateBuffer *state, uint32_t val)
+{
+	uint8_t b[4];
+
+	b[0] = (uint8_t)val;
+	b[1] = (uint8_t)(val >> 8);
+	b[2] = (uint8_t)(val >> 16);
+	b[3] = (uint8_t)(val >> 24);
+	putBytes(state, b, 4);
+}
+
+void StatePut64(struct StateBuffer *state, uint64_t val)
+{
+	StatePut32(state, (uint32_t)val);
+	StatePut32(state, (uint32_t)(val >> 32));
+}
+
+void StatePutInt(struct StateBuffer *state, int val)
+{
+	StatePut32(state, (uint32_t)val);
+}
+
+uint32_t StateGet8(struct StateBuffer *state)
+{
+	const uint8_t *b = getBytes(state, 1);
+
+	return b ? b[0] : 0;
+}
+
+uint32_t StateGet16(struct StateBuffer *state)
+{
+	const uint8_t *b = getBytes(state, 2);
+
+	return b ? b[0] | (b[1] << 8) : 0;
+}
+
+uint32_t StateGet32(struct StateBuffer *state)
+{
+	const uint8_t *b = getBytes(state, 4);
+
+	return b ? b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24) : 0;
+}
+
+uint64_t StateGet64(struct StateBuffer *state)
+{
+	uint64_t lo = StateGet32(state);
+
+	return lo | ((uint64_t)StateGet32(state) << 32);
+}
+
+int StateGetInt(struct StateBuffer *state)
+{
+	return (int)(int32_t)StateGet32(state);
+}
+
+void StatePutWords(struct StateBuffer *state, const unsigned int *words, int count)
+{
+	uint8_t *b;
+	int i;
+
+	if (state->pos + count * 2 > state->size)
+	{
+		state->error = 1;
+		return;
+	}
+	if (state->data)
+	{
+		b = state->data + state->pos;
+		for (i = 0; i < count; i++)
+		{
+			b[i * 2] = (uint8_t)words[i];
+			b[i * 2 + 1] = (uint8_t)(words[i] >> 8);
+		}
+	}
+	state->pos += count * 2;
+}
+
+void StateGetWords(struct StateBuffer *state, unsigned int *words, int count)
+{
+	const uint8_t *b = getBytes(state, count * 2);
+	int i;
+
+	if (!b)
+		return;
+	for (i = 0; i < count; i++)
+		words[i] = b[i * 2] | (b[i * 2 + 1] << 8);
+}
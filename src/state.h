@@ -0,0 +1,61 @@
+#ifndef STATE_H
+#define STATE_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stddef.h>
+#include <stdint.h>
+
+// Save state layout, all values little-endian:
+//   "FINT"  magic
+//   u32     format version (STATE_VERSION)
+//   chunks  4 character tag, u32 payload length, payload
+// Loading looks chunks up by tag and skips any it doesn't know.
+#define STATE_VERSION 1
+
+struct StateBuffer {
+	uint8_t *data; // NULL when only measuring
+	size_t size;
+	size_t pos;
+	size_t end; // end of the chunk being read
+	int error; // set on overrun, missing chunk or bad header
+};
+
+void StateWriteBegin(struct StateBuffer *state, void *data, size_t size); // data may be NULL to measure
+int StateReadBegin(struct StateBuffer *state, const void *data, size_t size); // 0 on bad magic/version
+
+size_t StateChunkBegin(struct StateBuffer *state, const char *tag);
+void StateChunkEnd(struct StateBuffer *state, size_t mark);
+int StateChunkOpen(struct StateBuffer *state, const char *tag); // 0 if missing
+
+void StatePut8(struct StateBuffer *state, uint32_t val);
+void StatePut16(struct StateBuffer *state, uint32_t val);
+void StatePut32(struct StateBuffer *state, uint32_t val);
+void StatePut64(struct StateBuffer *state, uint64_t val);
+void StatePutInt(struct StateBuffer *state, int val);
+
+uint32_t StateGet8(struct StateBuffer *state);
+uint32_t StateGet16(struct StateBuffer *state);
+uint32_t StateGet32(struct StateBuffer *state);
+uint64_t StateGet64(struct StateBuffer *state);
+int StateGetInt(struct StateBuffer *state);
+
+// 16-bit words kept in unsigned ints, e.g. Memory[]
+void StatePutWords(struct StateBuffer *state, const unsigned int *words, int count);
+void StateGetWords(struct StateBuffer *state, unsigned int *words, int count);
+
+#endif
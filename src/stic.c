@@ -19,47 +19,23 @@
 #include "intv.h"
 #include "memory.h"
 #include "stic.h"
+#include "state.h"
 
 #include <stdio.h>
 #include <string.h>
 
-void drawBackground(void);
-void drawSprites(int scanline);
-void drawBorder(int scanline);
-void drawBackgroundFGBG(int scanline);
-void drawBackgroundColorStack(int scanline);
+void drawBackground(struct Machine *m);
+void drawSprites(struct Machine *m, int scanline);
+void drawBorder(struct Machine *m, int scanline);
+void drawBackgroundFGBG(struct Machine *m, int scanline);
+void drawBackgroundColorStack(struct Machine *m, int scanline);
 
 // Video chip: TMS9927 AY-3-8900-1
 // http://spatula-city.org/~im14u2c/intv/jzintv-1.0-beta3/doc/programming/stic.txt
 // http://spatula-city.org/~im14u2c/intv/tech/master.html
 
-unsigned int STICMode;
-
-int stic_phase;
-int stic_vid_enable;
-int stic_reg;
-int stic_gram;
-int phase_len;
-
-int DisplayEnabled;
-
-unsigned int frame[352*224];
-
-unsigned int scanBuffer[768]; // buffer for current scanline (352+32)*2
-unsigned int collBuffer[768]; // buffer for collision -- made larger than needed to save checks
-
-int delayH = 0; // Horizontal Delay
-int delayV = 0; // Vertical Delay
-
-int extendTop = 0;
-int extendLeft = 0;
-
-unsigned int CSP; // Color Stack Pointer
-unsigned int fgcard[20]; // cached colors for cards on current row
-unsigned int bgcard[20]; // (used for normal color stack mode)
 #if defined(ABGR1555)
-unsigned int color7 = 0xFFFCFF; // Copy of color 7 (for color squares mode)
-unsigned int colors[16] =
+const unsigned int colors[16] =
 {
 	0x05000C, /* 0x000000; */ // Black
 	0xFF2D00, /* 0x0000FF; */ // Blue
@@ -79,8 +55,7 @@ unsigned int colors[16] =
 	0x7D1AC8  /* 0xFF007F; */ // Magenta
 };
 #else
-unsigned int color7 = 0xFFFCFF; // Copy of color 7 (for color squares mode)
-unsigned int colors[16] =
+const unsigned int colors[16] =
 {
 	0x0C0005, /* 0x000000; */ // Black
 	0x002DFF, /* 0x0000FF; */ // Blue
@@ -101,7 +76,7 @@ unsigned int colors[16] =
 };
 #endif
 
-int reverse[256] = // lookup table to reverse the bits in a byte //
+const int reverse[256] = // lookup table to reverse the bits in a byte //
 {
 	0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
 	0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
@@ -121,108 +96,105 @@ int reverse[256] = // lookup table to reverse the bits in a byte //
 	0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
 };
 
-void STICSerialize(struct STICserialized *all)
+void STICSerialize(struct Machine *m, struct StateBuffer *state)
 {
-    all->STICMode = STICMode;
-    all->stic_phase = stic_phase;
-    all->stic_vid_enable = stic_vid_enable;
-    all->stic_reg = stic_reg;
-    all->stic_gram = stic_gram;
-    all->phase_len = phase_len;
-    all->DisplayEnabled = DisplayEnabled;
-    all->delayH = delayH;
-    all->delayV = delayV;
-    all->extendTop = extendTop;
-    all->extendLeft = extendLeft;
-    all->CSP = CSP;
-    memcpy(all->fgcard, fgcard, sizeof(fgcard));
-    memcpy(all->bgcard, bgcard, sizeof(bgcard));
-    memcpy(all->frame, frame, sizeof(frame));
+    size_t mark = StateChunkBegin(state, "STIC");
+
+    StatePutInt(state, m->stic.Mode);
+    StatePutInt(state, m->stic.phase);
+    StatePutInt(state, m->stic.vid_enable);
+    StatePutInt(state, m->stic.reg);
+    StatePutInt(state, m->stic.gram);
+    StatePutInt(state, m->stic.phase_len);
+    StatePutInt(state, m->stic.DisplayEnabled);
+    StatePutInt(state, m->stic.delayH);
+    StatePutInt(state, m->stic.delayV);
+    StatePutInt(state, m->stic.extendTop);
+    StatePutInt(state, m->stic.extendLeft);
+    StateChunkEnd(state, mark);
 }
 
-void STICUnserialize(const struct STICserialized *all)
+void STICUnserialize(struct Machine *m, struct StateBuffer *state)
 {
-    STICMode = all->STICMode;
-    stic_phase = all->stic_phase;
-    stic_vid_enable = all->stic_vid_enable;
-    stic_reg = all->stic_reg;
-    stic_gram = all->stic_gram;
-    phase_len = all->phase_len;
-    DisplayEnabled = all->DisplayEnabled;
-    delayH = all->delayH;
-    delayV = all->delayV;
-    extendTop = all->extendTop;
-    extendLeft = all->extendLeft;
-    CSP = all->CSP;
-    memcpy(fgcard, all->fgcard, sizeof(fgcard));
-    memcpy(bgcard, all->bgcard, sizeof(bgcard));
-    memcpy(frame, all->frame, sizeof(frame));
+    if (!StateChunkOpen(state, "STIC"))
+        return;
+    m->stic.Mode = StateGetInt(state);
+    m->stic.phase = StateGetInt(state);
+    m->stic.vid_enable = StateGetInt(state);
+    m->stic.reg = StateGetInt(state);
+    m->stic.gram = StateGetInt(state);
+    m->stic.phase_len = StateGetInt(state);
+    m->stic.DisplayEnabled = StateGetInt(state);
+    m->stic.delayH = StateGetInt(state);
+    m->stic.delayV = StateGetInt(state);
+    m->stic.extendTop = StateGetInt(state);
+    m->stic.extendLeft = StateGetInt(state);
 }
 
-void STICReset(void)
+void STICReset(struct Machine *m)
 {
-	STICMode = 1;       // Color Stack mode
-	SR1 = 0;            // No interrupt pending
-	DisplayEnabled = 0;
-	CSP = 0x28;
-    stic_phase = 15;
-    stic_reg = 1;
-    stic_gram = 1;
-    phase_len = 2782;   // Time to run before the first STIC interrupt
+	m->stic.Mode = 1;       // Color Stack mode
+	m->SR1 = 0;            // No interrupt pending
+	m->stic.DisplayEnabled = 0;
+	m->stic.CSP = 0x28;
+    m->stic.phase = 15;
+    m->stic.reg = 1;
+    m->stic.gram = 1;
+    m->stic.phase_len = 2782;   // Time to run before the first STIC interrupt
 }
 
-void drawBorder(int scanline)
+void drawBorder(struct Machine *m, int scanline)
 {
 	int i;
 	int cbit = 1<<9; // bit 9 - border collision 
-	int color = colors[Memory[0x2C] & 0x0f]; // border color
+	int color = colors[MemoryPeek(m, 0x2C) & 0x0f]; // border color
 	
 	if(scanline>=112) { return; }
-    if (scanline == delayV - 1 || scanline == 104 || extendTop != 0 && scanline >= 7 && scanline < 16) {    // Collision border is 1 pixel thick, or 9 if extendTop is set
+    if (scanline == m->stic.delayV - 1 || scanline == 104 || m->stic.extendTop != 0 && scanline >= 7 && scanline < 16) {    // Collision border is 1 pixel thick, or 9 if extendTop is set
         for(i=1 * 2; i < (8 + 160) * 2; i += 2)         // It extends from column -7 to 159
         {
-            collBuffer[i] |= cbit;
-            collBuffer[i+384] |= cbit;
+            m->stic.collBuffer[i] |= cbit;
+            m->stic.collBuffer[i+384] |= cbit;
         }
-    } else if (scanline > delayV - 1 && scanline < 104) {   // Left and right side collision border
-        for(i=1 * 2; i < 16+(16*extendLeft); i += 2)                 // Left side from column -7 to -1 (or 7 if extendLeft is set)
+    } else if (scanline > m->stic.delayV - 1 && scanline < 104) {   // Left and right side collision border
+        for(i=1 * 2; i < 16+(16*m->stic.extendLeft); i += 2)                 // Left side from column -7 to -1 (or 7 if extendLeft is set)
         {
-            collBuffer[i] |= cbit;
-            collBuffer[i+384] |= cbit;
+            m->stic.collBuffer[i] |= cbit;
+            m->stic.collBuffer[i+384] |= cbit;
         }
         i = (8 + 159) * 2;                              // Right side collision is 1 pixel thick
-        collBuffer[i] |= cbit;
-        collBuffer[i + 384] |= cbit;
+        m->stic.collBuffer[i] |= cbit;
+        m->stic.collBuffer[i + 384] |= cbit;
     }
-    if (extendTop != 0)
+    if (m->stic.extendTop != 0)
         i = 16;
     else
-        i = delayV;
+        i = m->stic.delayV;
     if(scanline<i || scanline>=104) // top and bottom border
 	{
 		for(i=0; i<352; i++)
 		{
-			scanBuffer[i] = color;
-			scanBuffer[i+384] = color;
+			m->stic.scanBuffer[i] = color;
+			m->stic.scanBuffer[i+384] = color;
 		}
 	}
 	else // left and right border
 	{
-		for(i=0; i<16+(16*extendLeft); i++)
+		for(i=0; i<16+(16*m->stic.extendLeft); i++)
 		{
-			scanBuffer[i] = color;
-			scanBuffer[i+168*2] = color;
-			scanBuffer[i+384] = color;
-			scanBuffer[i+384+168*2] = color;
+			m->stic.scanBuffer[i] = color;
+			m->stic.scanBuffer[i+168*2] = color;
+			m->stic.scanBuffer[i+384] = color;
+			m->stic.scanBuffer[i+384+168*2] = color;
 		}
-        scanBuffer[167*2] = color;                  // Invisible 160th column
-        scanBuffer[167*2 + 1] = color;
-        scanBuffer[167*2 + 384] = color;                  // Invisible 160th column
-        scanBuffer[167*2 + 384 + 1] = color;
+        m->stic.scanBuffer[167*2] = color;                  // Invisible 160th column
+        m->stic.scanBuffer[167*2 + 1] = color;
+        m->stic.scanBuffer[167*2 + 384] = color;                  // Invisible 160th column
+        m->stic.scanBuffer[167*2 + 384 + 1] = color;
     }
 }
 
-void drawBackgroundFGBG(int scanline)
+void drawBackgroundFGBG(struct Machine *m, int scanline)
 {
 	int i; 
 	int row, col; // row offset and column of current card
@@ -233,7 +205,7 @@ void drawBackgroundFGBG(int scanline)
 	int gaddress; // card graphic address
 	int gdata;    // current card graphic byte
 	int cbit = 1<<8;   // bit 8 - collision bit for Background
-	int x = delayH; // current pixel offset 
+	int x = m->stic.delayH; // current pixel offset 
 
 	// Tiled background is 20x12, cards are 8x8
 	row = scanline / 8; // Which tile row? (Background is 96 lines high)
@@ -244,42 +216,42 @@ void drawBackgroundFGBG(int scanline)
 	// Draw cards
 	for (col=0; col<20; col++) // for each card on the current row...
 	{
-		card = Memory[0x200+row+col]; // card info from BACKTAB
+		card = MemoryPeek(m, 0x200+row+col); // card info from BACKTAB
 
 		fgcolor = colors[card & 0x07];
 		bgcolor = colors[((card>>9)&0x03) | ((card>>11)&0x04) | ((card>>9)&0x08)]; // bits 12,13,10,9
 		
         gaddress = 0x3000 + (card & 0x09f8);
 		
-		gdata = Memory[gaddress + cardrow]; // fetch current line of current card graphic
+		gdata = MemoryPeek(m, gaddress + cardrow); // fetch current line of current card graphic
 
 		for(i=7; i>=0; i--) // draw one line of card graphic
 		{
 			if(((gdata>>i)&1)==1)
 			{
 				// draw pixel
-				scanBuffer[x] = fgcolor;
-				scanBuffer[x+1] = fgcolor;
-				scanBuffer[x+384] = fgcolor;
-				scanBuffer[x+384+1] = fgcolor;
+				m->stic.scanBuffer[x] = fgcolor;
+				m->stic.scanBuffer[x+1] = fgcolor;
+				m->stic.scanBuffer[x+384] = fgcolor;
+				m->stic.scanBuffer[x+384+1] = fgcolor;
 				// write to collision buffer 
-				collBuffer[x] |= cbit;
-				collBuffer[x+384] |= cbit;
+				m->stic.collBuffer[x] |= cbit;
+				m->stic.collBuffer[x+384] |= cbit;
 			}
 			else
 			{
 				// draw background
-				scanBuffer[x] = bgcolor;
-				scanBuffer[x+1] = bgcolor;
-				scanBuffer[x+384] = bgcolor;
-				scanBuffer[x+384+1] = bgcolor;
+				m->stic.scanBuffer[x] = bgcolor;
+				m->stic.scanBuffer[x+1] = bgcolor;
+				m->stic.scanBuffer[x+384] = bgcolor;
+				m->stic.scanBuffer[x+384+1] = bgcolor;
 			}		
 			x+=2;
 		}
 	}
 }
 
-void drawBackgroundColorStack(int scanline)
+void drawBackgroundColorStack(struct Machine *m, int scanline)
 {
     int i;
     unsigned int color1, color2;
@@ -293,7 +265,7 @@ void drawBackgroundColorStack(int scanline)
     int gdata;    // current card graphic byte
     int advcolor; // Flag - Advance CSP
     int cbit = 1<<8;   // bit 8 - collision bit for Background
-    int x = delayH; // current pixel offset
+    int x = m->stic.delayH; // current pixel offset
     
     // Tiled background is 20x12, cards are 8x8
     row = (scanline / 8); // Which tile row? (Background is 96 lines high)
@@ -301,19 +273,18 @@ void drawBackgroundColorStack(int scanline)
     
     cardrow = scanline % 8; // which line of this row of cards to draw
     
-    if(row==0 && cardrow==0) { CSP = 0x28; } // reset CSP on display of first card on screen
+    if(row==0 && cardrow==0) { m->stic.CSP = 0x28; } // reset CSP on display of first card on screen
     
     // Draw cards
     for (col=0; col<20; col++) // for each card on the current row...
     {
-        card = Memory[0x200+row+col]; // card info from BACKTAB
+        card = MemoryPeek(m, 0x200+row+col); // card info from BACKTAB
         
         if(((card>>11)&0x03)==2) // Color Squares Mode
         {
             if (cardrow == 0)
-                bgcard[col] = colors[Memory[CSP] & 0x0F];
+                m->stic.bgcard[col] = colors[MemoryPeek(m, m->stic.CSP) & 0x0F];
             // set colors
-            colors[7] = bgcard[col]; // color 7 is top of color stack
             color1 = card & 0x07;
             color2 = (card>>3) & 0x07;
             if(cardrow>=4) // switch to lower squares colors
@@ -325,24 +296,24 @@ void drawBackgroundColorStack(int scanline)
             cbit1 = cbit2 = cbit;
             if(color1==7) { cbit1=0; }
             if(color2==7) { cbit2=0; }
-            color1 = colors[color1]; // set to rgb24 color
-            color2 = colors[color2];
-            colors[7] = color7; // restore color 7
+            // set to rgb24 color, color 7 is top of color stack
+            color1 = (color1 == 7) ? m->stic.bgcard[col] : colors[color1];
+            color2 = (color2 == 7) ? m->stic.bgcard[col] : colors[color2];
             // draw squares
             for(i=0; i<8; i += 2)
             {
-                scanBuffer[x] = color1;
-                scanBuffer[x+1] = color1;
-                scanBuffer[x+8] = color2;
-                scanBuffer[x+9] = color2;
-                scanBuffer[x+384] = color1;
-                scanBuffer[x+384+1] = color1;
-                scanBuffer[x+384+8] = color2;
-                scanBuffer[x+384+9] = color2;
-                collBuffer[x] |= cbit1;
-                collBuffer[x+8] |= cbit2;
-                collBuffer[x+384] |= cbit1;
-                collBuffer[x+384+8] |= cbit2;
+                m->stic.scanBuffer[x] = color1;
+                m->stic.scanBuffer[x+1] = color1;
+                m->stic.scanBuffer[x+8] = color2;
+                m->stic.scanBuffer[x+9] = color2;
+                m->stic.scanBuffer[x+384] = color1;
+                m->stic.scanBuffer[x+384+1] = color1;
+                m->stic.scanBuffer[x+384+8] = color2;
+                m->stic.scanBuffer[x+384+9] = color2;
+                m->stic.collBuffer[x] |= cbit1;
+                m->stic.collBuffer[x+8] |= cbit2;
+                m->stic.collBuffer[x+384] |= cbit1;
+                m->stic.collBuffer[x+384+8] |= cbit2;
                 x+=2;
             }
             x+=8;
@@ -353,40 +324,40 @@ void drawBackgroundColorStack(int scanline)
             if(cardrow == 0) // only advance CSP once per card, cache card colors for later scanlines
             {
                 advcolor = (card>>13) & 0x01; // do we need to advance the CSP?
-                CSP = (CSP+advcolor) & 0x2B; // cycles through 0x28-0x2B
-                fgcard[col] = colors[(card&0x07)|((card>>9)&0x08)]; // bits 12, 2, 1, 0
-                bgcard[col] = colors[Memory[CSP] & 0x0F];
+                m->stic.CSP = (m->stic.CSP+advcolor) & 0x2B; // cycles through 0x28-0x2B
+                m->stic.fgcard[col] = colors[(card&0x07)|((card>>9)&0x08)]; // bits 12, 2, 1, 0
+                m->stic.bgcard[col] = colors[MemoryPeek(m, m->stic.CSP) & 0x0F];
             }
             
-            fgcolor = fgcard[col];
-            bgcolor = bgcard[col];
+            fgcolor = m->stic.fgcard[col];
+            bgcolor = m->stic.bgcard[col];
             
             if (((card >> 11) & 0x01) != 0) /* Card is from GRAM - limit to 64 cards */
                 gaddress = 0x3000 + (card & 0x09f8);
             else                             /* Card is from GROM */
                 gaddress = 0x3000 + (card & 0x0ff8);
             
-            gdata = Memory[gaddress + cardrow]; // fetch current line of current card graphic
+            gdata = MemoryPeek(m, gaddress + cardrow); // fetch current line of current card graphic
             for(i=7; i>=0; i--) // draw one line of card graphic
             {
                 if(((gdata>>i)&1)==1)
                 {
                     // draw pixel
-                    scanBuffer[x] = fgcolor;
-                    scanBuffer[x+1] = fgcolor;
-                    scanBuffer[x+384] = fgcolor;
-                    scanBuffer[x+384+1] = fgcolor;
+                    m->stic.scanBuffer[x] = fgcolor;
+                    m->stic.scanBuffer[x+1] = fgcolor;
+                    m->stic.scanBuffer[x+384] = fgcolor;
+                    m->stic.scanBuffer[x+384+1] = fgcolor;
                     // write to collision buffer 
-                    collBuffer[x] |= cbit;
-                    collBuffer[x+384] |= cbit;
+                    m->stic.collBuffer[x] |= cbit;
+                    m->stic.collBuffer[x+384] |= cbit;
                 }
                 else
                 {
                     // draw background
-                    scanBuffer[x] = bgcolor;
-                    scanBuffer[x+1] = bgcolor;
-                    scanBuffer[x+384] = bgcolor;
-                    scanBuffer[x+384+1] = bgcolor;
+                    m->stic.scanBuffer[x] = bgcolor;
+                    m->stic.scanBuffer[x+1] = bgcolor;
+                    m->stic.scanBuffer[x+384] = bgcolor;
+                    m->stic.scanBuffer[x+384+1] = bgcolor;
                 }
                 x+=2;
             }
@@ -394,7 +365,7 @@ void drawBackgroundColorStack(int scanline)
     }
 }
 
-void drawSprites(int scanline) // MOBs
+void drawSprites(struct Machine *m, int scanline) // MOBs
 {
 	int i, j, k, x;
 	int fgcolor;    // Foreground Color - (Ra bits 12, 2, 1, 0)
@@ -420,9 +391,9 @@ void drawSprites(int scanline) // MOBs
 
 	for(i=7; i>=0; i--) // draw sprites 0-7 in reverse order
 	{
-		Rx = Memory[0x00+i]; // 14 bits ; -- -SVI xxxx xxxx ; Size, Visible, Interactive, X Position
-		Ry = Memory[0x08+i]; // 14 bits ; -- YX42 Ryyy yyyy ; Flip Y, Flip X, Size 4, Size 2, Y Resolution, Y Position
-		Ra = Memory[0x10+i]; // 14 bits ; PF Gnnn nnnn nFFF ; Priority, FG Color Bit 3, GRAM, n Card #, FG Color Bits 2-0
+		Rx = MemoryPeek(m, 0x00+i); // 14 bits ; -- -SVI xxxx xxxx ; Size, Visible, Interactive, X Position
+		Ry = MemoryPeek(m, 0x08+i); // 14 bits ; -- YX42 Ryyy yyyy ; Flip Y, Flip X, Size 4, Size 2, Y Resolution, Y Position
+		Ra = MemoryPeek(m, 0x10+i); // 14 bits ; PF Gnnn nnnn nFFF ; Priority, FG Color Bit 3, GRAM, n Card #, FG Color Bits 2-0
 
 		posX  = Rx & 0xFF;
 		posY  = Ry & 0x7F;
@@ -442,7 +413,7 @@ void drawSprites(int scanline) // MOBs
         }
 
         // Limit card number to 64 if in GRAM or in Foreground/Background mode
-        if(STICMode==0 || ((Ra>>11) & 0x01) == 1) { card = card & 0x09f8; }
+        if(m->stic.Mode==0 || ((Ra>>11) & 0x01) == 1) { card = card & 0x09f8; }
         gaddress = 0x3000 + card;
         
         fgcolor = colors[((Ra>>9)&0x08)|(Ra&0x07)];
@@ -474,14 +445,14 @@ void drawSprites(int scanline) // MOBs
 			{
 				spriterow = (7+(8*yRes)) - spriterow;
 				gaddress = gaddress + spriterow; 
-				gdata  = Memory[gaddress] & 0xFF;
-				gdata2 = Memory[gaddress - (sizeY==0)] & 0xFF;
+				gdata  = MemoryPeek(m, gaddress) & 0xFF;
+				gdata2 = MemoryPeek(m, gaddress - (sizeY==0)) & 0xFF;
 			}
 			else
 			{
 				gaddress = gaddress + spriterow; 
-				gdata  = Memory[gaddress] & 0xFF;
-				gdata2 = Memory[gaddress + (sizeY==0)] & 0xFF;
+				gdata  = MemoryPeek(m, gaddress) & 0xFF;
+				gdata2 = MemoryPeek(m, gaddress + (sizeY==0)) & 0xFF;
 			}
 
 			if(flipX)
@@ -491,7 +462,7 @@ void drawSprites(int scanline) // MOBs
 			}
 
 			// draw sprite row //
-			x = (delayH-16) + (posX * 2); // pixels are 2x2 to accomodate half-height pixels
+			x = (m->stic.delayH-16) + (posX * 2); // pixels are 2x2 to accomodate half-height pixels
 
 			for(j=0; j<2; j++)
 			{
@@ -505,11 +476,11 @@ void drawSprites(int scanline) // MOBs
 					// set collision and collision buffer bits //
 					if((Rx>>8)&1) // if sprite is interactive
 					{
-						collBuffer[x] |= cbit;
-						collBuffer[x+2*sizeX] |= cbit; // for double width
+						m->stic.collBuffer[x] |= cbit;
+						m->stic.collBuffer[x+2*sizeX] |= cbit; // for double width
 					}
 					
-					if(priority && ((collBuffer[x]>>8)&1)) // don't draw if sprite is behind background
+					if(priority && ((m->stic.collBuffer[x]>>8)&1)) // don't draw if sprite is behind background
 					{
 						continue;
 					} 
@@ -517,117 +488,131 @@ void drawSprites(int scanline) // MOBs
 					// draw sprite //
 					if((Rx>>9)&1) // if sprite is visible
 					{
-						scanBuffer[x] = fgcolor;
-						scanBuffer[x+1] = fgcolor;
-						scanBuffer[x+2*sizeX] = fgcolor; // for double width
-						scanBuffer[x+3*sizeX] = fgcolor;
+						m->stic.scanBuffer[x] = fgcolor;
+						m->stic.scanBuffer[x+1] = fgcolor;
+						m->stic.scanBuffer[x+2*sizeX] = fgcolor; // for double width
+						m->stic.scanBuffer[x+3*sizeX] = fgcolor;
 					}
                 }
 				gdata = gdata2;  // for second half-pixel row  //
-				x = (delayH-16) + 384 + (posX * 2); // for second half-pixel row //
+				x = (m->stic.delayH-16) + 384 + (posX * 2); // for second half-pixel row //
 			}
 		}
 	}
 }
 
-void STICDrawFrame(int enabled)
+// ORs this scanline's collisions into the collision registers
+void mergeCollisions(struct Machine *m)
+{
+    int i;
+
+    for (i = 1 * 2; i < 168 * 2; i += 2) {
+        if (m->stic.collBuffer[i] == 0)
+            continue;
+        if (m->stic.collBuffer[i] & 0x01)
+            MemoryPoke(m, 0x18) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x02)
+            MemoryPoke(m, 0x19) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x04)
+            MemoryPoke(m, 0x1a) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x08)
+            MemoryPoke(m, 0x1b) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x10)
+            MemoryPoke(m, 0x1c) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x20)
+            MemoryPoke(m, 0x1d) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x40)
+            MemoryPoke(m, 0x1e) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x80)
+            MemoryPoke(m, 0x1f) |= m->stic.collBuffer[i];
+    }
+    for (i = 1 * 2 + 384; i < 168 * 2 + 384; i += 2) {
+        if (m->stic.collBuffer[i] == 0)
+            continue;
+        if (m->stic.collBuffer[i] & 0x01)
+            MemoryPoke(m, 0x18) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x02)
+            MemoryPoke(m, 0x19) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x04)
+            MemoryPoke(m, 0x1a) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x08)
+            MemoryPoke(m, 0x1b) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x10)
+            MemoryPoke(m, 0x1c) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x20)
+            MemoryPoke(m, 0x1d) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x40)
+            MemoryPoke(m, 0x1e) |= m->stic.collBuffer[i];
+        if (m->stic.collBuffer[i] & 0x80)
+            MemoryPoke(m, 0x1f) |= m->stic.collBuffer[i];
+    }
+}
+
+void STICDrawFrame(struct Machine *m, int enabled)
 {
 	int row, offset;
 	int i;
 
     offset = 0;
     if (enabled == 0) {
+        if (m->stic.hidden)
+            return;
         for (row = 0; row < 112; row++)
         {
-            int color = colors[Memory[0x2C] & 0x0f]; // border color
+            int color = colors[MemoryPeek(m, 0x2C) & 0x0f]; // border color
             
             for(i=0; i<352; i++)
             {
-                scanBuffer[i] = color;
-                scanBuffer[i+384] = color;
+                m->stic.scanBuffer[i] = color;
+                m->stic.scanBuffer[i+384] = color;
             }
-            memcpy(&frame[offset], &scanBuffer[0], 352 * sizeof(unsigned int));
-            memcpy(&frame[offset + 352], &scanBuffer[384], 352 * sizeof(unsigned int));
+            memcpy(&m->stic.frame[offset], &m->stic.scanBuffer[0], 352 * sizeof(unsigned int));
+            memcpy(&m->stic.frame[offset + 352], &m->stic.scanBuffer[384], 352 * sizeof(unsigned int));
             offset += 352 * 2;
         }
     } else {
-        extendTop = (Memory[0x32]>>1)&0x01;
+        m->stic.extendTop = (MemoryPeek(m, 0x32)>>1)&0x01;
         
-        extendLeft = (Memory[0x32])&0x01;
+        m->stic.extendLeft = (MemoryPeek(m, 0x32))&0x01;
         
-        delayV = 8 + ((Memory[0x31])&0x7);
-        delayH = 8 + ((Memory[0x30])&0x7);
+        m->stic.delayV = 8 + ((MemoryPeek(m, 0x31))&0x7);
+        m->stic.delayH = 8 + ((MemoryPeek(m, 0x30))&0x7);
         
-        delayH = delayH * 2;
+        m->stic.delayH = m->stic.delayH * 2;
         
         for(row=0; row<112; row++)
         {
-            memset(&collBuffer[0], 0, sizeof(collBuffer));
+            memset(&m->stic.collBuffer[0], 0, sizeof(m->stic.collBuffer));
             
             // draw backtab
-            if(row>=delayV && row<(96+delayV))
+            if(row>=m->stic.delayV && row<(96+m->stic.delayV))
             {
-                if(STICMode==0) // Foreground/Background Mode
+                if(m->stic.Mode==0) // Foreground/Background Mode
                 {
-                    drawBackgroundFGBG(row-delayV);
+                    drawBackgroundFGBG(m, row-m->stic.delayV);
                 }
                 else // Color Stack Modes
                 {
-                    drawBackgroundColorStack(row-delayV);
+                    drawBackgroundColorStack(m, row-m->stic.delayV);
                 }
             }
             
-            if (row>=delayV - 1 && row<(97 + delayV)) {
+            if (row>=m->stic.delayV - 1 && row<(97 + m->stic.delayV)) {
                 // draw MOBs
-                drawSprites((row-delayV)+8);
+                drawSprites(m, (row-m->stic.delayV)+8);
             }
             
             // draw border and set final collision bits
-            drawBorder(row);
-
-            for (i = 1 * 2; i < 168 * 2; i += 2) {
-                if (collBuffer[i] == 0)
-                    continue;
-                if (collBuffer[i] & 0x01)
-                    Memory[0x18] |= collBuffer[i];
-                if (collBuffer[i] & 0x02)
-                    Memory[0x19] |= collBuffer[i];
-                if (collBuffer[i] & 0x04)
-                    Memory[0x1a] |= collBuffer[i];
-                if (collBuffer[i] & 0x08)
-                    Memory[0x1b] |= collBuffer[i];
-                if (collBuffer[i] & 0x10)
-                    Memory[0x1c] |= collBuffer[i];
-                if (collBuffer[i] & 0x20)
-                    Memory[0x1d] |= collBuffer[i];
-                if (collBuffer[i] & 0x40)
-                    Memory[0x1e] |= collBuffer[i];
-                if (collBuffer[i] & 0x80)
-                    Memory[0x1f] |= collBuffer[i];
-            }
-            for (i = 1 * 2 + 384; i < 168 * 2 + 384; i += 2) {
-                if (collBuffer[i] == 0)
-                    continue;
-                if (collBuffer[i] & 0x01)
-                    Memory[0x18] |= collBuffer[i];
-                if (collBuffer[i] & 0x02)
-                    Memory[0x19] |= collBuffer[i];
-                if (collBuffer[i] & 0x04)
-                    Memory[0x1a] |= collBuffer[i];
-                if (collBuffer[i] & 0x08)
-                    Memory[0x1b] |= collBuffer[i];
-                if (collBuffer[i] & 0x10)
-                    Memory[0x1c] |= collBuffer[i];
-                if (collBuffer[i] & 0x20)
-                    Memory[0x1d] |= collBuffer[i];
-                if (collBuffer[i] & 0x40)
-                    Memory[0x1e] |= collBuffer[i];
-                if (collBuffer[i] & 0x80)
-                    Memory[0x1f] |= collBuffer[i];
+            drawBorder(m, row);
+
+            mergeCollisions(m);
+            if (!m->stic.hidden)
+            {
+                memcpy(&m->stic.frame[offset], &m->stic.scanBuffer[0], 352 * sizeof(unsigned int));
+                memcpy(&m->stic.frame[offset + 352], &m->stic.scanBuffer[384], 352 * sizeof(unsigned int));
             }
-            memcpy(&frame[offset], &scanBuffer[0], 352 * sizeof(unsigned int));
-            memcpy(&frame[offset + 352], &scanBuffer[384], 352 * sizeof(unsigned int));
             offset += 352 * 2;
         }
+        MemoryTouch(m, 0x18); // collision registers
     }
 }
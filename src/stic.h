@@ -18,48 +18,48 @@
 	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-extern unsigned int STICMode; // 0-foreground/background, 1-color stack/color squares 
-
-extern int stic_phase;
-extern int stic_vid_enable;
-extern int stic_reg;
-extern int stic_gram;
-extern int phase_len;
-extern int delayV;
-extern int delayH;
-
-extern int DisplayEnabled; // determines if frame should be updated or not
-
-extern unsigned int frame[352*224]; // frame buffer
-
-struct STICserialized {
-    unsigned int STICMode;
-
-    int stic_phase;
-    int stic_vid_enable;
-    int stic_reg;
-    int stic_gram;
-    int phase_len;
-
-    int DisplayEnabled;
-
-    int delayH;
-    int delayV;
-
-    int extendTop;
-    int extendLeft;
+struct STIC {
+	unsigned int Mode; // 0-foreground/background, 1-color stack/color squares 
+
+	int phase;
+	int vid_enable;
+	int reg;
+	int gram;
+	int phase_len;
+	int delayV; // Vertical Delay
+	int delayH; // Horizontal Delay
+	int extendTop;
+	int extendLeft;
+
+	int DisplayEnabled; // determines if frame should be updated or not
+	int hidden; // frame won't be shown, keep collisions but leave frame[] alone
+
+	unsigned int CSP; // Color Stack Pointer
+	unsigned int fgcard[20]; // cached colors for cards on current row
+	unsigned int bgcard[20]; // (used for normal color stack mode)
+
+	unsigned int scanBuffer[768]; // buffer for current scanline (352+32)*2
+	unsigned int collBuffer[768]; // buffer for collision -- made larger than needed to save checks
+
+	unsigned int frame[352*224]; // frame buffer
+};
 
-    unsigned int CSP;
-    unsigned int fgcard[20];
-    unsigned int bgcard[20];
+struct StateBuffer;
+struct Machine;
 
-    unsigned int frame[352*224];
-};
+// Writes the "STIC" chunk.  The frame buffer and the per-row card caches
+// are rebuilt by the next STICDrawFrame, so they aren't saved.
+void STICSerialize(struct Machine *m, struct StateBuffer *);
+void STICUnserialize(struct Machine *m, struct StateBuffer *);
 
-void STICSerialize(struct STICserialized *);
-void STICUnserialize(const struct STICserialized *);
+void STICDrawFrame(struct Machine *m, int);
+void STICReset(struct Machine *m);
 
-void STICDrawFrame(int);
-void STICReset(void);
+// The scanline steps STICDrawFrame is made of, for tools/microbench.c
+void drawBorder(struct Machine *m, int scanline);
+void drawBackgroundFGBG(struct Machine *m, int scanline);
+void drawBackgroundColorStack(struct Machine *m, int scanline);
+void drawSprites(struct Machine *m, int scanline);
+void mergeCollisions(struct Machine *m);
 
 #endif
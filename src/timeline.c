@@ -0,0 +1,120 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "timeline.h"
+
+struct TimelineEvent {
+	uint64_t ticks;
+	unsigned char type;
+	unsigned char name;
+	unsigned short arg;
+};
+
+static const char *names[TIMELINE_NAMES] = {
+	"frame", "stic phase", "vblank irq", "stic render", "psg catch-up",
+	"ivoice catch-up", "mix", "compositor", "video"
+};
+
+int TimelineRecording;
+
+static struct TimelineEvent *events;
+static unsigned long recorded; // total, the buffer holds the last TIMELINE_EVENTS
+static uint64_t (*ticksNow)(void);
+static int64_t (*usecNow)(void);
+static uint64_t startTicks;
+static int64_t startUsec;
+
+int TimelineStart(uint64_t (*now)(void), int64_t (*usec)(void))
+{
+	TimelineStop();
+	events = (struct TimelineEvent *)malloc(TIMELINE_EVENTS * sizeof(struct TimelineEvent));
+	if (events == NULL)
+		return 0;
+	ticksNow = now;
+	usecNow = usec;
+	startTicks = now();
+	startUsec = usec();
+	recorded = 0;
+	TimelineRecording = 1;
+	return 1;
+}
+
+void TimelineStop(void)
+{
+	TimelineRecording = 0;
+	free(events);
+	events = NULL;
+}
+
+void TimelineRecord(int type, int name, int arg)
+{
+	struct TimelineEvent *e = &events[recorded++ % TIMELINE_EVENTS];
+
+	e->ticks = ticksNow();
+	e->type = (unsigned char)type;
+	e->name = (unsigned char)name;
+	e->arg = (unsigned short)arg;
+}
+
+int TimelineWrite(const char *path)
+{
+	unsigned long first, i;
+	double ticksPerUsec = 1;
+	int64_t usec;
+	uint64_t ticks;
+	int started = 0, comma = 0;
+	FILE *fp;
+
+	if (events == NULL)
+		return 0;
+	fp = fopen(path, "w");
+	if (fp == NULL)
+		return 0;
+
+	// scale by the clocks' rates over the whole recording
+	ticks = ticksNow();
+	usec = usecNow();
+	if (usec > startUsec && ticks > startTicks)
+		ticksPerUsec = (double)(ticks - startTicks) / (double)(usec - startUsec);
+
+	first = recorded > TIMELINE_EVENTS ? recorded - TIMELINE_EVENTS : 0;
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	for (i = first; i < recorded; i++)
+	{
+		struct TimelineEvent *e = &events[i % TIMELINE_EVENTS];
+		double ts = (double)(e->ticks - startTicks) / ticksPerUsec;
+
+		// begin at a whole frame, the ends before it lost their beginnings
+		if (!started)
+		{
+			if (e->type != TIMELINE_BEGIN_EVENT || e->name != TIMELINE_FRAME)
+				continue;
+			started = 1;
+		}
+		fprintf(fp, "%s{\"name\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%.3f,", comma ? ",\n" : "", names[e->name], ts);
+		if (e->type == TIMELINE_MARK_EVENT)
+			fprintf(fp, "\"ph\":\"i\",\"s\":\"t\",\"args\":{\"%s\":%u}}",
+				e->name == TIMELINE_STIC_PHASE ? "phase" : "pc", e->arg);
+		else
+			fprintf(fp, "\"ph\":\"%s\"}", e->type == TIMELINE_BEGIN_EVENT ? "B" : "E");
+		comma = 1;
+	}
+	fprintf(fp, "\n]}\n");
+	return fclose(fp) == 0;
+}
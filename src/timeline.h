@@ -0,0 +1,62 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Frame timeline.  While recording, the core logs timestamped events into
+// a ring buffer allocated up front, so the last few hundred frames can be
+// written out as Chrome trace-event JSON (chrome://tracing, Perfetto) to
+// find the one frame that ran long.  Off, an event costs a test of
+// TimelineRecording.
+#include <stdint.h>
+
+enum TimelineName {
+	TIMELINE_FRAME, // retro_run, up to and including the Video call
+	TIMELINE_STIC_PHASE, // mark, arg is the new stic.phase
+	TIMELINE_VBLANK_IRQ, // mark, the CPU took the interrupt, arg is the PC
+	TIMELINE_STIC_RENDER, // STICDrawFrame
+	TIMELINE_PSG_CATCHUP, // PSGTick for a STIC bus request
+	TIMELINE_IVOICE_CATCHUP, // ivoice_tk for a STIC bus request
+	TIMELINE_MIX, // MixerFrame, the audio callback and PSGFrame
+	TIMELINE_COMPOSITOR, // render_multi_screen
+	TIMELINE_VIDEO, // the frontend's video callback
+	TIMELINE_NAMES
+};
+
+enum TimelineType {
+	TIMELINE_BEGIN_EVENT,
+	TIMELINE_END_EVENT,
+	TIMELINE_MARK_EVENT
+};
+
+#define TIMELINE_EVENTS 65536 // about 12 seconds of frames
+
+extern int TimelineRecording;
+
+// Starts recording with a tick source and a microsecond clock to scale it
+// by, 0 if out of memory.  Restarting drops what was recorded.
+int TimelineStart(uint64_t (*now)(void), int64_t (*usec)(void));
+void TimelineStop(void); // frees the buffer
+void TimelineRecord(int type, int name, int arg);
+int TimelineWrite(const char *path); // the events in the buffer, oldest first; 0 on error
+
+#define TIMELINE_BEGIN(name) (TimelineRecording ? TimelineRecord(TIMELINE_BEGIN_EVENT, (name), 0) : (void)0)
+#define TIMELINE_END(name) (TimelineRecording ? TimelineRecord(TIMELINE_END_EVENT, (name), 0) : (void)0)
+#define TIMELINE_MARK(name, arg) (TimelineRecording ? TimelineRecord(TIMELINE_MARK_EVENT, (name), (arg)) : (void)0)
+
+#endif
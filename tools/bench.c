@@ -0,0 +1,222 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Headless benchmark: links the core directly, runs a ROM for a number of
+// frames and reports emulated frames per second plus where the host time
+// went.  Built by "make bench".
+//
+//   freeintv_bench [-f frames] [-s system_dir] [-i script] [-o key=value]... [rom]
+//
+// rom defaults to the bundled 4-Tris, system_dir (holding exec.bin and
+// grom.bin) to the current directory.  -o sets a core option, e.g.
+// -o freeintv_multiscreen_overlay=enabled to include the compositor.
+// The input script format is in script.h, without one nothing is pressed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/time.h>
+#include "libretro.h"
+#include "perf.h"
+#include "script.h"
+
+#define MAX_OPTIONS 32
+
+static const char *systemDir = ".";
+static const char *optionKeys[MAX_OPTIONS];
+static const char *optionValues[MAX_OPTIONS];
+static int options;
+
+static struct Script script;
+static int frame;
+
+static volatile long samples[PERF_PHASES];
+
+static void onSample(int sig)
+{
+	(void)sig;
+	samples[PerfPhase]++;
+}
+
+static bool environment(unsigned cmd, void *data)
+{
+	int i;
+
+	switch (cmd)
+	{
+		case RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY:
+			*(const char **)data = systemDir;
+			return true;
+		case RETRO_ENVIRONMENT_GET_VARIABLE:
+		{
+			struct retro_variable *var = (struct retro_variable *)data;
+
+			for (i = 0; i < options; i++)
+			{
+				if (strcmp(var->key, optionKeys[i]) == 0)
+				{
+					var->value = optionValues[i];
+					return true;
+				}
+			}
+			var->value = NULL;
+			return false;
+		}
+		case RETRO_ENVIRONMENT_GET_INPUT_BITMASKS:
+		case RETRO_ENVIRONMENT_SET_PIXEL_FORMAT:
+			return true;
+	}
+	return false;
+}
+
+static void video(const void *data, unsigned width, unsigned height, size_t pitch)
+{
+	(void)data; (void)width; (void)height; (void)pitch;
+}
+
+static void audio(int16_t left, int16_t right)
+{
+	(void)left; (void)right;
+}
+
+static size_t audioBatch(const int16_t *data, size_t frames)
+{
+	(void)data;
+	return frames;
+}
+
+static void inputPoll(void)
+{
+}
+
+static int16_t inputState(unsigned port, unsigned device, unsigned index, unsigned id)
+{
+	int mask;
+
+	(void)index;
+	if (device != RETRO_DEVICE_JOYPAD)
+		return 0;
+	mask = ScriptMask(&script, frame, port);
+	if (id == RETRO_DEVICE_ID_JOYPAD_MASK)
+		return (int16_t)mask;
+	return (mask >> id) & 1;
+}
+
+static double seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+	const char *rom = "open-content/4-Tris/4-tris.bin";
+	int frames = 3600;
+	int i;
+	long total;
+	double start, elapsed;
+	struct retro_game_info game;
+	struct retro_system_av_info av;
+	struct itimerval timer;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			systemDir = argv[++i];
+		else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+		{
+			if (!ScriptLoad(&script, argv[++i]))
+			{
+				fprintf(stderr, "can't read input script %s\n", argv[i]);
+				return 1;
+			}
+		}
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc && strchr(argv[i + 1], '=') && options < MAX_OPTIONS)
+		{
+			char *eq = strchr(argv[++i], '=');
+
+			*eq = '\0';
+			optionKeys[options] = argv[i];
+			optionValues[options++] = eq + 1;
+		}
+		else if (argv[i][0] != '-')
+			rom = argv[i];
+		else
+		{
+			fprintf(stderr, "usage: %s [-f frames] [-s system_dir] [-i script] [-o key=value]... [rom]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	retro_set_environment(environment);
+	retro_set_video_refresh(video);
+	retro_set_audio_sample(audio);
+	retro_set_audio_sample_batch(audioBatch);
+	retro_set_input_poll(inputPoll);
+	retro_set_input_state(inputState);
+	retro_init();
+
+	memset(&game, 0, sizeof(game));
+	game.path = rom;
+	if (!retro_load_game(&game))
+	{
+		fprintf(stderr, "can't load %s\n", rom);
+		retro_deinit();
+		return 1;
+	}
+	retro_get_system_av_info(&av);
+
+	signal(SIGPROF, onSample);
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = 100;
+	timer.it_value = timer.it_interval;
+	setitimer(ITIMER_PROF, &timer, NULL);
+
+	start = seconds();
+	for (frame = 0; frame < frames; frame++)
+		retro_run();
+	elapsed = seconds() - start;
+
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+
+	printf("%s: %d frames in %.3f s, %.1f fps (%.2fx real time)\n", rom, frames, elapsed,
+		frames / elapsed, frames / elapsed / av.timing.fps);
+
+	total = 0;
+	for (i = 0; i < PERF_PHASES; i++)
+		total += samples[i];
+	if (total > 0)
+	{
+		printf("%-12s %7s %10s\n", "phase", "share", "ms/frame");
+		for (i = 0; i < PERF_PHASES; i++)
+			printf("%-12s %6.1f%% %10.4f\n", PerfPhaseNames[i], 100.0 * samples[i] / total,
+				1000.0 * elapsed * samples[i] / total / frames);
+	}
+
+	retro_unload_game();
+	retro_deinit();
+	ScriptFree(&script);
+	return 0;
+}
@@ -0,0 +1,416 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Lockstep checker: runs the reference interpreter (exec() around
+// CP1610Tick) next to a candidate engine, one instruction at a time, and
+// stops at the first difference in registers, flags or the writes an
+// instruction made.  At the end of each frame it also compares memory, the
+// frame buffer and the mixed audio.  On a divergence it prints the last
+// instructions the reference ran as a jzIntv-style trace.  Built by "make
+// lockstep".
+//
+//   freeintv_lockstep [-f frames] [-s system_dir] [-i script] [-e engine]
+//                     [-n trace_lines] [-F] [rom]
+//
+// -F only compares at the end of each frame, for engines that don't stop
+// at the same instruction boundaries.  Without -e every engine is checked.
+// A new CPU, STIC or PSG engine gets an entry in engines[] and has to pass
+// here before it's used by the core.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intv.h"
+#include "cart.h"
+#include "controller.h"
+#include "mixer.h"
+#include "psg.h"
+#include "state.h"
+#include "script.h"
+
+#define MAX_PATH 1024
+#define MAX_TRACE 4096
+
+struct Engine {
+	const char *name;
+	const char *about;
+	struct Machine *(*create)(void);
+	int (*step)(struct Machine *m); // one instruction, 0 at the end of a frame
+	struct Machine *(*frame)(struct Machine *m); // between frames, may hand back another machine, or NULL
+};
+
+struct TraceEntry {
+	struct CP1610 cpu;
+	int instruction;
+	int sr1;
+	long count;
+};
+
+static char execPath[MAX_PATH];
+static char gromPath[MAX_PATH];
+static const char *romPath = "open-content/4-Tris/4-tris.bin";
+
+static struct TraceEntry trace[MAX_TRACE];
+static int traceLines = 16;
+static long instructions;
+
+static struct Machine *boot(void)
+{
+	struct Machine *m = MachineCreate();
+
+	if (m == NULL || !loadExec(m, execPath) || !loadGrom(m, gromPath) || !LoadCart(m, romPath))
+	{
+		MachineDestroy(m);
+		return NULL;
+	}
+	MemoryTouchAll(m);
+	return m;
+}
+
+// A copy of a machine sharing its ROM pages, as BatchCreate() makes them
+static struct Machine *bootClone(void)
+{
+	struct Machine *seed = boot();
+	struct Machine *m;
+
+	if (seed == NULL || !MemoryShare(seed))
+	{
+		MachineDestroy(seed);
+		return NULL;
+	}
+	m = MachineClone(seed);
+	MachineDestroy(seed);
+	return m;
+}
+
+// Every frame the machine is saved and loaded into a second one, which
+// carries on in its place
+static struct Machine *spare;
+static uint8_t *stateData;
+static size_t stateSize;
+
+static struct Machine *bootState(void)
+{
+	spare = boot();
+	return spare ? boot() : NULL;
+}
+
+static struct Machine *reload(struct Machine *m)
+{
+	struct StateBuffer state;
+	struct Machine *next = spare;
+
+	StateWriteBegin(&state, NULL, 0);
+	SerializeMachine(m, &state, 1);
+	if (state.pos > stateSize)
+	{
+		free(stateData);
+		stateSize = state.pos;
+		stateData = (uint8_t *)malloc(stateSize);
+		if (stateData == NULL)
+		{
+			stateSize = 0;
+			fprintf(stderr, "out of memory\n");
+			return NULL;
+		}
+	}
+	StateWriteBegin(&state, stateData, stateSize);
+	SerializeMachine(m, &state, 1);
+	if (state.error || !StateReadBegin(&state, stateData, state.pos) || !UnserializeMachine(next, &state, 1))
+	{
+		fprintf(stderr, "save state round trip failed\n");
+		return NULL;
+	}
+	// the resampler history is the frontend's, it isn't in a state
+	next->mixer = m->mixer;
+	spare = m;
+	return next;
+}
+
+static const struct Engine engines[] = {
+	{ "interp", "the reference interpreter again, for determinism", boot, exec, NULL },
+	{ "clone", "a clone sharing copy-on-write ROM pages", bootClone, exec, NULL },
+	{ "state", "moved through a save state every frame", bootState, exec, reload },
+};
+
+#define ENGINES (int)(sizeof(engines) / sizeof(engines[0]))
+
+static void record(struct Machine *m)
+{
+	struct TraceEntry *t = &trace[instructions % traceLines];
+
+	t->cpu = m->cpu;
+	t->instruction = MemoryPeek(m, m->cpu.R[7] & 0xFFFF);
+	t->sr1 = m->SR1;
+	t->count = instructions;
+}
+
+static void printEntry(const char *who, const struct CP1610 *cpu, int instruction, int sr1, long count)
+{
+	char line[CP1610_TRACE_LINE];
+
+	CP1610Trace(cpu, instruction, sr1, count, line, sizeof(line));
+	printf("%-9s%s", who, line);
+}
+
+static void printMachine(const char *who, struct Machine *m)
+{
+	printEntry(who, &m->cpu, MemoryPeek(m, m->cpu.R[7] & 0xFFFF), m->SR1, instructions);
+}
+
+static void printWrites(const char *who, struct Machine *m)
+{
+	int i;
+
+	printf("%-9s%d write%s", who, m->MemoryWriteCount, m->MemoryWriteCount == 1 ? "" : "s");
+	for (i = 0; i < m->MemoryWriteCount && i < MEMORY_WRITE_LOG; i++)
+		printf(" %04X=%04X", m->MemoryWrites[i].adr & 0xFFFF, m->MemoryWrites[i].val & 0xFFFF);
+	printf("\n");
+}
+
+static void diverged(const struct Engine *e, int frame, const char *what, struct Machine *ref, struct Machine *cand)
+{
+	long i, first = instructions - traceLines + 1;
+
+	printf("\n%s: diverged in frame %d, instruction %ld: %s\n", e->name, frame, instructions, what);
+	printf("last instructions on the reference:\n");
+	for (i = first < 0 ? 0 : first; i <= instructions; i++)
+	{
+		struct TraceEntry *t = &trace[i % traceLines];
+
+		if (t->count == i)
+			printEntry("", &t->cpu, t->instruction, t->sr1, t->count);
+	}
+	printf("after it:\n");
+	printMachine("ref", ref);
+	printMachine(e->name, cand);
+	printWrites("ref", ref);
+	printWrites(e->name, cand);
+}
+
+static int sameCpu(struct Machine *a, struct Machine *b)
+{
+	return memcmp(&a->cpu, &b->cpu, sizeof(a->cpu)) == 0 && a->SR1 == b->SR1 && a->halt == b->halt;
+}
+
+static int sameWrites(struct Machine *a, struct Machine *b)
+{
+	int n = a->MemoryWriteCount < MEMORY_WRITE_LOG ? a->MemoryWriteCount : MEMORY_WRITE_LOG;
+
+	return a->MemoryWriteCount == b->MemoryWriteCount &&
+		memcmp(a->MemoryWrites, b->MemoryWrites, n * sizeof(struct MemoryWrite)) == 0;
+}
+
+// Frame end checks, describes the first difference in what
+static int sameFrame(struct Machine *ref, struct Machine *cand, const int16_t *refAudio, const int16_t *candAudio, char *what, int size)
+{
+	int i;
+
+	for (i = 0; i < 0x10000; i++)
+	{
+		if (MemoryPeek(ref, i) != MemoryPeek(cand, i))
+		{
+			snprintf(what, size, "memory at %04X: %04X vs %04X", i, MemoryPeek(ref, i), MemoryPeek(cand, i));
+			return 0;
+		}
+	}
+	for (i = 0; i < 352 * 224; i++)
+	{
+		if (ref->stic.frame[i] != cand->stic.frame[i])
+		{
+			snprintf(what, size, "pixel %d,%d: %06X vs %06X", i % 352, i / 352, ref->stic.frame[i], cand->stic.frame[i]);
+			return 0;
+		}
+	}
+	for (i = 0; i < MixerSamples * 2; i++)
+	{
+		if (refAudio[i] != candAudio[i])
+		{
+			snprintf(what, size, "audio sample %d: %d vs %d", i, refAudio[i], candAudio[i]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// 1 if the engine kept up with the reference for frames
+static int check(const struct Engine *e, struct Script *script, int frames, int perFrame)
+{
+	struct Machine *ref = boot();
+	struct Machine *cand = e->create();
+	int16_t refAudio[MIXER_MAX_SAMPLES * 2];
+	int16_t candAudio[MIXER_MAX_SAMPLES * 2];
+	int joypad[20];
+	char what[128];
+	int frame, port, r, c, ok = 0;
+
+	instructions = 0;
+	memset(trace, 0, sizeof(trace));
+	script->pos = 0;
+	if (ref == NULL || cand == NULL)
+	{
+		fprintf(stderr, "%s: can't start %s\n", e->name, romPath);
+		goto done;
+	}
+
+	for (frame = 0; frame < frames; frame++)
+	{
+		for (port = 0; port < 2; port++)
+		{
+			ScriptJoypad(ScriptMask(script, frame, port), joypad);
+			setControllerInput(ref, port, getControllerState(joypad, port));
+			setControllerInput(cand, port, getControllerState(joypad, port));
+		}
+
+		if (perFrame)
+		{
+			while (exec(ref))
+				instructions++;
+			while (e->step(cand))
+				;
+			if (!sameCpu(ref, cand))
+			{
+				diverged(e, frame, "registers at the end of the frame", ref, cand);
+				goto done;
+			}
+		}
+		else
+		{
+			do
+			{
+				record(ref);
+				ref->MemoryWriteCount = 0;
+				cand->MemoryWriteCount = 0;
+				r = exec(ref);
+				c = e->step(cand);
+				if (r != c || !sameCpu(ref, cand))
+				{
+					diverged(e, frame, "registers", ref, cand);
+					goto done;
+				}
+				if (!sameWrites(ref, cand))
+				{
+					diverged(e, frame, "writes", ref, cand);
+					goto done;
+				}
+				instructions++;
+			} while (r);
+		}
+
+		MixerFrame(ref, refAudio);
+		PSGFrame(ref);
+		MixerFrame(cand, candAudio);
+		PSGFrame(cand);
+		if (!sameFrame(ref, cand, refAudio, candAudio, what, sizeof(what)))
+		{
+			diverged(e, frame, what, ref, cand);
+			goto done;
+		}
+		if (ref->halt)
+			break;
+
+		if (e->frame)
+		{
+			struct Machine *next = e->frame(cand);
+
+			if (next == NULL)
+				goto done;
+			cand = next;
+		}
+	}
+	printf("%s: %d frames, %ld instructions in lockstep\n", e->name, frame < frames ? frame + 1 : frames, instructions);
+	ok = 1;
+
+done:
+	MachineDestroy(ref);
+	MachineDestroy(cand);
+	MachineDestroy(spare);
+	spare = NULL;
+	free(stateData);
+	stateData = NULL;
+	stateSize = 0;
+	return ok;
+}
+
+int main(int argc, char **argv)
+{
+	const char *systemDir = ".";
+	const char *engine = NULL;
+	struct Script script;
+	int frames = 600;
+	int perFrame = 0;
+	int i, failed = 0, found = 0;
+
+	memset(&script, 0, sizeof(script));
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			systemDir = argv[++i];
+		else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+		{
+			if (!ScriptLoad(&script, argv[++i]))
+			{
+				fprintf(stderr, "can't read input script %s\n", argv[i]);
+				return 2;
+			}
+		}
+		else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+			engine = argv[++i];
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			traceLines = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-F") == 0)
+			perFrame = 1;
+		else if (argv[i][0] != '-')
+			romPath = argv[i];
+		else
+		{
+			fprintf(stderr, "usage: %s [-f frames] [-s system_dir] [-i script] [-e engine] [-n trace_lines] [-F] [rom]\n", argv[0]);
+			fprintf(stderr, "engines:\n");
+			for (i = 0; i < ENGINES; i++)
+				fprintf(stderr, "  %-8s %s\n", engines[i].name, engines[i].about);
+			return 2;
+		}
+	}
+	if (traceLines < 1)
+		traceLines = 1;
+	if (traceLines > MAX_TRACE)
+		traceLines = MAX_TRACE;
+	snprintf(execPath, sizeof(execPath), "%s/exec.bin", systemDir);
+	snprintf(gromPath, sizeof(gromPath), "%s/grom.bin", systemDir);
+
+	CP1610Init();
+	MixerInit(MIXER_DEFAULT_RATE);
+
+	for (i = 0; i < ENGINES; i++)
+	{
+		if (engine && strcmp(engine, engines[i].name) != 0)
+			continue;
+		found = 1;
+		if (!check(&engines[i], &script, frames, perFrame))
+			failed = 1;
+	}
+	if (!found)
+	{
+		fprintf(stderr, "no engine %s\n", engine);
+		failed = 1;
+	}
+	ScriptFree(&script);
+	return failed;
+}
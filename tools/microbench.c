@@ -0,0 +1,487 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Microbenchmarks for the hot kernels, each run on its own against a
+// machine set up with synthetic data, so a regression can be pinned on a
+// layer without running a game.  Built by "make microbench".
+//
+//   freeintv_microbench [-t ms] [filter]
+//
+// Runs every benchmark whose group or name contains filter, each for
+// about ms milliseconds (default 100), and prints the best of five runs in
+// ns per op.  On Linux the cache references and misses per op are read
+// from the hardware counters too, where the kernel allows it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "intv.h"
+#include "memory.h"
+#include "cp1610.h"
+#include "stic.h"
+#include "psg.h"
+#include "ivoice.h"
+#include "blit.h"
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#define PROGRAM 0x5000 // write protected, so MVOI can't change the program
+#define BLOCK 64 // instructions per CPU run
+
+struct Bench {
+	const char *group;
+	char name[32];
+	void (*setup)(int arg);
+	long (*run)(int arg); // returns the ops done
+	int arg;
+};
+
+static struct Machine *m;
+
+static struct Bench benches[256];
+static int benchCount;
+
+static unsigned int seed = 12345;
+
+static unsigned int rnd(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static void add(const char *group, const char *name, void (*setup)(int), long (*run)(int), int arg)
+{
+	struct Bench *b = &benches[benchCount++];
+
+	b->group = group;
+	snprintf(b->name, sizeof(b->name), "%s", name);
+	b->setup = setup;
+	b->run = run;
+	b->arg = arg;
+}
+
+/* CPU: a block of one instruction class, run from PROGRAM */
+
+static void setupCPU(int op)
+{
+	int a = PROGRAM, i;
+	const char *name = Nmemonic[op];
+
+	for (i = 0; i < BLOCK; i++)
+	{
+		MemoryPoke(m, a) = op;
+		a++;
+		if (strncmp(name, "Jump", 4) == 0)
+		{
+			// J to the next instruction
+			MemoryPoke(m, a) = 0x300 | (((a + 2) >> 10) << 2);
+			MemoryPoke(m, a + 1) = (a + 2) & 0x3FF;
+			a += 2;
+		}
+		else if (strncmp(name, "Branch", 6) == 0 || (op >= 0x240 && (op & 0x38) == 0x00) || (op >= 0x240 && (op & 0x38) == 0x38))
+		{
+			// branch offset 0, direct address or immediate operand
+			MemoryPoke(m, a) = (op >= 0x240 && (op & 0x38) == 0x00) ? 0x0200 : 0;
+			a++;
+		}
+	}
+	m->cpu.Flag_InteruptEnable = 0;
+	m->cpu.Flag_DoubleByteData = 0;
+	m->SR1 = 0;
+}
+
+static long runCPU(int op)
+{
+	int i;
+
+	(void)op;
+	m->cpu.R[7] = PROGRAM;
+	m->cpu.R[1] = 0x0200; // @R1 points at BACKTAB
+	m->cpu.R[6] = 0x02F0; // stack
+	for (i = 0; i < BLOCK; i++)
+		CP1610Tick(m, 0);
+	return BLOCK;
+}
+
+/* STIC: the scanline steps of STICDrawFrame */
+
+static void setupSTIC(int mode)
+{
+	int i;
+
+	for (i = 0x3000; i < 0x3A00; i++)
+		MemoryPoke(m, i) = rnd() & 0xFF; // GROM and GRAM
+	for (i = 0x200; i < 0x2F0; i++)
+		MemoryPoke(m, i) = rnd() & 0x3FFF; // BACKTAB
+	for (i = 0; i < 0x18; i++)
+		MemoryPoke(m, i) = 0; // no MOBs
+	for (i = 0x28; i < 0x2D; i++)
+		MemoryPoke(m, i) = rnd() & 0x0F; // color stack, border
+	m->stic.Mode = mode;
+	m->stic.delayV = 8;
+	m->stic.delayH = 16;
+	m->stic.extendTop = 0;
+	m->stic.extendLeft = 0;
+}
+
+static long runBackground(int mode)
+{
+	int row;
+
+	m->stic.CSP = 0x28;
+	for (row = 0; row < 96; row++)
+	{
+		if (mode == 0)
+			drawBackgroundFGBG(m, row);
+		else
+			drawBackgroundColorStack(m, row);
+	}
+	return 96;
+}
+
+static long runBorder(int arg)
+{
+	int row;
+
+	(void)arg;
+	for (row = 0; row < 112; row++)
+		drawBorder(m, row);
+	return 112;
+}
+
+// arg is the MOB count times 2, plus 1 for big (double width, quad height)
+static void setupSprites(int arg)
+{
+	int count = arg >> 1, big = arg & 1, i;
+
+	setupSTIC(1);
+	for (i = 0; i < count; i++)
+	{
+		MemoryPoke(m, 0x00 + i) = 0x300 | (big << 10) | (8 + i * 18); // visible, interactive, x
+		MemoryPoke(m, 0x08 + i) = (big ? 0x300 : 0x100) | (8 + i * 9); // size, y
+		MemoryPoke(m, 0x10 + i) = (i * 8) | (i & 7); // card, color
+	}
+}
+
+static long runSprites(int arg)
+{
+	int row;
+
+	(void)arg;
+	memset(m->stic.collBuffer, 0, sizeof(m->stic.collBuffer));
+	for (row = 8; row < 8 + 97; row++)
+		drawSprites(m, row);
+	return 97;
+}
+
+static void setupCollisions(int busy)
+{
+	int i;
+
+	for (i = 0; i < 768; i++)
+		m->stic.collBuffer[i] = busy ? (rnd() & rnd() & 0x3FF) : 0;
+}
+
+static long runCollisions(int arg)
+{
+	(void)arg;
+	mergeCollisions(m);
+	return 1;
+}
+
+/* PSG */
+
+static void setupPSG(int config)
+{
+	static const int regs[][14] = {
+		// 1F0-1F7 periods, 1F8 enables, 1F9 noise, 1FA envelope, 1FB-1FD volumes
+		{ 0x40, 0x50, 0x60, 0, 0, 0, 0, 0, 0x38, 0, 0, 0x0F, 0x0F, 0x0F }, // tones
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 0x07, 0x05, 0, 0x0F, 0x0F, 0x0F }, // noise
+		{ 0x40, 0x50, 0x60, 0x10, 0, 0, 0, 0, 0x38, 0, 0x0E, 0x30, 0x30, 0x30 }, // enveloped tones
+		{ 0x40, 0x50, 0x60, 0x10, 0, 0, 0, 0, 0x00, 0x05, 0x0A, 0x30, 0x0F, 0x20 }, // everything
+	};
+	int i;
+
+	for (i = 0; i < 14; i++)
+		writeMem(m, 0x1F0 + i, regs[config][i]);
+	m->psg.Hidden = 0;
+}
+
+static long runPSG(int config)
+{
+	(void)config;
+	PSGFrame(m);
+	PSGTick(m, 4 * 1024);
+	return 1024; // samples
+}
+
+/* Intellivoice LPC filter */
+
+static lpc12_t lpc;
+static int16_t speech[SCBUF_SIZE];
+
+static void setupLPC(int voiced)
+{
+	int i;
+
+	memset(&lpc, 0, sizeof(lpc));
+	for (i = 0; i < 6; i++)
+	{
+		lpc.f_coef[i] = (int16_t)((rnd() & 0x1FF) - 0x100);
+		lpc.b_coef[i] = (int16_t)((rnd() & 0x0FF) - 0x80);
+	}
+	lpc.per = voiced ? 80 : 0;
+	lpc.amp = 0x200;
+	lpc.rng = 1;
+}
+
+static long runLPC(int voiced)
+{
+	uint32_t optr = 0;
+
+	(void)voiced;
+	lpc.rpt = 1 << 20;
+	lpc.cnt = 1;
+	return ivoice_lpc12_update(&lpc, 1024, speech, &optr);
+}
+
+/* Compositor */
+
+#define WORK_WIDTH 1074
+
+static uint32_t blitSrc[352 * 224];
+static uint32_t blitDst[704 * 448];
+static uint32_t rowUnder[WORK_WIDTH], rowOver[WORK_WIDTH], rowOut[WORK_WIDTH];
+
+static void setupBlit(int opaque)
+{
+	int i;
+
+	for (i = 0; i < 352 * 224; i++)
+		blitSrc[i] = 0xFF000000 | (rnd() << 8) | (rnd() & 0xFF);
+	for (i = 0; i < WORK_WIDTH; i++)
+	{
+		rowUnder[i] = 0xFF000000 | rnd();
+		// a mix of transparent, blended and opaque pixels unless opaque
+		rowOver[i] = (opaque ? 0xFF000000 : ((uint32_t)(rnd() % 3) * 0x7F000000u + 0x01000000u * (rnd() & 1))) | (rnd() & 0xFFFFFF);
+	}
+}
+
+static long runScale2x(int arg)
+{
+	(void)arg;
+	BlitScale2x(blitDst, 704, blitSrc, 352, 224);
+	return 352 * 224; // source pixels
+}
+
+static long runBlend(int arg)
+{
+	int i;
+
+	(void)arg;
+	for (i = 0; i < 64; i++)
+		BlitBlendRow(rowOut, rowUnder, rowOver, WORK_WIDTH);
+	return 64 * WORK_WIDTH;
+}
+
+/* Timing */
+
+static double seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+#ifdef __linux__
+static int cacheRefs = -1, cacheMisses = -1;
+
+static int openCounter(int config, int group)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.disabled = group < 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void countersOpen(void)
+{
+	cacheRefs = openCounter(PERF_COUNT_HW_CACHE_REFERENCES, -1);
+	if (cacheRefs >= 0)
+		cacheMisses = openCounter(PERF_COUNT_HW_CACHE_MISSES, cacheRefs);
+	if (cacheMisses < 0 && cacheRefs >= 0)
+	{
+		close(cacheRefs);
+		cacheRefs = -1;
+	}
+}
+
+static void countersStart(void)
+{
+	if (cacheRefs < 0)
+		return;
+	ioctl(cacheRefs, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(cacheRefs, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+// 0 if the counters aren't available
+static int countersStop(long long *refs, long long *misses)
+{
+	if (cacheRefs < 0)
+		return 0;
+	ioctl(cacheRefs, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	return read(cacheRefs, refs, sizeof(*refs)) == sizeof(*refs) &&
+		read(cacheMisses, misses, sizeof(*misses)) == sizeof(*misses);
+}
+#else
+static void countersOpen(void) { }
+static void countersStart(void) { }
+static int countersStop(long long *refs, long long *misses) { (void)refs; (void)misses; return 0; }
+#endif
+
+static void measure(struct Bench *b, double budget)
+{
+	long ops, iterations, i;
+	double start, elapsed, best = 0;
+	long long refs = 0, misses = 0;
+	int trial, counted;
+
+	b->setup(b->arg);
+
+	// find how many runs fill a fifth of the budget
+	iterations = 1;
+	for (;;)
+	{
+		start = seconds();
+		for (i = 0; i < iterations; i++)
+			b->run(b->arg);
+		elapsed = seconds() - start;
+		if (elapsed >= budget / 5 / 4 || iterations > (1L << 30))
+			break;
+		iterations *= 2;
+	}
+	iterations = (long)(iterations * (budget / 5) / (elapsed > 0 ? elapsed : 1e-9)) + 1;
+
+	for (trial = 0; trial < 5; trial++)
+	{
+		ops = 0;
+		start = seconds();
+		for (i = 0; i < iterations; i++)
+			ops += b->run(b->arg);
+		elapsed = seconds() - start;
+		if (trial == 0 || elapsed * 1e9 / ops < best)
+			best = elapsed * 1e9 / ops;
+	}
+
+	countersStart();
+	ops = 0;
+	for (i = 0; i < iterations; i++)
+		ops += b->run(b->arg);
+	counted = countersStop(&refs, &misses);
+
+	if (counted)
+		printf("%-10s %-22s %10.2f %10.3f %10.4f\n", b->group, b->name, best, (double)refs / ops, (double)misses / ops);
+	else
+		printf("%-10s %-22s %10.2f %10s %10s\n", b->group, b->name, best, "-", "-");
+}
+
+int main(int argc, char **argv)
+{
+	const char *filter = "";
+	double budget = 0.1;
+	char name[32];
+	int i, op, n;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			budget = atoi(argv[++i]) / 1000.0;
+		else if (argv[i][0] != '-')
+			filter = argv[i];
+		else
+		{
+			fprintf(stderr, "usage: %s [-t ms] [filter]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	m = MachineCreate();
+	if (m == NULL)
+		return 1;
+
+	// one benchmark per opcode class, from the first opcode of each run
+	// of equal names in the table, HLT left out
+	for (op = 1; op < 0x400; op++)
+	{
+		if (strcmp(Nmemonic[op], Nmemonic[op - 1]) == 0)
+			continue;
+		for (n = 0; Nmemonic[op][n] && Nmemonic[op][n] != ' ' && n < (int)sizeof(name) - 1; n++)
+			name[n] = Nmemonic[op][n];
+		name[n] = '\0';
+		add("cpu", name, setupCPU, runCPU, op);
+	}
+	add("stic", "background fgbg", setupSTIC, runBackground, 0);
+	add("stic", "background colorstack", setupSTIC, runBackground, 1);
+	add("stic", "border", setupSTIC, runBorder, 1);
+	for (n = 0; n <= 8; n += 4)
+	{
+		snprintf(name, sizeof(name), "sprites %d small", n);
+		add("stic", name, setupSprites, runSprites, n * 2);
+		if (n > 0)
+		{
+			snprintf(name, sizeof(name), "sprites %d big", n);
+			add("stic", name, setupSprites, runSprites, n * 2 + 1);
+		}
+	}
+	add("stic", "collisions none", setupCollisions, runCollisions, 0);
+	add("stic", "collisions busy", setupCollisions, runCollisions, 1);
+	add("psg", "tones", setupPSG, runPSG, 0);
+	add("psg", "noise", setupPSG, runPSG, 1);
+	add("psg", "envelope", setupPSG, runPSG, 2);
+	add("psg", "everything", setupPSG, runPSG, 3);
+	add("ivoice", "lpc12 voiced", setupLPC, runLPC, 1);
+	add("ivoice", "lpc12 noise", setupLPC, runLPC, 0);
+	add("blit", "scale2x", setupBlit, runScale2x, 0);
+	add("blit", "blend row", setupBlit, runBlend, 0);
+	add("blit", "blend row opaque", setupBlit, runBlend, 1);
+
+	countersOpen();
+	printf("%-10s %-22s %10s %10s %10s\n", "group", "benchmark", "ns/op", "refs/op", "misses/op");
+	for (i = 0; i < benchCount; i++)
+	{
+		if (strstr(benches[i].group, filter) || strstr(benches[i].name, filter))
+			measure(&benches[i], budget);
+	}
+
+	MachineDestroy(m);
+	return 0;
+}
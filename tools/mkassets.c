@@ -0,0 +1,186 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Asset compiler: decodes PNGs at build time and writes them out as a C
+// header of struct Asset (see asset.h).  Run by "make assets", which
+// regenerates src/asset_data.h from Assets/.
+//
+//   freeintv_mkassets output.h name=image.png...
+//
+// Each image is run-length coded in the format AssetDecode() reads,
+// unless that is bigger than the PNG, in which case the PNG is kept and
+// decoded by stb_image in the core instead.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+static unsigned char *readFile(const char *path, long *size)
+{
+	FILE *fp = fopen(path, "rb");
+	unsigned char *data = NULL;
+
+	if (fp == NULL)
+		return NULL;
+	if (fseek(fp, 0, SEEK_END) == 0 && (*size = ftell(fp)) > 0 && fseek(fp, 0, SEEK_SET) == 0)
+	{
+		data = (unsigned char *)malloc(*size);
+		if (data && fread(data, 1, *size, fp) != (size_t)*size)
+		{
+			free(data);
+			data = NULL;
+		}
+	}
+	fclose(fp);
+	return data;
+}
+
+static unsigned char *putPixel(unsigned char *out, uint32_t pixel)
+{
+	*out++ = pixel >> 24;
+	*out++ = pixel >> 16;
+	*out++ = pixel >> 8;
+	*out++ = pixel;
+	return out;
+}
+
+// Returns the coded length, out needs room for 5 bytes per pixel
+static long encodeRLE(unsigned char *out, const uint32_t *pixels, long count)
+{
+	unsigned char *start = out;
+	long i = 0, run, n;
+
+	while (i < count)
+	{
+		for (run = 1; i + run < count && run < 128 && pixels[i + run] == pixels[i]; run++);
+		if (run > 1)
+		{
+			*out++ = 0x7F + run;
+			out = putPixel(out, pixels[i]);
+			i += run;
+			continue;
+		}
+		// literal up to the next pair of equal pixels
+		for (n = 1; i + n < count && n < 128; n++)
+		{
+			if (i + n + 1 < count && pixels[i + n] == pixels[i + n + 1])
+				break;
+		}
+		*out++ = n - 1;
+		for (; n > 0; n--)
+			out = putPixel(out, pixels[i++]);
+	}
+	return out - start;
+}
+
+static void writeBytes(FILE *fp, const char *name, const unsigned char *data, long size)
+{
+	long i;
+
+	fprintf(fp, "static const unsigned char %s_data[] = {", name);
+	for (i = 0; i < size; i++)
+		fprintf(fp, "%s0x%02x,", i % 16 ? " " : "\n\t", data[i]);
+	fprintf(fp, "\n};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	FILE *fp;
+	unsigned char *png, *rgba, *rle, *p;
+	uint32_t *pixels;
+	long pngSize, rleSize, count, i;
+	int width, height, channels, arg;
+	char name[64];
+	const char *path, *eq;
+
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s output.h name=image.png...\n", argv[0]);
+		return 1;
+	}
+	fp = fopen(argv[1], "w");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "can't write %s\n", argv[1]);
+		return 1;
+	}
+	fprintf(fp, "// Generated by tools/mkassets.c, \"make assets\" rebuilds it.  Don't edit.\n");
+	fprintf(fp, "#ifndef ASSET_DATA_H\n#define ASSET_DATA_H\n#include \"asset.h\"\n\n");
+
+	for (arg = 2; arg < argc; arg++)
+	{
+		eq = strchr(argv[arg], '=');
+		if (eq == NULL || eq == argv[arg] || eq - argv[arg] >= (long)sizeof(name))
+		{
+			fprintf(stderr, "expected name=image.png, not %s\n", argv[arg]);
+			fclose(fp);
+			return 1;
+		}
+		memcpy(name, argv[arg], eq - argv[arg]);
+		name[eq - argv[arg]] = '\0';
+		path = eq + 1;
+
+		png = readFile(path, &pngSize);
+		rgba = png ? stbi_load_from_memory(png, (int)pngSize, &width, &height, &channels, 4) : NULL;
+		if (rgba == NULL)
+		{
+			fprintf(stderr, "can't read %s\n", path);
+			free(png);
+			fclose(fp);
+			return 1;
+		}
+		count = (long)width * height;
+		pixels = (uint32_t *)malloc(count * sizeof(uint32_t));
+		rle = (unsigned char *)malloc(count * 5);
+		if (pixels == NULL || rle == NULL)
+		{
+			fprintf(stderr, "out of memory\n");
+			fclose(fp);
+			return 1;
+		}
+		for (i = 0, p = rgba; i < count; i++, p += 4)
+			pixels[i] = p[3] ? ((uint32_t)p[3] << 24) | (p[0] << 16) | (p[1] << 8) | p[2] : 0;
+		rleSize = encodeRLE(rle, pixels, count);
+
+		if (rleSize <= pngSize)
+			writeBytes(fp, name, rle, rleSize);
+		else
+			writeBytes(fp, name, png, pngSize);
+		fprintf(fp, "static const struct Asset %s_asset = { %d, %d, %s, %s_data, sizeof(%s_data) };\n\n",
+			name, width, height, rleSize <= pngSize ? "ASSET_RLE" : "ASSET_PNG", name, name);
+		printf("%-16s %4dx%-4d rle %7ld png %7ld -> %s\n", name, width, height, rleSize, pngSize,
+			rleSize <= pngSize ? "rle" : "png");
+
+		stbi_image_free(rgba);
+		free(png);
+		free(pixels);
+		free(rle);
+	}
+
+	fprintf(fp, "#endif\n");
+	if (fclose(fp) != 0)
+	{
+		fprintf(stderr, "can't write %s\n", argv[1]);
+		return 1;
+	}
+	return 0;
+}
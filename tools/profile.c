@@ -0,0 +1,176 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Guest profiler: runs a ROM headless with the CPU profiler attached and
+// prints where the guest spends its cycles.  Built by "make profile",
+// which compiles the core with FREEINTV_PROFILE and FREEINTV_HEATMAP.
+//
+//   freeintv_profile [-f frames] [-s system_dir] [-i script] [-n top]
+//                    [-o flat] [-g folded] [-m pages] [-t bus_trace] [rom]
+//
+// -o writes one line per address run, -g the cycles per guest call stack
+// for flamegraph.pl.  -m adds the memory heatmap to the report and writes
+// its counts per page, -t streams every bus access to a file (see
+// heatmap.h).  rom defaults to the bundled 4-Tris.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "intv.h"
+#include "cart.h"
+#include "controller.h"
+#include "mixer.h"
+#include "psg.h"
+#include "profile.h"
+#include "heatmap.h"
+#include "script.h"
+
+#define MAX_PATH 1024
+
+int main(int argc, char **argv)
+{
+	const char *rom = "open-content/4-Tris/4-tris.bin";
+	const char *systemDir = ".";
+	const char *flat = NULL;
+	const char *folded = NULL;
+	const char *pages = NULL;
+	const char *trace = NULL;
+	char execPath[MAX_PATH], gromPath[MAX_PATH];
+	struct Script script;
+	struct Machine *m;
+	int16_t audio[MIXER_MAX_SAMPLES * 2];
+	int joypad[20];
+	int frames = 3600;
+	int top = 20;
+	int frame, port, i, failed = 0;
+
+	memset(&script, 0, sizeof(script));
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			systemDir = argv[++i];
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			top = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			flat = argv[++i];
+		else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc)
+			folded = argv[++i];
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+			pages = argv[++i];
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			trace = argv[++i];
+		else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+		{
+			if (!ScriptLoad(&script, argv[++i]))
+			{
+				fprintf(stderr, "can't read input script %s\n", argv[i]);
+				return 1;
+			}
+		}
+		else if (argv[i][0] != '-')
+			rom = argv[i];
+		else
+		{
+			fprintf(stderr, "usage: %s [-f frames] [-s system_dir] [-i script] [-n top] [-o flat] [-g folded] [-m pages] [-t bus_trace] [rom]\n", argv[0]);
+			return 1;
+		}
+	}
+	snprintf(execPath, sizeof(execPath), "%s/exec.bin", systemDir);
+	snprintf(gromPath, sizeof(gromPath), "%s/grom.bin", systemDir);
+
+	CP1610Init();
+	MixerInit(MIXER_DEFAULT_RATE);
+
+	m = MachineCreate();
+	if (m == NULL || !loadExec(m, execPath) || !loadGrom(m, gromPath) || !LoadCart(m, rom))
+	{
+		fprintf(stderr, "can't load %s with the BIOS in %s\n", rom, systemDir);
+		MachineDestroy(m);
+		ScriptFree(&script);
+		return 1;
+	}
+	m->profile = ProfileCreate();
+	if (pages || trace)
+		m->heatmap = HeatmapCreate();
+	if (m->profile == NULL || ((pages || trace) && m->heatmap == NULL))
+	{
+		fprintf(stderr, "out of memory\n");
+		ProfileDestroy(m->profile);
+		HeatmapDestroy(m->heatmap);
+		MachineDestroy(m);
+		ScriptFree(&script);
+		return 1;
+	}
+	if (trace && !HeatmapTrace(m->heatmap, trace))
+	{
+		fprintf(stderr, "can't write %s\n", trace);
+		trace = NULL;
+		failed = 1;
+	}
+
+	for (frame = 0; frame < frames && !m->halt; frame++)
+	{
+		for (port = 0; port < 2; port++)
+		{
+			ScriptJoypad(ScriptMask(&script, frame, port), joypad);
+			setControllerInput(m, port, getControllerState(joypad, port));
+		}
+		Run(m);
+		MixerFrame(m, audio);
+		PSGFrame(m);
+	}
+
+	printf("%s: %d frames%s\n", rom, frame, m->halt ? ", halted" : "");
+	ProfileReport(m->profile, stdout, top);
+	if (trace && !HeatmapTraceEnd(m->heatmap))
+	{
+		fprintf(stderr, "can't write %s\n", trace);
+		failed = 1;
+	}
+	if (m->heatmap)
+	{
+		printf("\n");
+		HeatmapReport(m->heatmap, stdout, top);
+	}
+	if (pages && !HeatmapWritePages(m->heatmap, pages))
+	{
+		fprintf(stderr, "can't write %s\n", pages);
+		failed = 1;
+	}
+	if (flat && !ProfileWriteFlat(m->profile, flat))
+	{
+		fprintf(stderr, "can't write %s\n", flat);
+		failed = 1;
+	}
+	if (folded && !ProfileWriteFolded(m->profile, folded))
+	{
+		fprintf(stderr, "can't write %s\n", folded);
+		failed = 1;
+	}
+
+	ProfileDestroy(m->profile);
+	HeatmapDestroy(m->heatmap);
+	m->profile = NULL;
+	m->heatmap = NULL;
+	MachineDestroy(m);
+	ScriptFree(&script);
+	return failed;
+}
@@ -0,0 +1,387 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// ROM farm: runs every ROM in a directory headless, one machine per
+// worker thread, and keeps a running hash of the frames and the audio.
+// The hashes at every checkpoint are written out as a baseline, or checked
+// against one to find where a title first diverges.  Built by "make
+// romfarm".
+//
+//   freeintv_romfarm [-f frames] [-n every] [-j workers] [-s system_dir]
+//                    [-b baseline] [-w baseline] rom_dir
+//
+// ROMs are the .bin, .int and .rom files in rom_dir.  name.input next to
+// name.bin is its input script (see script.h), none means nothing is
+// pressed.  -w writes the hashes, -b compares against them; the exit
+// status is 1 if any title diverged, failed to load or isn't in the
+// baseline, or the baseline has a title rom_dir doesn't.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "intv.h"
+#include "cart.h"
+#include "controller.h"
+#include "mixer.h"
+#include "psg.h"
+#include "script.h"
+
+#define MAX_ROMS 1024
+#define MAX_PATH 1024
+
+struct Title {
+	char name[256];
+	char path[MAX_PATH];
+	uint64_t *video; // running hashes at each checkpoint
+	uint64_t *audio;
+	int loaded;
+	int halted; // frame the machine halted at, -1 if it didn't
+	double seconds;
+	int diverged; // first checkpoint frame differing from the baseline, -1 if none
+	int missing; // not in the baseline
+};
+
+static struct Title titles[MAX_ROMS];
+static int titleCount;
+
+// Baseline titles with no ROM in rom_dir
+static char orphans[MAX_ROMS][256];
+static int orphanCount;
+
+static int frames = 3600;
+static int every = 60;
+static char execPath[MAX_PATH];
+static char gromPath[MAX_PATH];
+
+static pthread_mutex_t nextLock = PTHREAD_MUTEX_INITIALIZER;
+static int next;
+
+static uint64_t hash(uint64_t h, const void *data, size_t len)
+{
+	const unsigned char *p = (const unsigned char *)data;
+
+	while (len--)
+	{
+		h ^= *p++;
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+static double seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void runTitle(struct Title *t)
+{
+	char scriptPath[MAX_PATH];
+	char *dot;
+	struct Script script;
+	struct Machine *m;
+	int16_t audio[MIXER_MAX_SAMPLES * 2];
+	int joypad[20];
+	uint64_t v = 14695981039346656037ULL, a = v;
+	int frame, port;
+	double start;
+
+	t->halted = -1;
+	snprintf(scriptPath, sizeof(scriptPath), "%s", t->path);
+	dot = strrchr(scriptPath, '.');
+	if (dot)
+		snprintf(dot, sizeof(scriptPath) - (dot - scriptPath), ".input");
+	ScriptLoad(&script, scriptPath);
+
+	m = MachineCreate();
+	if (m == NULL || !loadExec(m, execPath) || !loadGrom(m, gromPath) || !LoadCart(m, t->path))
+	{
+		MachineDestroy(m);
+		ScriptFree(&script);
+		return;
+	}
+	t->loaded = 1;
+
+	start = seconds();
+	for (frame = 0; frame < frames; frame++)
+	{
+		for (port = 0; port < 2; port++)
+		{
+			ScriptJoypad(ScriptMask(&script, frame, port), joypad);
+			setControllerInput(m, port, getControllerState(joypad, port));
+		}
+		Run(m);
+		MixerFrame(m, audio);
+		PSGFrame(m);
+		if (m->halt && t->halted < 0)
+			t->halted = frame;
+
+		v = hash(v, m->stic.frame, sizeof(m->stic.frame));
+		a = hash(a, audio, MixerSamples * 2 * sizeof(int16_t));
+		if ((frame + 1) % every == 0)
+		{
+			t->video[frame / every] = v;
+			t->audio[frame / every] = a;
+		}
+	}
+	t->seconds = seconds() - start;
+
+	MachineDestroy(m);
+	ScriptFree(&script);
+}
+
+static void *worker(void *arg)
+{
+	int i;
+
+	(void)arg;
+	for (;;)
+	{
+		pthread_mutex_lock(&nextLock);
+		i = next++;
+		pthread_mutex_unlock(&nextLock);
+		if (i >= titleCount)
+			return NULL;
+		runTitle(&titles[i]);
+	}
+}
+
+static int isRom(const char *name)
+{
+	const char *dot = strrchr(name, '.');
+
+	return dot && (strcmp(dot, ".bin") == 0 || strcmp(dot, ".int") == 0 || strcmp(dot, ".rom") == 0);
+}
+
+static int byName(const void *a, const void *b)
+{
+	return strcmp(((const struct Title *)a)->name, ((const struct Title *)b)->name);
+}
+
+static int findTitles(const char *dir)
+{
+	DIR *d = opendir(dir);
+	struct dirent *e;
+
+	if (d == NULL)
+		return 0;
+	while ((e = readdir(d)) != NULL && titleCount < MAX_ROMS)
+	{
+		struct Title *t = &titles[titleCount];
+
+		if (!isRom(e->d_name))
+			continue;
+		snprintf(t->name, sizeof(t->name), "%s", e->d_name);
+		snprintf(t->path, sizeof(t->path), "%s/%s", dir, e->d_name);
+		titleCount++;
+	}
+	closedir(d);
+	qsort(titles, titleCount, sizeof(titles[0]), byName);
+	return 1;
+}
+
+// Baseline lines are "name frame video audio", hashes in hex
+static int writeBaseline(const char *path)
+{
+	FILE *fp = fopen(path, "w");
+	int i, c;
+
+	if (fp == NULL)
+		return 0;
+	for (i = 0; i < titleCount; i++)
+	{
+		if (!titles[i].loaded)
+			continue;
+		for (c = 0; c < frames / every; c++)
+			fprintf(fp, "%s %d %016llx %016llx\n", titles[i].name, (c + 1) * every,
+				(unsigned long long)titles[i].video[c], (unsigned long long)titles[i].audio[c]);
+	}
+	fclose(fp);
+	return 1;
+}
+
+static void addOrphan(const char *name)
+{
+	int i;
+
+	for (i = 0; i < orphanCount; i++)
+	{
+		if (strcmp(orphans[i], name) == 0)
+			return;
+	}
+	if (orphanCount < MAX_ROMS)
+		snprintf(orphans[orphanCount++], sizeof(orphans[0]), "%s", name);
+}
+
+static int checkBaseline(const char *path)
+{
+	char line[512], name[256];
+	int frame, c, i, found;
+	unsigned long long v, a;
+	FILE *fp = fopen(path, "r");
+
+	if (fp == NULL)
+		return 0;
+	for (i = 0; i < titleCount; i++)
+	{
+		titles[i].missing = 1;
+		titles[i].diverged = -1;
+	}
+	while (fgets(line, sizeof(line), fp))
+	{
+		if (sscanf(line, "%255s %d %llx %llx", name, &frame, &v, &a) != 4)
+			continue;
+		found = 0;
+		for (i = 0; i < titleCount; i++)
+		{
+			if (strcmp(titles[i].name, name) != 0)
+				continue;
+			found = 1;
+			titles[i].missing = 0;
+			c = frame / every - 1;
+			if (frame % every != 0 || c < 0 || c >= frames / every || !titles[i].loaded)
+				break;
+			if ((titles[i].video[c] != v || titles[i].audio[c] != a) &&
+				(titles[i].diverged < 0 || frame < titles[i].diverged))
+				titles[i].diverged = frame;
+		}
+		if (!found)
+			addOrphan(name);
+	}
+	fclose(fp);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *systemDir = ".";
+	const char *romDir = NULL;
+	const char *baseline = NULL;
+	const char *output = NULL;
+	int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_t threads[256];
+	int i, failed = 0;
+	double start, total;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			every = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+			workers = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			systemDir = argv[++i];
+		else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+			baseline = argv[++i];
+		else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+			output = argv[++i];
+		else if (argv[i][0] != '-' && romDir == NULL)
+			romDir = argv[i];
+		else
+			romDir = NULL, i = argc;
+	}
+	if (romDir == NULL || frames < 1 || every < 1)
+	{
+		fprintf(stderr, "usage: %s [-f frames] [-n every] [-j workers] [-s system_dir] [-b baseline] [-w baseline] rom_dir\n", argv[0]);
+		return 2;
+	}
+	if (workers < 1)
+		workers = 1;
+	if (workers > 256)
+		workers = 256;
+	snprintf(execPath, sizeof(execPath), "%s/exec.bin", systemDir);
+	snprintf(gromPath, sizeof(gromPath), "%s/grom.bin", systemDir);
+
+	if (!findTitles(romDir) || titleCount == 0)
+	{
+		fprintf(stderr, "no ROMs in %s\n", romDir);
+		return 2;
+	}
+	for (i = 0; i < titleCount; i++)
+	{
+		titles[i].video = (uint64_t *)calloc(frames / every + 1, sizeof(uint64_t));
+		titles[i].audio = (uint64_t *)calloc(frames / every + 1, sizeof(uint64_t));
+		titles[i].diverged = -1;
+	}
+
+	CP1610Init();
+	MixerInit(MIXER_DEFAULT_RATE);
+
+	if (workers > titleCount)
+		workers = titleCount;
+	start = seconds();
+	for (i = 1; i < workers; i++)
+		pthread_create(&threads[i], NULL, worker, NULL);
+	worker(NULL);
+	for (i = 1; i < workers; i++)
+		pthread_join(threads[i], NULL);
+	total = seconds() - start;
+
+	if (baseline && !checkBaseline(baseline))
+	{
+		fprintf(stderr, "can't read baseline %s\n", baseline);
+		baseline = NULL;
+	}
+
+	printf("\n%-32s %8s %8s %9s  %s\n", "title", "frames", "seconds", "fps", "result");
+	for (i = 0; i < titleCount; i++)
+	{
+		struct Title *t = &titles[i];
+		char result[64] = "ok";
+
+		if (!t->loaded)
+			snprintf(result, sizeof(result), "load failed");
+		else if (baseline && t->missing)
+			snprintf(result, sizeof(result), "not in baseline");
+		else if (baseline && t->diverged >= 0)
+			snprintf(result, sizeof(result), "diverged by frame %d", t->diverged);
+		else if (!baseline)
+			snprintf(result, sizeof(result), "-");
+		if (t->loaded && t->halted >= 0)
+			snprintf(result + strlen(result), sizeof(result) - strlen(result), ", halted at %d", t->halted);
+		failed |= !t->loaded || (baseline && (t->missing || t->diverged >= 0));
+
+		printf("%-32s %8d %8.3f %9.1f  %s\n", t->name, t->loaded ? frames : 0, t->seconds,
+			t->seconds > 0 ? frames / t->seconds : 0.0, result);
+	}
+	for (i = 0; i < orphanCount; i++)
+		printf("%-32s %8s %8s %9s  %s\n", orphans[i], "-", "-", "-", "in baseline, not in rom_dir");
+	failed |= orphanCount > 0;
+	printf("%d titles on %d workers in %.3f s\n", titleCount, workers, total);
+
+	if (output && !writeBaseline(output))
+	{
+		fprintf(stderr, "can't write baseline %s\n", output);
+		failed = 1;
+	}
+	for (i = 0; i < titleCount; i++)
+	{
+		free(titles[i].video);
+		free(titles[i].audio);
+	}
+	return failed;
+}
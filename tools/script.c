@@ -0,0 +1,88 @@
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libretro.h"
+#include "script.h"
+
+int ScriptLoad(struct Script *script, const char *path)
+{
+	char line[256];
+	int size = 0;
+	FILE *fp = fopen(path, "r");
+
+	memset(script, 0, sizeof(*script));
+	if (fp == NULL)
+		return 0;
+	while (fgets(line, sizeof(line), fp))
+	{
+		struct ScriptLine entry;
+
+		if (strchr(line, '#'))
+			*strchr(line, '#') = '\0';
+		entry.mask[1] = 0;
+		if (sscanf(line, "%d %x %x", &entry.frame, &entry.mask[0], &entry.mask[1]) < 2)
+			continue;
+		if (script->count == size)
+		{
+			struct ScriptLine *grown;
+
+			size = size ? size * 2 : 64;
+			grown = (struct ScriptLine *)realloc(script->lines, size * sizeof(struct ScriptLine));
+			if (grown == NULL)
+				break;
+			script->lines = grown;
+		}
+		script->lines[script->count++] = entry;
+	}
+	fclose(fp);
+	return 1;
+}
+
+void ScriptFree(struct Script *script)
+{
+	free(script->lines);
+	memset(script, 0, sizeof(*script));
+}
+
+int ScriptMask(struct Script *script, int frame, int port)
+{
+	while (script->pos + 1 < script->count && script->lines[script->pos + 1].frame <= frame)
+		script->pos++;
+	if (script->count == 0 || script->lines[script->pos].frame > frame || port < 0 || port > 1)
+		return 0;
+	return script->lines[script->pos].mask[port];
+}
+
+void ScriptJoypad(int mask, int joypad[20])
+{
+	// the same order retro_run fills joypad0[] and joypad1[] in
+	static const int ids[20] = {
+		RETRO_DEVICE_ID_JOYPAD_UP, RETRO_DEVICE_ID_JOYPAD_DOWN, RETRO_DEVICE_ID_JOYPAD_LEFT, RETRO_DEVICE_ID_JOYPAD_RIGHT,
+		RETRO_DEVICE_ID_JOYPAD_A, RETRO_DEVICE_ID_JOYPAD_B, RETRO_DEVICE_ID_JOYPAD_X, RETRO_DEVICE_ID_JOYPAD_Y,
+		RETRO_DEVICE_ID_JOYPAD_START, RETRO_DEVICE_ID_JOYPAD_SELECT,
+		RETRO_DEVICE_ID_JOYPAD_L, RETRO_DEVICE_ID_JOYPAD_R, RETRO_DEVICE_ID_JOYPAD_L2, RETRO_DEVICE_ID_JOYPAD_R2,
+		-1, -1, -1, -1, // analog sticks
+		RETRO_DEVICE_ID_JOYPAD_L3, RETRO_DEVICE_ID_JOYPAD_R3
+	};
+	int i;
+
+	for (i = 0; i < 20; i++)
+		joypad[i] = ids[i] >= 0 ? (mask >> ids[i]) & 1 : 0;
+}
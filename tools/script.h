@@ -0,0 +1,45 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+/*
+	This file is part of FreeIntv.
+
+	FreeIntv is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+
+	FreeIntv is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License along
+	with FreeIntv; if not, write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+// Input scripts for the tools.  A script holds "frame mask0 [mask1]"
+// lines, masks in hex with one bit per RETRO_DEVICE_ID_JOYPAD_* id for
+// each port.  A line holds until the next one, '#' starts a comment.
+
+struct ScriptLine {
+	int frame;
+	int mask[2];
+};
+
+struct Script {
+	struct ScriptLine *lines;
+	int count;
+	int pos;
+};
+
+int ScriptLoad(struct Script *script, const char *path); // 0 if it can't be read
+void ScriptFree(struct Script *script);
+
+// The mask held on a port at frame, frames asked for in increasing order
+int ScriptMask(struct Script *script, int frame, int port);
+
+// Spreads a mask over the joypad[] layout getControllerState() reads
+void ScriptJoypad(int mask, int joypad[20]);
+
+#endif